@@ -21,7 +21,7 @@ include(ExternalProject)
 # ONNX.proto definition version
 #------------------------------------------------------------------------------
 
-set(ONNX_VERSION 1.3.0)
+set(ONNX_VERSION 1.4.1)
 
 #------------------------------------------------------------------------------
 # Download and install libonnx ...
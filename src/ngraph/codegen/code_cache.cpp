@@ -0,0 +1,207 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstdlib>
+#include <iomanip>
+#include <sstream>
+
+#include <llvm/Bitcode/BitcodeReader.h>
+#include <llvm/Bitcode/BitcodeWriter.h>
+#include <llvm/ExecutionEngine/ObjectCache.h>
+#include <llvm/IR/Module.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include "ngraph/codegen/code_cache.hpp"
+#include "ngraph/file_util.hpp"
+#include "ngraph/log.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static const string s_key_prefix = "ngraph_codegen_";
+
+namespace
+{
+    // Object code of the modules the execution engine generates, keyed by module identifier
+    class JITObjectCache : public llvm::ObjectCache
+    {
+    public:
+        JITObjectCache(codegen::CodeCache& cache)
+            : m_cache(cache)
+        {
+        }
+
+        void notifyObjectCompiled(const llvm::Module* module, llvm::MemoryBufferRef object) override
+        {
+            const string& key = module->getModuleIdentifier();
+            if (codegen::CodeCache::is_key(key))
+            {
+                m_cache.store(key, ".o", string(object.getBufferStart(), object.getBufferSize()));
+            }
+        }
+
+        unique_ptr<llvm::MemoryBuffer> getObject(const llvm::Module* module) override
+        {
+            const string& key = module->getModuleIdentifier();
+            string object;
+            if (!codegen::CodeCache::is_key(key) || !m_cache.load(key, ".o", object))
+            {
+                return nullptr;
+            }
+            return llvm::MemoryBuffer::getMemBufferCopy(object, key);
+        }
+
+    private:
+        codegen::CodeCache& m_cache;
+    };
+}
+
+codegen::CodeCache& codegen::CodeCache::get()
+{
+    static CodeCache s_cache;
+    return s_cache;
+}
+
+codegen::CodeCache::CodeCache()
+    : m_object_cache(new JITObjectCache(*this))
+{
+    if (const char* directory = getenv("NGRAPH_CODEGEN_CACHE_DIR"))
+    {
+        m_directory = directory;
+        if (!file_util::exists(m_directory))
+        {
+            file_util::make_directory(m_directory);
+        }
+    }
+}
+
+codegen::CodeCache::~CodeCache()
+{
+}
+
+string codegen::CodeCache::make_key(const string& source)
+{
+    // Two independent 64-bit hashes, so a collision needs both to collide
+    uint64_t fnv = 14695981039346656037ULL;
+    for (unsigned char c : source)
+    {
+        fnv = (fnv ^ c) * 1099511628211ULL;
+    }
+    stringstream ss;
+    ss << s_key_prefix << hex << setfill('0') << setw(16) << hash<string>()(source) << setw(16)
+       << fnv << "_" << dec << source.size();
+    return ss.str();
+}
+
+bool codegen::CodeCache::is_key(const string& module_identifier)
+{
+    return module_identifier.compare(0, s_key_prefix.size(), s_key_prefix) == 0;
+}
+
+unique_ptr<llvm::Module> codegen::CodeCache::load_module(const string& key,
+                                                          llvm::LLVMContext& context)
+{
+    string bitcode;
+    if (!load(key, ".bc", bitcode))
+    {
+        return nullptr;
+    }
+    auto module = llvm::parseBitcodeFile(llvm::MemoryBufferRef(bitcode, key), context);
+    if (!module)
+    {
+        NGRAPH_DEBUG << "Discarding unreadable cached module " << key << ": "
+                     << llvm::toString(module.takeError());
+        return nullptr;
+    }
+    (*module)->setModuleIdentifier(key);
+    m_module_hits++;
+    return move(*module);
+}
+
+void codegen::CodeCache::store_module(const string& key, llvm::Module& module)
+{
+    module.setModuleIdentifier(key);
+    string bitcode;
+    llvm::raw_string_ostream out(bitcode);
+    llvm::WriteBitcodeToFile(&module, out);
+    out.flush();
+    store(key, ".bc", bitcode);
+}
+
+llvm::ObjectCache* codegen::CodeCache::get_object_cache()
+{
+    return m_object_cache.get();
+}
+
+bool codegen::CodeCache::load(const string& key, const string& extension, string& data)
+{
+    string entry = key + extension;
+    {
+        lock_guard<mutex> lock(m_mutex);
+        auto it = m_entries.find(entry);
+        if (it != m_entries.end())
+        {
+            data = it->second;
+            return true;
+        }
+    }
+    if (m_directory.empty())
+    {
+        return false;
+    }
+    string path = file_util::path_join(m_directory, entry);
+    if (!file_util::exists(path))
+    {
+        return false;
+    }
+    data = file_util::read_file_to_string(path);
+    lock_guard<mutex> lock(m_mutex);
+    m_entries[entry] = data;
+    return true;
+}
+
+void codegen::CodeCache::store(const string& key, const string& extension, const string& data)
+{
+    string entry = key + extension;
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_entries[entry] = data;
+    }
+    if (m_directory.empty())
+    {
+        return;
+    }
+    // Write under a unique name first, so other processes never read a partial entry
+    string path = file_util::path_join(m_directory, entry);
+    int fd;
+    llvm::SmallString<128> partial_path;
+    if (llvm::sys::fs::createUniqueFile(path + ".%%%%%%", fd, partial_path))
+    {
+        NGRAPH_DEBUG << "Could not write codegen cache entry " << path;
+        return;
+    }
+    {
+        llvm::raw_fd_ostream out(fd, true);
+        out << data;
+    }
+    if (llvm::sys::fs::rename(partial_path, path))
+    {
+        NGRAPH_DEBUG << "Could not write codegen cache entry " << path;
+        llvm::sys::fs::remove(partial_path);
+    }
+}
@@ -0,0 +1,82 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace ngraph
+{
+    namespace codegen
+    {
+        class CodeCache;
+    }
+}
+
+namespace llvm
+{
+    class LLVMContext;
+    class Module;
+    class ObjectCache;
+}
+
+/// \brief Content-addressed cache of compiled translation units.
+///
+/// Entries are keyed by a hash of everything the compiled code depends on. An entry holds the
+/// optimized module clang produced, which skips the frontend and optimizer, and the object
+/// code the JIT generated from it, which skips code generation. Keeping the module also keeps
+/// its static constructors runnable. Entries live in memory for the life of the process and,
+/// when NGRAPH_CODEGEN_CACHE_DIR names a directory, on disk across processes.
+class ngraph::codegen::CodeCache
+{
+public:
+    static CodeCache& get();
+
+    /// \brief Cache key of a translation unit, prefixed so that modules compiled outside the
+    ///        cache are recognized by their identifiers.
+    static std::string make_key(const std::string& source);
+    static bool is_key(const std::string& module_identifier);
+
+    /// \brief Returns the cached module of `key` parsed into `context`, or nullptr.
+    std::unique_ptr<llvm::Module> load_module(const std::string& key,
+                                              llvm::LLVMContext& context);
+    /// \brief Stores the module of `key`. The module identifier is set to the key so that its
+    ///        object code is cached by the execution engine.
+    void store_module(const std::string& key, llvm::Module& module);
+    /// \brief Number of modules load_module found, over the life of the process.
+    size_t get_module_hit_count() const { return m_module_hits; }
+
+    /// \brief Object cache to install in an execution engine. Only modules whose identifier is
+    ///        a cache key are looked up and stored.
+    llvm::ObjectCache* get_object_cache();
+
+    bool load(const std::string& key, const std::string& extension, std::string& data);
+    void store(const std::string& key, const std::string& extension, const std::string& data);
+
+private:
+    CodeCache();
+    ~CodeCache();
+
+    std::string m_directory;
+    std::mutex m_mutex;
+    std::unordered_map<std::string, std::string> m_entries;
+    std::atomic<size_t> m_module_hits{0};
+    std::unique_ptr<llvm::ObjectCache> m_object_cache;
+};
@@ -14,8 +14,15 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <exception>
 #include <iostream>
+#include <mutex>
+#include <sstream>
 #include <string>
+#include <thread>
 
 #include <clang/Basic/DiagnosticOptions.h>
 #include <clang/Basic/TargetInfo.h>
@@ -48,6 +55,7 @@
 #include <llvm/Support/raw_ostream.h>
 
 #include "header_resource.hpp"
+#include "ngraph/codegen/code_cache.hpp"
 #include "ngraph/codegen/compiler.hpp"
 #include "ngraph/file_util.hpp"
 #include "ngraph/log.hpp"
@@ -78,9 +86,12 @@ class CompilerInfo
 public:
     std::string pch_file;
     shared_ptr<codegen::CompilerCore> compiler;
+    // Compilers for parallel compilation that no thread is using
+    vector<shared_ptr<codegen::CompilerCore>> idle_compilers;
 };
 
 static unordered_map<std::string, CompilerInfo> s_compiler_info;
+static mutex s_compiler_info_mutex;
 
 static class StaticHandler
 {
@@ -117,6 +128,8 @@ codegen::Compiler::Compiler()
 codegen::Compiler::~Compiler()
 {
     m_compiler_action = nullptr;
+    m_compiler_actions.clear();
+    m_contexts.clear();
     m_compiler_core = nullptr;
 }
 
@@ -130,23 +143,166 @@ void codegen::Compiler::add_header_search_path(const std::string& path)
     m_header_search_paths.push_back(path);
 }
 
+static shared_ptr<codegen::CompilerCore>
+    create_compiler_core(const std::string& precompiled_header_source,
+                         const vector<std::string>& header_search_paths)
+{
+    auto compiler = make_shared<codegen::CompilerCore>();
+    for (const std::string& path : header_search_paths)
+    {
+        compiler->add_header_search_path(path);
+    }
+    compiler->set_precompiled_header_source(precompiled_header_source);
+    return compiler;
+}
+
 std::unique_ptr<codegen::Module> codegen::Compiler::compile(const std::string& source)
 {
-    // lock_guard<mutex> lock(m_mutex);
-    CompilerInfo& compiler_info = s_compiler_info[m_precompiled_header_source];
-    if (!compiler_info.compiler)
+    shared_ptr<CompilerCore> compiler;
     {
-        compiler_info.compiler = make_shared<CompilerCore>();
-        for (const std::string& path : m_header_search_paths)
+        lock_guard<mutex> lock(s_compiler_info_mutex);
+        CompilerInfo& compiler_info = s_compiler_info[m_precompiled_header_source];
+        if (!compiler_info.compiler)
         {
-            compiler_info.compiler->add_header_search_path(path);
+            compiler_info.compiler =
+                create_compiler_core(m_precompiled_header_source, m_header_search_paths);
         }
-        compiler_info.compiler->set_precompiled_header_source(m_precompiled_header_source);
+        compiler = compiler_info.compiler;
     }
-    auto rc = compiler_info.compiler->compile(m_compiler_action, source);
+    auto rc = compiler->compile(m_compiler_action, source);
     return rc;
 }
 
+static size_t get_compile_thread_count()
+{
+    const char* env = std::getenv("NGRAPH_CODEGEN_THREADS");
+    size_t count = env ? strtoul(env, nullptr, 10) : std::thread::hardware_concurrency();
+    return max<size_t>(count, 1);
+}
+
+// Everything the compiled code depends on goes into the key, so that a cache directory
+// shared by different builds, machines or settings never serves stale code
+static std::string get_cache_key(const std::string& precompiled_header_source,
+                                 const vector<std::string>& header_search_paths,
+                                 const std::string& source)
+{
+    stringstream ss;
+    ss << NGRAPH_VERSION << "\n"
+       << sys::getHostCPUName().str() << "\n"
+       << (std::getenv("NGRAPH_COMPILER_DEBUGINFO_ENABLE") != nullptr) << "\n";
+    for (const std::string& path : header_search_paths)
+    {
+        ss << path << "\n";
+    }
+    ss << precompiled_header_source << "\n" << source;
+    return codegen::CodeCache::make_key(ss.str());
+}
+
+// Clang names the static constructor function of a module after its source file, which is the
+// same for every unit, and the JIT looks constructors up by name
+static void make_static_constructors_unique(llvm::Module& module, const std::string& suffix)
+{
+    for (llvm::Function& function : module)
+    {
+        if (function.hasLocalLinkage() && function.getName().startswith("_GLOBAL__sub_I_"))
+        {
+            function.setName(function.getName() + "_" + suffix);
+        }
+    }
+}
+
+vector<unique_ptr<codegen::Module>> codegen::Compiler::compile(const vector<std::string>& sources)
+{
+    vector<unique_ptr<codegen::Module>> modules(sources.size());
+
+    // Every unit gets its own slot so that the threads never resize the vectors
+    size_t base = m_compiler_actions.size();
+    m_compiler_actions.resize(base + sources.size());
+    m_contexts.resize(base + sources.size());
+
+    atomic<size_t> next_index{0};
+    exception_ptr error;
+    mutex error_mutex;
+    auto compile_units = [&]() {
+        // CompilerInstance is not thread safe, so every thread checks one out of the idle pool
+        shared_ptr<CompilerCore> compiler;
+        try
+        {
+            for (size_t i = next_index++; i < sources.size(); i = next_index++)
+            {
+                CodeCache& cache = CodeCache::get();
+                std::string key =
+                    get_cache_key(m_precompiled_header_source, m_header_search_paths, sources[i]);
+                m_contexts[base + i].reset(new LLVMContext());
+                std::unique_ptr<llvm::Module> module =
+                    cache.load_module(key, *m_contexts[base + i]);
+                if (!module)
+                {
+                    m_contexts[base + i] = nullptr;
+                    if (!compiler)
+                    {
+                        lock_guard<mutex> lock(s_compiler_info_mutex);
+                        auto& idle_compilers =
+                            s_compiler_info[m_precompiled_header_source].idle_compilers;
+                        if (idle_compilers.empty())
+                        {
+                            compiler = create_compiler_core(m_precompiled_header_source,
+                                                            m_header_search_paths);
+                        }
+                        else
+                        {
+                            compiler = idle_compilers.back();
+                            idle_compilers.pop_back();
+                        }
+                    }
+                    auto compiled = compiler->compile(m_compiler_actions[base + i], sources[i]);
+                    if (compiled)
+                    {
+                        module = compiled->take_module();
+                        make_static_constructors_unique(*module, key);
+                        cache.store_module(key, *module);
+                    }
+                }
+                if (module)
+                {
+                    modules[i].reset(new codegen::Module(move(module)));
+                }
+            }
+        }
+        catch (...)
+        {
+            lock_guard<mutex> lock(error_mutex);
+            if (!error)
+            {
+                error = current_exception();
+            }
+            next_index = sources.size();
+        }
+        if (compiler)
+        {
+            lock_guard<mutex> lock(s_compiler_info_mutex);
+            s_compiler_info[m_precompiled_header_source].idle_compilers.push_back(compiler);
+        }
+    };
+
+    size_t thread_count = min(get_compile_thread_count(), sources.size());
+    vector<std::thread> threads;
+    for (size_t i = 1; i < thread_count; i++)
+    {
+        threads.emplace_back(compile_units);
+    }
+    compile_units();
+    for (std::thread& t : threads)
+    {
+        t.join();
+    }
+    if (error)
+    {
+        rethrow_exception(error);
+    }
+    return modules;
+}
+
 static std::string GetExecutablePath(const char* Argv0)
 {
     // This just needs to be some symbol in the binary; C++ doesn't
@@ -320,15 +476,21 @@ std::unique_ptr<codegen::Module>
 
     preprocessor_options.RetainRemappedFileBuffers = true;
 
-    CompilerInfo& compiler_info = s_compiler_info[m_precompiled_header_source];
-    if (!m_precompiled_header_source.empty() && compiler_info.pch_file.empty())
+    std::string pch_file;
     {
-        compiler_info.pch_file = generate_pch(m_precompiled_header_source);
+        // The first compiler to need the header generates it, the others wait for it
+        lock_guard<mutex> lock(s_compiler_info_mutex);
+        CompilerInfo& compiler_info = s_compiler_info[m_precompiled_header_source];
+        if (!m_precompiled_header_source.empty() && compiler_info.pch_file.empty())
+        {
+            compiler_info.pch_file = generate_pch(m_precompiled_header_source);
+        }
+        pch_file = compiler_info.pch_file;
     }
-    if (!compiler_info.pch_file.empty())
+    if (!pch_file.empty())
     {
         // Preprocessor options
-        preprocessor_options.ImplicitPCHInclude = compiler_info.pch_file;
+        preprocessor_options.ImplicitPCHInclude = pch_file;
         preprocessor_options.DisablePCHValidation = 0;
     }
 
@@ -38,6 +38,7 @@ namespace clang
 
 namespace llvm
 {
+    class LLVMContext;
     class Module;
 }
 
@@ -60,9 +61,21 @@ public:
     void set_precompiled_header_source(const std::string& source);
     void add_header_search_path(const std::string& path);
     std::unique_ptr<ngraph::codegen::Module> compile(const std::string& source);
+
+    /// \brief Compiles independent translation units in parallel, reusing the code cache.
+    ///
+    /// Units found in the code cache are not compiled again. The others are compiled on up
+    /// to NGRAPH_CODEGEN_THREADS threads, hardware concurrency by default, each with its own
+    /// compiler instance, and stored in the cache. A unit that fails to compile yields a
+    /// nullptr module.
+    std::vector<std::unique_ptr<ngraph::codegen::Module>>
+        compile(const std::vector<std::string>& sources);
     std::unique_ptr<clang::CodeGenAction>& get_compiler_action() { return m_compiler_action; }
 private:
     std::unique_ptr<clang::CodeGenAction> m_compiler_action;
+    // Own the contexts of the modules compiled by compile(sources)
+    std::vector<std::unique_ptr<clang::CodeGenAction>> m_compiler_actions;
+    std::vector<std::unique_ptr<llvm::LLVMContext>> m_contexts;
     std::shared_ptr<CompilerCore> m_compiler_core;
     std::string m_precompiled_header_source;
     std::vector<std::string> m_header_search_paths;
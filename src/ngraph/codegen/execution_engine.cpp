@@ -15,7 +15,9 @@
 //*****************************************************************************
 
 #include <llvm/ExecutionEngine/ExecutionEngine.h>
+#include <llvm/IR/Module.h>
 
+#include "ngraph/codegen/code_cache.hpp"
 #include "ngraph/codegen/execution_engine.hpp"
 
 using namespace ngraph;
@@ -51,6 +53,11 @@ bool codegen::ExecutionEngine::add_module(std::unique_ptr<ngraph::codegen::Modul
             {
                 return false;
             }
+            m_execution_engine->setObjectCache(CodeCache::get().get_object_cache());
+        }
+        else
+        {
+            m_execution_engine->addModule(module->take_module());
         }
     }
     else
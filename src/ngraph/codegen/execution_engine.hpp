@@ -41,6 +41,8 @@ public:
     ExecutionEngine();
     ~ExecutionEngine();
 
+    /// \brief Adds a module to the engine. Modules added before finalize() are linked
+    ///        together, so they may call each other's functions.
     bool add_module(std::unique_ptr<ngraph::codegen::Module>& module);
     void finalize();
 
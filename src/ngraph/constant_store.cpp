@@ -0,0 +1,81 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <typeinfo>
+
+#include "ngraph/constant_store.hpp"
+#include "ngraph/op/constant.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+ConstantStore& ConstantStore::get()
+{
+    static ConstantStore s_store;
+    return s_store;
+}
+
+shared_ptr<op::Constant> ConstantStore::intern(const shared_ptr<op::Constant>& constant)
+{
+    // Subclasses such as ScalarConstantLike compute their data late
+    if (typeid(*constant) != typeid(op::Constant))
+    {
+        return constant;
+    }
+
+    size_t hash = constant->get_content_hash();
+    size_t size = shape_size(constant->get_shape()) * constant->get_element_type().size();
+    lock_guard<mutex> lock(m_mutex);
+    auto range = m_constants.equal_range(hash);
+    for (auto it = range.first; it != range.second;)
+    {
+        auto first = it->second.lock();
+        if (!first)
+        {
+            it = m_constants.erase(it);
+            continue;
+        }
+        if (first->get_data_ptr() == constant->get_data_ptr())
+        {
+            return constant;
+        }
+        if (first->get_element_type() == constant->get_element_type() &&
+            first->get_shape() == constant->get_shape() &&
+            memcmp(first->get_data_ptr(), constant->get_data_ptr(), size) == 0)
+        {
+            // The data stays alive with the first constant, which the new one co-owns
+            shared_ptr<void> owner(first, const_cast<void*>(first->get_data_ptr()));
+            return make_shared<op::Constant>(
+                first->get_element_type(), first->get_shape(), first->get_data_ptr(), owner);
+        }
+        ++it;
+    }
+    m_constants.emplace(hash, constant);
+
+    // Drop the constants freed since the last sweep, at a cost amortized over the insertions
+    if (m_constants.size() >= m_sweep_size)
+    {
+        for (auto it = m_constants.begin(); it != m_constants.end();)
+        {
+            it = it->second.expired() ? m_constants.erase(it) : next(it);
+        }
+        m_sweep_size = max<size_t>(1024, 2 * m_constants.size());
+    }
+    return constant;
+}
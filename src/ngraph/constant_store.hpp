@@ -0,0 +1,52 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace ngraph
+{
+    namespace op
+    {
+        class Constant;
+    }
+
+    /// \brief Process-wide store that deduplicates the data of constants by content.
+    ///
+    /// Interning a constant returns one that shares its data with the first live interned
+    /// constant of the same element type, shape and content, so identical weights of different
+    /// functions, e.g. specializations of one model, are held in memory once. Constants are
+    /// looked up by their content hash and only compared byte for byte on a hash match. The
+    /// store does not keep constants alive, shared data is freed with the last constant using it.
+    class ConstantStore
+    {
+    public:
+        static ConstantStore& get();
+
+        /// \brief Returns `constant` when it is the first of its content, otherwise a new
+        ///        constant sharing the data of the first one.
+        std::shared_ptr<op::Constant> intern(const std::shared_ptr<op::Constant>& constant);
+
+    private:
+        ConstantStore() {}
+        std::mutex m_mutex;
+        size_t m_sweep_size{1024};
+        std::unordered_multimap<size_t, std::weak_ptr<op::Constant>> m_constants;
+    };
+}
@@ -0,0 +1,146 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#ifdef _WIN32
+#include <fstream>
+#include <iterator>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "external_data.hpp"
+#include "ngraph/file_util.hpp"
+
+namespace ngraph
+{
+    namespace onnx_import
+    {
+#ifdef _WIN32
+        MappedFile::MappedFile(const std::string& path)
+            : m_path{path}
+        {
+            std::ifstream ifs{path, std::ios::in | std::ios::binary};
+            if (!ifs.is_open())
+            {
+                throw error::external_data::file_mapping{path};
+            }
+            m_buffer.assign(std::istreambuf_iterator<char>{ifs}, std::istreambuf_iterator<char>{});
+            m_data = m_buffer.data();
+            m_size = m_buffer.size();
+        }
+
+        MappedFile::~MappedFile() {}
+#else
+        MappedFile::MappedFile(const std::string& path)
+            : m_path{path}
+        {
+            int fd = open(path.c_str(), O_RDONLY);
+            if (fd < 0)
+            {
+                throw error::external_data::file_mapping{path};
+            }
+            struct stat st;
+            if (fstat(fd, &st) != 0)
+            {
+                close(fd);
+                throw error::external_data::file_mapping{path};
+            }
+            m_size = static_cast<std::size_t>(st.st_size);
+            if (m_size > 0)
+            {
+                void* addr = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+                if (addr == MAP_FAILED)
+                {
+                    close(fd);
+                    throw error::external_data::file_mapping{path};
+                }
+                m_data = static_cast<const char*>(addr);
+            }
+            // The mapping keeps its own reference to the file
+            close(fd);
+        }
+
+        MappedFile::~MappedFile()
+        {
+            if (m_data != nullptr)
+            {
+                munmap(const_cast<char*>(m_data), m_size);
+            }
+        }
+#endif
+
+        ExternalDataView ExternalDataStore::load(const onnx::TensorProto& tensor)
+        {
+            std::string location;
+            std::size_t offset{0};
+            std::size_t length{0};
+            bool has_length{false};
+            for (const auto& entry : tensor.external_data())
+            {
+                if (entry.key() == "location")
+                {
+                    location = entry.value();
+                }
+                else if (entry.key() == "offset")
+                {
+                    offset = std::stoull(entry.value());
+                }
+                else if (entry.key() == "length")
+                {
+                    length = std::stoull(entry.value());
+                    has_length = true;
+                }
+                // "checksum" is optional and not verified
+            }
+            if (location.empty())
+            {
+                throw error::external_data::missing_location{tensor.name()};
+            }
+
+            std::shared_ptr<MappedFile> file = get_file(location);
+            if (offset > file->size())
+            {
+                throw error::external_data::out_of_range{file->get_path()};
+            }
+            if (!has_length)
+            {
+                length = file->size() - offset;
+            }
+            if (length > file->size() - offset)
+            {
+                throw error::external_data::out_of_range{file->get_path()};
+            }
+            return {file->data() + offset, length, file};
+        }
+
+        std::shared_ptr<MappedFile> ExternalDataStore::get_file(const std::string& location)
+        {
+            std::string path =
+                m_model_dir.empty() ? location : file_util::path_join(m_model_dir, location);
+            auto it = m_files.find(path);
+            if (it == std::end(m_files))
+            {
+                it = m_files.emplace(path, std::make_shared<MappedFile>(path)).first;
+            }
+            return it->second;
+        }
+
+    } // namespace onnx_import
+
+} // namespace ngraph
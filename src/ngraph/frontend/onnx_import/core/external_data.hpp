@@ -0,0 +1,129 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <onnx-ml.pb.h>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ngraph/except.hpp"
+
+namespace ngraph
+{
+    namespace onnx_import
+    {
+        namespace error
+        {
+            namespace external_data
+            {
+                struct missing_location : ngraph_error
+                {
+                    explicit missing_location(const std::string& tensor_name)
+                        : ngraph_error{"external data location not specified for tensor: " +
+                                       tensor_name}
+                    {
+                    }
+                };
+
+                struct file_mapping : ngraph_error
+                {
+                    explicit file_mapping(const std::string& path)
+                        : ngraph_error{"failure mapping external data file: " + path}
+                    {
+                    }
+                };
+
+                struct out_of_range : ngraph_error
+                {
+                    explicit out_of_range(const std::string& path)
+                        : ngraph_error{"external data offset/length out of file bounds: " + path}
+                    {
+                    }
+                };
+
+            } // namespace external_data
+
+        } // namespace error
+
+        /// \brief Read-only view of a whole file mapped into memory.
+        ///
+        /// Pages are only brought in when touched, so weights that are never read (or are read
+        /// once while building a constant) do not add to the resident set of the importer.
+        class MappedFile
+        {
+        public:
+            explicit MappedFile(const std::string& path);
+            ~MappedFile();
+
+            MappedFile(const MappedFile&) = delete;
+            MappedFile& operator=(const MappedFile&) = delete;
+
+            const char* data() const { return m_data; }
+            std::size_t size() const { return m_size; }
+            const std::string& get_path() const { return m_path; }
+        private:
+            std::string m_path;
+            const char* m_data{nullptr};
+            std::size_t m_size{0};
+#ifdef _WIN32
+            std::vector<char> m_buffer;
+#endif
+        };
+
+        /// \brief A block of tensor data living in a mapped external data file. The file stays
+        ///        mapped for as long as any view of it (or any Constant built on it) is alive.
+        struct ExternalDataView
+        {
+            const char* data;
+            std::size_t size;
+            std::shared_ptr<MappedFile> file;
+        };
+
+        /// \brief Resolves the `external_data` entries (location, offset, length) of ONNX
+        ///        tensors whose `data_location` is EXTERNAL.
+        ///
+        /// Locations are relative to the directory of the model file. Each referenced file is
+        /// mapped once and shared between all tensors stored in it.
+        class ExternalDataStore
+        {
+        public:
+            explicit ExternalDataStore(const std::string& model_dir)
+                : m_model_dir{model_dir}
+            {
+            }
+
+            static bool is_external(const onnx::TensorProto& tensor)
+            {
+                return tensor.has_data_location() &&
+                       tensor.data_location() == onnx::TensorProto_DataLocation_EXTERNAL;
+            }
+
+            ExternalDataView load(const onnx::TensorProto& tensor);
+
+        private:
+            std::shared_ptr<MappedFile> get_file(const std::string& location);
+
+            std::string m_model_dir;
+            std::map<std::string, std::shared_ptr<MappedFile>> m_files;
+        };
+
+    } // namespace onnx_import
+
+} // namespace ngraph
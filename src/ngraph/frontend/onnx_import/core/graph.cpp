@@ -63,12 +63,15 @@ namespace ngraph
             : m_graph_proto{&graph_proto}
             , m_model{&model}
         {
+            // Initializers stored as external data share one mapping per referenced file
+            auto external_data = std::make_shared<ExternalDataStore>(m_model->get_model_dir());
+
             // Process all initializers in the graph
             for (const auto& initializer_tensor : m_graph_proto->initializer())
             {
                 if (initializer_tensor.has_name())
                 {
-                    Tensor tensor = Tensor{initializer_tensor};
+                    Tensor tensor = Tensor{initializer_tensor, external_data};
                     m_initializers.emplace(initializer_tensor.name(), tensor);
 
                     // For each initializer, create a Constant node and store in cache
@@ -31,7 +31,10 @@ namespace ngraph
         {
         public:
             Model() = delete;
-            explicit Model(const onnx::ModelProto& model_proto);
+            /// \param model_proto  The model protobuf representation object.
+            /// \param model_dir    Directory the model was loaded from; external tensor data
+            ///                     locations are resolved relative to it.
+            explicit Model(const onnx::ModelProto& model_proto, const std::string& model_dir = {});
 
             Model(const Model&) = default;
             Model(Model&&) = default;
@@ -42,6 +45,7 @@ namespace ngraph
             const std::string& get_producer_name() const { return m_model_proto->producer_name(); }
             const onnx::GraphProto& get_graph() const { return m_model_proto->graph(); }
             std::int64_t get_model_version() const { return m_model_proto->model_version(); }
+            const std::string& get_model_dir() const { return m_model_dir; }
             const std::string& get_producer_version() const
             {
                 return m_model_proto->producer_version();
@@ -72,6 +76,7 @@ namespace ngraph
 
         private:
             const onnx::ModelProto* m_model_proto;
+            std::string m_model_dir;
             std::unordered_map<std::string, OperatorSet> m_opset;
         };
 
@@ -17,9 +17,11 @@
 #pragma once
 
 #include <onnx-ml.pb.h>
+#include <memory>
 #include <utility>
 #include <vector>
 
+#include "external_data.hpp"
 #include "ngraph/op/constant.hpp"
 #include "ngraph/shape.hpp"
 #include "ngraph/type/element_type.hpp"
@@ -91,6 +93,16 @@ namespace ngraph
                     }
                 };
 
+                struct invalid_data_size : ngraph_error
+                {
+                    invalid_data_size(std::size_t expected, std::size_t actual)
+                        : ngraph_error{"tensor data size mismatch, expected " +
+                                       std::to_string(expected) + " bytes, got " +
+                                       std::to_string(actual)}
+                    {
+                    }
+                };
+
             } // namespace tensor
 
         } // namespace error
@@ -109,11 +121,17 @@ namespace ngraph
                             return {std::begin(container), std::end(container)};
                         }
 
+                        template <typename T>
+                        inline std::vector<T> __get_raw_data(const char* data, std::size_t size)
+                        {
+                            auto it = reinterpret_cast<const T*>(data);
+                            return {it, it + (size / sizeof(T))};
+                        }
+
                         template <typename T>
                         inline std::vector<T> __get_raw_data(const std::string& raw_data)
                         {
-                            auto it = reinterpret_cast<const T*>(raw_data.data());
-                            return {it, it + (raw_data.size() / sizeof(T))};
+                            return __get_raw_data<T>(raw_data.data(), raw_data.size());
                         }
                     }
                 }
@@ -125,59 +143,87 @@ namespace ngraph
                 }
 
                 template <>
-                inline std::vector<double> get_data(const onnx::TensorProto& tensor)
+                inline std::vector<float16> get_data(const onnx::TensorProto& tensor)
                 {
                     if (tensor.has_raw_data())
                     {
-                        return detail::__get_raw_data<double>(tensor.raw_data());
+                        return detail::__get_raw_data<float16>(tensor.raw_data());
                     }
-                    if (tensor.data_type() == onnx::TensorProto_DataType_DOUBLE)
+                    if (tensor.data_type() != onnx::TensorProto_DataType_FLOAT16)
                     {
-                        return detail::__get_data<double>(tensor.double_data());
+                        throw error::tensor::invalid_data_type{tensor.data_type()};
                     }
-                    if ((tensor.data_type() == onnx::TensorProto_DataType_FLOAT) or
-                        (tensor.data_type() == onnx::TensorProto_DataType_FLOAT16))
+                    // The bit patterns of the values, one per int32
+                    std::vector<float16> data;
+                    data.reserve(tensor.int32_data_size());
+                    for (int32_t bits : tensor.int32_data())
                     {
-                        return detail::__get_data<double>(tensor.float_data());
+                        data.push_back(float16::from_bits(static_cast<uint16_t>(bits)));
+                    }
+                    return data;
+                }
+
+                template <>
+                inline std::vector<float> get_data(const onnx::TensorProto& tensor)
+                {
+                    if (tensor.data_type() == onnx::TensorProto_DataType_FLOAT16)
+                    {
+                        return float16::to_float_vector(get_data<float16>(tensor));
+                    }
+                    if (tensor.has_raw_data())
+                    {
+                        return detail::__get_raw_data<float>(tensor.raw_data());
+                    }
+                    if (tensor.data_type() == onnx::TensorProto_DataType_FLOAT)
+                    {
+                        return detail::__get_data<float>(tensor.float_data());
                     }
                     if (tensor.data_type() == onnx::TensorProto_DataType_INT32)
                     {
-                        return detail::__get_data<double>(tensor.int32_data());
+                        return detail::__get_data<float>(tensor.int32_data());
                     }
                     if (tensor.data_type() == onnx::TensorProto_DataType_INT64)
                     {
-                        return detail::__get_data<double>(tensor.int64_data());
+                        return detail::__get_data<float>(tensor.int64_data());
                     }
                     if (tensor.data_type() == onnx::TensorProto_DataType_UINT64)
                     {
-                        return detail::__get_data<double>(tensor.uint64_data());
+                        return detail::__get_data<float>(tensor.uint64_data());
                     }
                     throw error::tensor::invalid_data_type{tensor.data_type()};
                 }
 
                 template <>
-                inline std::vector<float> get_data(const onnx::TensorProto& tensor)
+                inline std::vector<double> get_data(const onnx::TensorProto& tensor)
                 {
+                    if (tensor.data_type() == onnx::TensorProto_DataType_FLOAT16)
+                    {
+                        std::vector<float> data = get_data<float>(tensor);
+                        return {std::begin(data), std::end(data)};
+                    }
                     if (tensor.has_raw_data())
                     {
-                        return detail::__get_raw_data<float>(tensor.raw_data());
+                        return detail::__get_raw_data<double>(tensor.raw_data());
                     }
-                    if ((tensor.data_type() == onnx::TensorProto_DataType_FLOAT) or
-                        (tensor.data_type() == onnx::TensorProto_DataType_FLOAT16))
+                    if (tensor.data_type() == onnx::TensorProto_DataType_DOUBLE)
                     {
-                        return detail::__get_data<float>(tensor.float_data());
+                        return detail::__get_data<double>(tensor.double_data());
+                    }
+                    if (tensor.data_type() == onnx::TensorProto_DataType_FLOAT)
+                    {
+                        return detail::__get_data<double>(tensor.float_data());
                     }
                     if (tensor.data_type() == onnx::TensorProto_DataType_INT32)
                     {
-                        return detail::__get_data<float>(tensor.int32_data());
+                        return detail::__get_data<double>(tensor.int32_data());
                     }
                     if (tensor.data_type() == onnx::TensorProto_DataType_INT64)
                     {
-                        return detail::__get_data<float>(tensor.int64_data());
+                        return detail::__get_data<double>(tensor.int64_data());
                     }
                     if (tensor.data_type() == onnx::TensorProto_DataType_UINT64)
                     {
-                        return detail::__get_data<float>(tensor.uint64_data());
+                        return detail::__get_data<double>(tensor.uint64_data());
                     }
                     throw error::tensor::invalid_data_type{tensor.data_type()};
                 }
@@ -320,9 +366,15 @@ namespace ngraph
             };
 
             Tensor() = delete;
-            explicit Tensor(const onnx::TensorProto& tensor)
+            /// \param tensor         The tensor protobuf representation object.
+            /// \param external_data  Resolves tensor data stored outside of the model. If null,
+            ///                       external locations are taken relative to the working
+            ///                       directory.
+            explicit Tensor(const onnx::TensorProto& tensor,
+                            const std::shared_ptr<ExternalDataStore>& external_data = nullptr)
                 : m_tensor_proto{&tensor}
                 , m_shape{std::begin(tensor.dims()), std::end(tensor.dims())}
+                , m_external_data{external_data}
             {
             }
 
@@ -340,6 +392,11 @@ namespace ngraph
                 {
                     throw error::tensor::segments_unsupported{};
                 }
+                if (ExternalDataStore::is_external(*m_tensor_proto))
+                {
+                    ExternalDataView view = load_external_data();
+                    return detail::tensor::detail::__get_raw_data<T>(view.data, view.size);
+                }
                 return detail::tensor::get_data<T>(*m_tensor_proto);
             }
 
@@ -370,8 +427,8 @@ namespace ngraph
                 switch (m_tensor_proto->data_type())
                 {
                 case onnx::TensorProto_DataType::TensorProto_DataType_BOOL: return element::boolean;
-                case onnx::TensorProto_DataType::TensorProto_DataType_FLOAT:
-                case onnx::TensorProto_DataType::TensorProto_DataType_FLOAT16: return element::f32;
+                case onnx::TensorProto_DataType::TensorProto_DataType_FLOAT: return element::f32;
+                case onnx::TensorProto_DataType::TensorProto_DataType_FLOAT16: return element::f16;
                 case onnx::TensorProto_DataType::TensorProto_DataType_DOUBLE: return element::f64;
                 case onnx::TensorProto_DataType::TensorProto_DataType_INT8: return element::i8;
                 case onnx::TensorProto_DataType::TensorProto_DataType_INT16: return element::i16;
@@ -390,12 +447,27 @@ namespace ngraph
             operator TensorProto_DataType() const { return m_tensor_proto->data_type(); }
             std::shared_ptr<ngraph::op::Constant> get_ng_constant() const
             {
+                if (m_tensor_proto->has_segment())
+                {
+                    throw error::tensor::segments_unsupported{};
+                }
+                // Data stored as raw bytes already has the in-memory layout of the nGraph
+                // element type
+                if (ExternalDataStore::is_external(*m_tensor_proto))
+                {
+                    return make_ng_constant_from_external_data();
+                }
+                if (m_tensor_proto->has_raw_data())
+                {
+                    return make_ng_constant_from_raw_data();
+                }
                 switch (m_tensor_proto->data_type())
                 {
                 case onnx::TensorProto_DataType::TensorProto_DataType_BOOL:
                     return make_ng_constant<bool>(element::boolean);
-                case onnx::TensorProto_DataType::TensorProto_DataType_FLOAT:
                 case onnx::TensorProto_DataType::TensorProto_DataType_FLOAT16:
+                    return make_ng_constant<float16>(element::f16);
+                case onnx::TensorProto_DataType::TensorProto_DataType_FLOAT:
                     return make_ng_constant<float>(element::f32);
                 case onnx::TensorProto_DataType::TensorProto_DataType_DOUBLE:
                     return make_ng_constant<double>(element::f64);
@@ -426,8 +498,49 @@ namespace ngraph
                 return std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
             }
 
+            std::size_t get_byte_size() const { return shape_size(m_shape) * get_ng_type().size(); }
+            /// \brief Builds the constant with a single copy out of the protobuf raw_data.
+            std::shared_ptr<ngraph::op::Constant> make_ng_constant_from_raw_data() const
+            {
+                const std::string& raw_data = m_tensor_proto->raw_data();
+                if (raw_data.size() != get_byte_size())
+                {
+                    throw error::tensor::invalid_data_size{get_byte_size(), raw_data.size()};
+                }
+                return std::make_shared<ngraph::op::Constant>(
+                    get_ng_type(), m_shape, raw_data.data());
+            }
+
+            /// \brief Builds the constant directly on top of the mapped external data file
+            ///        when the data is suitably aligned, otherwise with a single copy.
+            std::shared_ptr<ngraph::op::Constant> make_ng_constant_from_external_data() const
+            {
+                ExternalDataView view = load_external_data();
+                if (view.size != get_byte_size())
+                {
+                    throw error::tensor::invalid_data_size{get_byte_size(), view.size};
+                }
+                const element::Type& type = get_ng_type();
+                if (reinterpret_cast<uintptr_t>(view.data) % type.size() == 0)
+                {
+                    return std::make_shared<ngraph::op::Constant>(
+                        type, m_shape, view.data, view.file);
+                }
+                return std::make_shared<ngraph::op::Constant>(type, m_shape, view.data);
+            }
+
+            ExternalDataView load_external_data() const
+            {
+                if (m_external_data)
+                {
+                    return m_external_data->load(*m_tensor_proto);
+                }
+                return ExternalDataStore{""}.load(*m_tensor_proto);
+            }
+
             const onnx::TensorProto* m_tensor_proto;
             Shape m_shape;
+            std::shared_ptr<ExternalDataStore> m_external_data;
         };
 
         inline std::ostream& operator<<(std::ostream& outs, const Tensor& tensor)
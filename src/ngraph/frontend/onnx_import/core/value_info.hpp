@@ -86,8 +86,8 @@ namespace ngraph
                 switch (m_value_info_proto->type().tensor_type().elem_type())
                 {
                 case onnx::TensorProto_DataType::TensorProto_DataType_BOOL: return element::boolean;
-                case onnx::TensorProto_DataType::TensorProto_DataType_FLOAT:
-                case onnx::TensorProto_DataType::TensorProto_DataType_FLOAT16: return element::f32;
+                case onnx::TensorProto_DataType::TensorProto_DataType_FLOAT: return element::f32;
+                case onnx::TensorProto_DataType::TensorProto_DataType_FLOAT16: return element::f16;
                 case onnx::TensorProto_DataType::TensorProto_DataType_DOUBLE: return element::f64;
                 case onnx::TensorProto_DataType::TensorProto_DataType_INT8: return element::i8;
                 case onnx::TensorProto_DataType::TensorProto_DataType_INT16: return element::i16;
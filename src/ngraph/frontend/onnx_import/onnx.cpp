@@ -23,6 +23,7 @@
 #include "core/model.hpp"
 #include "core/node.hpp"
 #include "ngraph/except.hpp"
+#include "ngraph/file_util.hpp"
 #include "onnx.hpp"
 #include "ops_bridge.hpp"
 
@@ -51,9 +52,20 @@ namespace ngraph
                 };
 
             } // namespace error
-        }     // namespace detail
+
+            std::shared_ptr<Function> import_onnx_model(std::istream& sin,
+                                                        const std::string& model_dir,
+                                                        const Weights& weights);
+        } // namespace detail
 
         std::shared_ptr<Function> import_onnx_model(std::istream& sin, const Weights& weights)
+        {
+            return detail::import_onnx_model(sin, "", weights);
+        }
+
+        std::shared_ptr<Function> detail::import_onnx_model(std::istream& sin,
+                                                            const std::string& model_dir,
+                                                            const Weights& weights)
         {
             onnx::ModelProto model_proto;
             // Try parsing input as a binary protobuf message
@@ -70,7 +82,7 @@ namespace ngraph
                 }
             }
 
-            Model model{model_proto};
+            Model model{model_proto, model_dir};
             Graph graph{model_proto.graph(), model, weights};
             auto function = std::make_shared<Function>(
                 graph.get_ng_outputs(), graph.get_ng_parameters(), graph.get_name());
@@ -88,7 +100,10 @@ namespace ngraph
             {
                 throw detail::error::file_open{path};
             }
-            return import_onnx_model(ifs, weights);
+            // External tensor data locations are relative to the model file
+            std::string model_dir =
+                path.find_last_of('/') == std::string::npos ? "" : file_util::get_directory(path);
+            return detail::import_onnx_model(ifs, model_dir, weights);
         }
 
         void register_operator(const std::string& name,
@@ -72,6 +72,8 @@ namespace ngraph
         ///                   the model this parameter shall be empty. Having weights in a model
         ///                   and providing through this parameters is invalid (the weights from
         ///                   the model  will take precedence).
+        /// \note Tensors stored as external data are looked up relative to the current working
+        ///       directory; use the file path overload to resolve them next to the model.
         /// \return The function returns a nGraph function representing single output from graph.
         std::shared_ptr<Function> import_onnx_model(std::istream& sin, const Weights& weights = {});
 
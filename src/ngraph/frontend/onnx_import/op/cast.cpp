@@ -40,7 +40,7 @@ namespace ngraph
                     {
                     case onnx::TensorProto_DataType_BOOL: elem_type = element::boolean; break;
                     case onnx::TensorProto_DataType_DOUBLE: elem_type = element::f64; break;
-                    case onnx::TensorProto_DataType_FLOAT16:
+                    case onnx::TensorProto_DataType_FLOAT16: elem_type = element::f16; break;
                     case onnx::TensorProto_DataType_FLOAT: elem_type = element::f32; break;
                     case onnx::TensorProto_DataType_INT8: elem_type = element::i8; break;
                     case onnx::TensorProto_DataType_INT16: elem_type = element::i16; break;
@@ -48,7 +48,7 @@ namespace ngraph
                     inline std::shared_ptr<ngraph::op::Constant>
                         make_ng_constant<Tensor::Type::float16>(const Tensor& tensor)
                     {
-                        return __make_ng_constant<float>(element::f32, tensor);
+                        return __make_ng_constant<float16>(element::f16, tensor);
                     }
 
                     template <>
@@ -17,6 +17,7 @@
 #include <algorithm>
 #include <list>
 #include <memory>
+#include <mutex>
 
 #include "ngraph/function.hpp"
 #include "ngraph/graph_util.hpp"
@@ -99,9 +100,88 @@ void Function::init()
                    true /*include control dependencies*/);
 }
 
+// Guards the ordered-op caches of all functions and the back references their ops keep in
+// Node::m_ordered_in
+static mutex s_ordered_ops_mutex;
+
+using OrderedOpsList = std::shared_ptr<const std::list<shared_ptr<Node>>>;
+
+Function::~Function()
+{
+    vector<OrderedOpsList> released;
+    lock_guard<mutex> lock(s_ordered_ops_mutex);
+    drop_ordered_ops(released);
+}
+
+void Function::drop_ordered_ops(vector<OrderedOpsList>& released) const
+{
+    for (OrderedOpsCache& cache : m_ordered_ops_cache)
+    {
+        for (Node* node : cache.m_raw_ops)
+        {
+            auto& ordered_in = node->m_ordered_in;
+            ordered_in.erase(remove(ordered_in.begin(), ordered_in.end(), this), ordered_in.end());
+        }
+        vector<Node*>().swap(cache.m_raw_ops);
+        if (cache.m_ops)
+        {
+            released.push_back(move(cache.m_ops));
+            cache.m_ops.reset();
+        }
+    }
+}
+
+void Function::invalidate_ordered_ops(const Node* node)
+{
+    // Declared before the lock so the ops the caches held are released after unlocking; a
+    // released op may own a function whose destructor takes the lock as well
+    vector<OrderedOpsList> released;
+    lock_guard<mutex> lock(s_ordered_ops_mutex);
+    vector<const Function*> functions = node->m_ordered_in;
+    for (const Function* function : functions)
+    {
+        function->drop_ordered_ops(released);
+    }
+}
+
+const Function::OrderedOpsCache& Function::get_cached_ordered_ops(bool include_control_deps) const
+{
+    OrderedOpsCache& cache = m_ordered_ops_cache[include_control_deps ? 1 : 0];
+    if (!cache.m_ops)
+    {
+        auto sorted = make_shared<const std::list<shared_ptr<Node>>>(
+            topological_sort(get_ops(include_control_deps), include_control_deps));
+        cache.m_raw_ops.reserve(sorted->size());
+        for (const shared_ptr<Node>& node : *sorted)
+        {
+            cache.m_raw_ops.push_back(node.get());
+            auto& ordered_in = node->m_ordered_in;
+            if (find(ordered_in.begin(), ordered_in.end(), this) == ordered_in.end())
+            {
+                ordered_in.push_back(this);
+            }
+        }
+        cache.m_ops = sorted;
+    }
+    return cache;
+}
+
 std::list<shared_ptr<Node>> Function::get_ordered_ops(bool include_control_deps) const
 {
-    return topological_sort(get_ops(include_control_deps), include_control_deps);
+    return *get_ordered_ops_shared(include_control_deps);
+}
+
+std::vector<Node*> Function::get_ordered_ops_raw(bool include_control_deps) const
+{
+    lock_guard<mutex> lock(s_ordered_ops_mutex);
+    return get_cached_ordered_ops(include_control_deps).m_raw_ops;
+}
+
+std::shared_ptr<const std::list<shared_ptr<Node>>>
+    Function::get_ordered_ops_shared(bool include_control_deps) const
+{
+    lock_guard<mutex> lock(s_ordered_ops_mutex);
+    return get_cached_ordered_ops(include_control_deps).m_ops;
 }
 
 const std::string& Function::get_friendly_name() const
@@ -47,7 +47,7 @@ namespace ngraph
 
         void init();
 
-        virtual ~Function() {}
+        virtual ~Function();
     public:
         /// Return the number of outputs for this function.
         size_t get_output_size() const;
@@ -87,7 +87,24 @@ namespace ngraph
         const std::string& get_friendly_name() const;
 
         std::list<std::shared_ptr<Node>> get_ops(bool include_control_deps = true) const;
+        /// \brief Topologically ordered ops, copied from the cached order. Prefer
+        ///        get_ordered_ops_shared() where the list is only iterated.
         std::list<std::shared_ptr<Node>> get_ordered_ops(bool include_control_deps = true) const;
+        /// \brief Topologically ordered ops as raw pointers.
+        ///
+        /// The order is computed once and cached on the function. Rewiring an input or a
+        /// control dependency of one of its ops drops the cache right away, and the next query
+        /// sorts again; rewiring other functions leaves it alone. The pointers are owned by the
+        /// function and stay valid until the graph is modified.
+        std::vector<Node*> get_ordered_ops_raw(bool include_control_deps = true) const;
+        /// \brief The cached topological order itself, shared rather than copied.
+        ///
+        /// The list is never modified: once the graph is rewired the next call returns a new
+        /// one, and the list held by the caller stays valid for as long as it is held. Keep
+        /// the pointer in a local while iterating; ranging over the dereferenced temporary
+        /// would leave a dangling reference.
+        std::shared_ptr<const std::list<std::shared_ptr<Node>>>
+            get_ordered_ops_shared(bool include_control_deps = true) const;
         friend std::ostream& operator<<(std::ostream&, const Function&);
         size_t get_instance_id() { return m_instance_id; }
         size_t get_temporary_pool_size();
@@ -120,5 +137,21 @@ namespace ngraph
         std::string m_name;
         const std::string m_unique_name;
         size_t m_placement{0};
+
+        struct OrderedOpsCache
+        {
+            std::shared_ptr<const std::list<std::shared_ptr<Node>>> m_ops;
+            std::vector<Node*> m_raw_ops;
+        };
+        friend class Node;
+        friend class descriptor::Input;
+        // Drops the cached order of every function containing `node`; called when an input or
+        // a control dependency of `node` changes
+        static void invalidate_ordered_ops(const Node* node);
+        const OrderedOpsCache& get_cached_ordered_ops(bool include_control_deps) const;
+        void drop_ordered_ops(
+            std::vector<std::shared_ptr<const std::list<std::shared_ptr<Node>>>>& released) const;
+        // Indexed by include_control_deps
+        mutable OrderedOpsCache m_ordered_ops_cache[2];
     };
 }
@@ -21,6 +21,7 @@
 
 #include "ngraph/autodiff/adjoints.hpp"
 #include "ngraph/descriptor/layout/tensor_layout.hpp"
+#include "ngraph/function.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/node.hpp"
 #include "ngraph/op/parameter.hpp"
@@ -203,6 +204,13 @@ const std::set<std::shared_ptr<Node>>& Node::get_control_dependencies() const
 void Node::add_control_dependency(std::shared_ptr<Node> node)
 {
     m_control_dependencies.insert(node);
+    Function::invalidate_ordered_ops(this);
+}
+
+void Node::remove_control_dependency(std::shared_ptr<Node> node)
+{
+    m_control_dependencies.erase(node);
+    Function::invalidate_ordered_ops(this);
 }
 
 std::vector<std::shared_ptr<Function>> Node::get_functions() const
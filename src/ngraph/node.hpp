@@ -78,6 +78,7 @@ namespace ngraph
         // So Adjoints can call generate_adjoints
         friend class autodiff::Adjoints;
         friend class descriptor::Input;
+        friend class Function;
         friend void replace_node_users_arguments(std::shared_ptr<Node> target,
                                                  std::shared_ptr<Node> replacement);
         friend std::pair<std::shared_ptr<op::Result>, std::shared_ptr<op::Parameter>>
@@ -169,10 +170,7 @@ namespace ngraph
 
         void add_control_dependency(std::shared_ptr<Node> node);
 
-        void remove_control_dependency(std::shared_ptr<Node> node)
-        {
-            m_control_dependencies.erase(node);
-        }
+        void remove_control_dependency(std::shared_ptr<Node> node);
 
         /// Returns the number of outputs on the for the node.
         size_t get_output_size() const;
@@ -268,6 +266,9 @@ namespace ngraph
         std::string m_friendly_name;
         const std::string m_unique_name;
         static std::atomic<size_t> m_next_instance_id;
+        // Functions whose cached topological order contains this node, see
+        // Function::get_ordered_ops_shared()
+        std::vector<const Function*> m_ordered_in;
         std::deque<descriptor::Input> m_inputs;
         std::deque<descriptor::Output> m_outputs;
         std::unordered_map<Node*, autodiff::Adjoints> m_adjoint_map;
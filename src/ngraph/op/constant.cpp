@@ -54,7 +54,7 @@ string to_cpp_string(T value)
 
 op::Constant::~Constant()
 {
-    if (m_data)
+    if (m_data && !m_data_owner)
     {
         aligned_free(m_data);
     }
@@ -80,6 +80,13 @@ vector<string> op::Constant::get_value_strings() const
             rc.push_back(to_cpp_string(temp));
         }
     }
+    else if (m_element_type == element::f16)
+    {
+        for (float16 value : get_vector<float16>())
+        {
+            rc.push_back(to_cpp_string(static_cast<float>(value)));
+        }
+    }
     else if (m_element_type == element::f32)
     {
         for (float value : get_vector<float>())
@@ -158,9 +165,24 @@ vector<string> op::Constant::get_value_strings() const
     return rc;
 }
 
+size_t op::Constant::get_content_hash() const
+{
+    call_once(m_content_hash_once, [this]() {
+        size_t size = shape_size(m_shape) * m_element_type.size();
+        vector<size_t> values{m_element_type.hash(), hash_bytes(m_data, size)};
+        values.insert(values.end(), m_shape.begin(), m_shape.end());
+        m_content_hash = hash_combine(values);
+    });
+    return m_content_hash;
+}
+
 shared_ptr<Node> op::Constant::copy_with_new_args(const NodeVector& new_args) const
 {
     check_new_args_count(this, new_args);
+    if (m_data_owner)
+    {
+        return make_shared<Constant>(m_element_type, m_shape, m_data, m_data_owner);
+    }
     return make_shared<Constant>(m_element_type, m_shape, m_data);
 }
 
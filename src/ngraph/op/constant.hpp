@@ -16,12 +16,16 @@
 
 #pragma once
 
+#include <cstdint>
 #include <cstring>
+#include <memory>
+#include <mutex>
 #include <sstream>
 
 #include "ngraph/log.hpp"
 #include "ngraph/node.hpp"
 #include "ngraph/type/bfloat16.hpp"
+#include "ngraph/type/float16.hpp"
 #include "ngraph/type/element_type.hpp"
 #include "ngraph/util.hpp"
 
@@ -117,6 +121,34 @@ namespace ngraph
                 constructor_validate_and_infer_types();
             }
 
+            /// \brief Constructs a tensor constant that refers to externally owned data without
+            ///        copying it.
+            ///
+            /// \param type The element type of the tensor constant.
+            /// \param shape The shape of the tensor constant.
+            /// \param data A pointer to the constant data. It must be aligned to the element size
+            ///        and stay valid for as long as data_owner is alive.
+            /// \param data_owner Keeps the memory behind data alive; shared with any copies.
+            Constant(const element::Type& type,
+                     const Shape& shape,
+                     const void* data,
+                     const std::shared_ptr<void>& data_owner)
+                : Node("Constant", {})
+                , m_element_type(type)
+                , m_shape(shape)
+                , m_data(const_cast<void*>(data))
+                , m_data_owner(data_owner)
+            {
+                NODE_VALIDATION_CHECK(this,
+                                      data_owner != nullptr,
+                                      "Externally owned constant data requires an owner");
+                NODE_VALIDATION_CHECK(
+                    this,
+                    reinterpret_cast<uintptr_t>(data) % m_element_type.size() == 0,
+                    "Externally owned constant data is not aligned to the element size");
+                constructor_validate_and_infer_types();
+            }
+
             virtual ~Constant() override;
 
             void validate_and_infer_types() override
@@ -183,6 +215,10 @@ namespace ngraph
                 return reinterpret_cast<T*>(m_data);
             }
 
+            /// \brief Digest of the element type, shape and data of the constant, computed on
+            ///        first use. Equal constants have equal digests.
+            size_t get_content_hash() const;
+
             bool is_constant() const override { return true; }
         protected:
             Constant(const std::string& name, const NodeVector& args)
@@ -227,6 +263,10 @@ namespace ngraph
                 {
                     write_buffer<bfloat16, T>(target, source, target_element_count);
                 }
+                else if (target_type == element::f16)
+                {
+                    write_buffer<float16, T>(target, source, target_element_count);
+                }
                 else if (target_type == element::f32)
                 {
                     write_buffer<float, T>(target, source, target_element_count);
@@ -276,6 +316,10 @@ namespace ngraph
             element::Type m_element_type;
             Shape m_shape{};
             void* m_data{nullptr};
+            // Set when m_data is not allocated by this constant (e.g. mmapped weights)
+            std::shared_ptr<void> m_data_owner;
+            mutable std::once_flag m_content_hash_once;
+            mutable size_t m_content_hash{0};
             Constant(const Constant&) = delete;
             Constant operator=(const Constant&) = delete;
         };
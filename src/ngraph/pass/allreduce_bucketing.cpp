@@ -0,0 +1,117 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <map>
+#include <unordered_set>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/op/allreduce.hpp"
+#include "ngraph/op/concat.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/op/slice.hpp"
+#include "ngraph/pass/allreduce_bucketing.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    struct Bucket
+    {
+        vector<shared_ptr<Node>> allreduces;
+        size_t size = 0;
+        // Nodes that depend on the AllReduces of the bucket
+        unordered_set<Node*> dependents;
+    };
+
+    // Replaces the AllReduces of `bucket` by a single AllReduce of their flattened arguments
+    bool fuse(Bucket& bucket)
+    {
+        if (bucket.allreduces.size() < 2)
+        {
+            return false;
+        }
+
+        NodeVector flat_args;
+        for (auto& allreduce : bucket.allreduces)
+        {
+            auto arg = allreduce->get_argument(0);
+            flat_args.push_back(make_shared<op::Reshape>(
+                arg, get_default_order(arg->get_shape()), Shape{shape_size(arg->get_shape())}));
+        }
+        auto fused = make_shared<op::AllReduce>(make_shared<op::Concat>(flat_args, 0));
+
+        size_t offset = 0;
+        for (auto& allreduce : bucket.allreduces)
+        {
+            Shape shape = allreduce->get_shape();
+            size_t count = shape_size(shape);
+            auto slice =
+                make_shared<op::Slice>(fused, Coordinate{offset}, Coordinate{offset + count});
+            replace_node(allreduce, make_shared<op::Reshape>(slice, AxisVector{0}, shape));
+            offset += count;
+        }
+        return true;
+    }
+}
+
+bool pass::AllReduceBucketing::run_on_function(shared_ptr<Function> function)
+{
+    bool replaced = false;
+    map<element::Type, Bucket> buckets;
+    for (auto& node : function->get_ordered_ops())
+    {
+        for (auto& entry : buckets)
+        {
+            Bucket& bucket = entry.second;
+            for (auto& arg : node->get_arguments())
+            {
+                if (bucket.dependents.count(arg.get()) != 0)
+                {
+                    bucket.dependents.insert(node.get());
+                    break;
+                }
+            }
+        }
+
+        if (!dynamic_pointer_cast<op::AllReduce>(node))
+        {
+            continue;
+        }
+        const element::Type& type = node->get_element_type();
+        size_t size = shape_size(node->get_shape()) * type.size();
+        if (size == 0 || size >= m_bucket_size)
+        {
+            continue;
+        }
+
+        Bucket& bucket = buckets[type];
+        if (bucket.dependents.count(node.get()) != 0 || bucket.size + size > m_bucket_size)
+        {
+            replaced |= fuse(bucket);
+            bucket = Bucket();
+        }
+        bucket.allreduces.push_back(node);
+        bucket.dependents.insert(node.get());
+        bucket.size += size;
+    }
+    for (auto& entry : buckets)
+    {
+        replaced |= fuse(entry.second);
+    }
+    return replaced;
+}
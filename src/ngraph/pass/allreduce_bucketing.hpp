@@ -0,0 +1,49 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        /// \brief Fuses the AllReduces of small tensors into size-bounded buckets.
+        ///
+        /// AllReduces are collected in topological order, so a bucket holds gradients that
+        /// become ready close together. Each bucket is replaced by one AllReduce of the
+        /// concatenated, flattened arguments, sliced back into the original results. An
+        /// AllReduce whose argument depends on the current bucket starts a new one.
+        class AllReduceBucketing : public FunctionPass
+        {
+        public:
+            /// \param bucket_size Largest size in bytes of a fused AllReduce. Only tensors
+            ///        smaller than this are fused.
+            AllReduceBucketing(size_t bucket_size = 16 * 1024 * 1024)
+                : m_bucket_size(bucket_size)
+            {
+            }
+
+            bool run_on_function(std::shared_ptr<ngraph::Function> function) override;
+
+        private:
+            size_t m_bucket_size;
+        };
+    }
+}
@@ -0,0 +1,109 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <cmath>
+
+#include "ngraph/builder/quantization.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/convolution.hpp"
+#include "ngraph/pass/calibrated_quantization.hpp"
+#include "ngraph/pass/constant_folding.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static shared_ptr<Node> make_scalar(float value)
+{
+    return op::Constant::create(element::f32, Shape{}, {value});
+}
+
+bool pass::CalibratedQuantization::run_on_function(shared_ptr<Function> f)
+{
+    bool modified = false;
+    for (auto& node : f->get_ordered_ops())
+    {
+        auto conv = dynamic_pointer_cast<op::Convolution>(node);
+        if (!conv || conv->get_element_type() != element::f32)
+        {
+            continue;
+        }
+        auto data = conv->get_argument(0);
+        auto filters = dynamic_pointer_cast<op::Constant>(conv->get_argument(1));
+        auto data_range = m_table.find(data->get_name());
+        auto output_range = m_table.find(conv->get_name());
+        if (!filters || data_range == m_table.end() || output_range == m_table.end())
+        {
+            NGRAPH_DEBUG << "CalibratedQuantization: skipping " << conv->get_name()
+                         << ", no constant filters or calibrated range";
+            continue;
+        }
+        if (data_range->second.min < 0)
+        {
+            NGRAPH_DEBUG << "CalibratedQuantization: skipping " << conv->get_name()
+                         << ", data range is signed";
+            continue;
+        }
+
+        float filter_max = 0;
+        for (float v : filters->get_vector<float>())
+        {
+            filter_max = max(filter_max, fabs(v));
+        }
+        float data_max = data_range->second.max;
+        float output_max = max(fabs(output_range->second.min), fabs(output_range->second.max));
+        if (filter_max == 0 || data_max == 0 || output_max == 0)
+        {
+            continue;
+        }
+
+        auto q_data = builder::ScaledQuantize(
+            data, make_scalar(0), make_scalar(data_max), element::u8, AxisSet{}, m_round_mode);
+        auto q_filters = builder::ScaledQuantize(filters,
+                                                 make_scalar(-filter_max),
+                                                 make_scalar(filter_max),
+                                                 element::i8,
+                                                 AxisSet{},
+                                                 m_round_mode);
+        auto qconv = builder::ScaledQuantizedConvolution(q_data,
+                                                         q_filters,
+                                                         conv->get_window_movement_strides(),
+                                                         conv->get_window_dilation_strides(),
+                                                         conv->get_padding_below(),
+                                                         conv->get_padding_above(),
+                                                         conv->get_data_dilation_strides(),
+                                                         make_scalar(0),
+                                                         make_scalar(data_max),
+                                                         make_scalar(-filter_max),
+                                                         make_scalar(filter_max),
+                                                         make_scalar(-output_max),
+                                                         make_scalar(output_max));
+        auto dq = builder::ScaledDequantize(
+            qconv, make_scalar(-output_max), make_scalar(output_max), element::f32, AxisSet{});
+        replace_node(conv, dq);
+        NGRAPH_DEBUG << "CalibratedQuantization: quantized " << conv->get_name();
+        modified = true;
+    }
+
+    if (modified)
+    {
+        // Quantize the filters and compute the scales once, at compile time
+        pass::ConstantFolding().run_on_function(f);
+    }
+    return modified;
+}
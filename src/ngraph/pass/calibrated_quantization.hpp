@@ -0,0 +1,57 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/op/quantize.hpp"
+#include "ngraph/pass/pass.hpp"
+#include "ngraph/runtime/calibrator.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        class CalibratedQuantization;
+    }
+}
+
+/// \brief Rewrites f32 convolutions into int8 ones using ranges from runtime::Calibrator.
+///
+/// Every Convolution whose filters are constant and whose data input and output have a
+/// calibrated range becomes
+///     Quantize(data, u8) -> QuantizedConvolution(i8 filters) -> Dequantize(f32)
+/// with scales derived from the calibrated ranges (filters use their own symmetric range).
+/// Only non-negative data (e.g. post-Relu activations) is quantized, as the int8 convolution
+/// kernels take unsigned data. Back-to-back Dequantize/Quantize pairs and the trailing Relu,
+/// pooling and concat ops are then folded into int8 kernels by CPUQuantFusion.
+class ngraph::pass::CalibratedQuantization : public FunctionPass
+{
+public:
+    CalibratedQuantization(const runtime::CalibrationTable& table,
+                           op::Quantize::RoundMode round_mode =
+                               op::Quantize::RoundMode::ROUND_NEAREST_TOWARD_EVEN)
+        : FunctionPass()
+        , m_table(table)
+        , m_round_mode(round_mode)
+    {
+    }
+
+    bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+
+private:
+    runtime::CalibrationTable m_table;
+    op::Quantize::RoundMode m_round_mode;
+};
@@ -15,18 +15,42 @@
 //*****************************************************************************
 
 #include <sstream>
+#include <unordered_set>
 
 #include "common_function_collection.hpp"
 
 using namespace std;
 using namespace ngraph;
 
+// All of the functions are created with the same name `__f__` so here we rename them to
+// something unique so we can compile everything when done.
+static string rename_function(const string& function, const string& name, const string& new_name)
+{
+    string renamed = function;
+    renamed.replace(renamed.find(name), name.size(), new_name);
+    return renamed;
+}
+
 pass::CommonFunctionCollection::CommonFunctionCollection(function<string(Node&, string)> emitter,
                                                          unordered_map<Node*, Node*>& result_map,
                                                          string& emitted_functions)
     : m_emit_op_as_function(emitter)
-    , m_node_function_map(result_map)
-    , m_emitted_functions(emitted_functions)
+    , m_node_function_map(&result_map)
+    , m_emitted_functions(&emitted_functions)
+    , m_function_name_map(nullptr)
+    , m_emitted_function_list(nullptr)
+{
+}
+
+pass::CommonFunctionCollection::CommonFunctionCollection(
+    function<string(Node&, string)> emitter,
+    unordered_map<Node*, string>& function_name_map,
+    vector<string>& emitted_function_list)
+    : m_emit_op_as_function(emitter)
+    , m_node_function_map(nullptr)
+    , m_emitted_functions(nullptr)
+    , m_function_name_map(&function_name_map)
+    , m_emitted_function_list(&emitted_function_list)
 {
 }
 
@@ -42,6 +66,7 @@ bool pass::CommonFunctionCollection::run_on_module(vector<shared_ptr<Function>>&
     // match_function_map `key` contains the entire string of the function emitted for the
     // `value` Node*
     unordered_map<string, Node*> match_function_map;
+    unordered_set<string> function_names;
     stringstream ss;
     const string function_name = "__f__";
     for (const shared_ptr<Function>& current_function : functions)
@@ -78,22 +103,43 @@ bool pass::CommonFunctionCollection::run_on_module(vector<shared_ptr<Function>>&
             // function and the original node is *also* mapped to call the original node's function.
             // We also emit the static function declaration to m_emitted_functions when the match
             // is found the first time.
+            // In outlining mode every op gets a function, emitted on the first occurrence of
+            // its code and named by a hash of it, so that units of the same functions have the
+            // same source, and hit the code cache, in every graph.
             string match_function = m_emit_op_as_function(node, function_name);
             auto it = match_function_map.find(match_function);
-            if (it != match_function_map.end())
+            if (m_emitted_function_list)
             {
-                m_node_function_map.insert({&node, it->second});
-                if (m_node_function_map.find(it->second) == m_node_function_map.end())
+                if (it == match_function_map.end())
                 {
-                    m_node_function_map.insert({it->second, it->second});
-
-                    // All of the functions are created with the same name `__f__` so here
-                    // we rename it to something unique so we can compile everything when done.
-                    auto offset = match_function.find(function_name);
-                    string emitted_function = match_function;
-                    string match_function_name = create_function_name(*it->second);
-                    emitted_function.replace(offset, function_name.size(), match_function_name);
-                    ss << emitted_function << "\n";
+                    match_function_map.insert({match_function, &node});
+                    stringstream name;
+                    name << "func_" << hex << hash<string>()(match_function);
+                    // Distinct code with the same hash gets a suffixed name
+                    string unique_name = name.str();
+                    for (size_t i = 1; !function_names.insert(unique_name).second; i++)
+                    {
+                        unique_name = name.str() + "_" + to_string(i);
+                    }
+                    m_function_name_map->insert({&node, unique_name});
+                    m_emitted_function_list->push_back(
+                        rename_function(match_function, function_name, unique_name));
+                }
+                else
+                {
+                    m_function_name_map->insert({&node, m_function_name_map->at(it->second)});
+                }
+            }
+            else if (it != match_function_map.end())
+            {
+                m_node_function_map->insert({&node, it->second});
+                if (m_node_function_map->find(it->second) == m_node_function_map->end())
+                {
+                    m_node_function_map->insert({it->second, it->second});
+                    ss << rename_function(match_function,
+                                          function_name,
+                                          create_function_name(*it->second))
+                       << "\n";
                 }
             }
             else
@@ -102,7 +148,10 @@ bool pass::CommonFunctionCollection::run_on_module(vector<shared_ptr<Function>>&
             }
         }
     }
-    m_emitted_functions = ss.str();
+    if (m_emitted_functions)
+    {
+        *m_emitted_functions = ss.str();
+    }
     return false;
 }
 
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <unordered_map>
+#include <vector>
 
 #include "ngraph/code_writer.hpp"
 #include "ngraph/pass/pass.hpp"
@@ -45,6 +46,18 @@ public:
                              std::unordered_map<Node*, Node*>& result_map,
                              std::string& emitted_functions);
 
+    /// \brief Create the CommonFunctionCollection pass in outlining mode, where every op
+    ///        gets a function, not only the ops whose code is emitted more than once
+    /// \param function_emitter - Same as above.
+    /// \param function_name_map - Mapping of every op that was emitted to the name of the
+    ///        function to call. Functions are named by a hash of their code, so the same code
+    ///        gets the same name in every graph.
+    /// \param emitted_function_list - vector to receive the emitted code of each function
+    ///        separately, so the functions can be spread over several translation units.
+    CommonFunctionCollection(std::function<std::string(Node&, std::string)> function_emitter,
+                             std::unordered_map<Node*, std::string>& function_name_map,
+                             std::vector<std::string>& emitted_function_list);
+
     virtual ~CommonFunctionCollection() override;
 
     bool run_on_module(std::vector<std::shared_ptr<ngraph::Function>>&) override;
@@ -57,6 +70,8 @@ public:
 
 private:
     std::function<std::string(Node&, std::string)> m_emit_op_as_function;
-    std::unordered_map<Node*, Node*>& m_node_function_map;
-    std::string& m_emitted_functions;
+    std::unordered_map<Node*, Node*>* m_node_function_map;
+    std::string* m_emitted_functions;
+    std::unordered_map<Node*, std::string>* m_function_name_map;
+    std::vector<std::string>* m_emitted_function_list;
 };
@@ -21,6 +21,7 @@
 
 #include "cse.hpp"
 #include "ngraph/axis_vector.hpp"
+#include "ngraph/constant_store.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/op/abs.hpp"
@@ -76,6 +77,15 @@ static bool cse_constant(shared_ptr<Node> a, shared_ptr<Node> b)
     auto ca = static_pointer_cast<op::Constant>(a);
     auto cb = static_pointer_cast<op::Constant>(b);
 
+    if (ca->get_data_ptr() == cb->get_data_ptr())
+    {
+        return true;
+    }
+    if (ca->get_content_hash() != cb->get_content_hash())
+    {
+        return false;
+    }
+
     size_t size = shape_size(a->get_shape()) * a->get_element_type().size();
 
     return !memcmp(ca->get_data_ptr(), cb->get_data_ptr(), size);
@@ -230,6 +240,14 @@ namespace std
             hash<type_index> type_hash_compute{};
             auto type_hash = type_hash_compute(ti);
 
+            // Constants have no arguments, hash them by content rather than putting them all
+            // in one bucket
+            if (ti == TI(op::Constant))
+            {
+                return ngraph::hash_combine(
+                    {type_hash, static_cast<const op::Constant&>(p_this).get_content_hash()});
+            }
+
             vector<size_t> arg_ids;
 
             arg_ids.push_back(type_hash);
@@ -259,13 +277,27 @@ bool ngraph::pass::CommonSubexpressionElimination::run_on_function(shared_ptr<ng
     bool replaced = false;
     unordered_map<NodeKey, shared_ptr<Node>> expressions{};
 
-    for (auto n : f->get_ordered_ops())
+    auto ordered_ops = f->get_ordered_ops_shared();
+    for (auto n : *ordered_ops)
     {
         if (n->is_output() || n->is_parameter())
         {
             continue;
         }
 
+        // Share the data of constants equal to ones of other functions
+        if (TI(*n) == TI(op::Constant))
+        {
+            auto constant = static_pointer_cast<op::Constant>(n);
+            auto interned = ConstantStore::get().intern(constant);
+            if (interned != constant)
+            {
+                ngraph::replace_node(n, interned);
+                n = interned;
+                replaced = true;
+            }
+        }
+
         NodeKey n_key(n, m_backend_cse_handlers);
         if (expressions.count(n_key))
         {
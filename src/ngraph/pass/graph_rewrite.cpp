@@ -70,7 +70,8 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
         rewritten = false;
         vector<shared_ptr<pattern::Matcher>> matchers{m_matchers};
         m_matchers.clear();
-        for (auto node : f->get_ordered_ops())
+        auto ordered_ops = f->get_ordered_ops_shared();
+        for (auto node : *ordered_ops)
         {
             for (auto matcher : matchers)
             {
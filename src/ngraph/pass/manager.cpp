@@ -115,7 +115,7 @@ void pass::Manager::run_passes(shared_ptr<Function> func, bool transitive)
         {
             for (shared_ptr<Function> f : fs)
             {
-                call_graph_pass->run_on_call_graph(f->get_ordered_ops());
+                call_graph_pass->run_on_call_graph(*f->get_ordered_ops_shared());
             }
         }
 
@@ -0,0 +1,278 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+#include "ngraph/function.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/convert.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/op/slice.hpp"
+#include "ngraph/op/util/binary_elementwise_arithmetic.hpp"
+#include "ngraph/op/util/unary_elementwise_arithmetic.hpp"
+#include "ngraph/pass/liveness.hpp"
+#include "ngraph/pass/memory_layout.hpp"
+#include "ngraph/pass/rematerialization.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    // Position of every op in the current order and the position of its last consumer
+    struct Schedule
+    {
+        explicit Schedule(const shared_ptr<Function>& f)
+        {
+            for (auto& node : f->get_ordered_ops())
+            {
+                position[node.get()] = ops.size();
+                ops.push_back(node);
+            }
+            for (size_t i = 0; i < ops.size(); i++)
+            {
+                size_t last = i;
+                for (auto& user : ops[i]->get_users())
+                {
+                    auto it = position.find(user.get());
+                    if (it != position.end())
+                    {
+                        last = max(last, it->second);
+                    }
+                }
+                last_use.push_back(last);
+            }
+        }
+
+        // Bytes of pool memory this op's outputs take; parameters, constants and results
+        // live outside of the temporary pool
+        static size_t pool_bytes(const shared_ptr<Node>& node)
+        {
+            if (node->is_parameter() || node->is_constant() || node->is_output())
+            {
+                return 0;
+            }
+            size_t bytes = 0;
+            for (size_t i = 0; i < node->get_output_size(); i++)
+            {
+                bytes += node->get_output_tensor(i).size();
+            }
+            return bytes;
+        }
+
+        // Simulates the live set along the order and returns the position of its peak
+        size_t find_peak(size_t& peak_bytes) const
+        {
+            vector<size_t> freed_at(ops.size(), 0);
+            for (size_t i = 0; i < ops.size(); i++)
+            {
+                freed_at[last_use[i]] += pool_bytes(ops[i]);
+            }
+            size_t live = 0;
+            size_t peak_position = 0;
+            peak_bytes = 0;
+            for (size_t i = 0; i < ops.size(); i++)
+            {
+                live += pool_bytes(ops[i]);
+                if (live > peak_bytes)
+                {
+                    peak_bytes = live;
+                    peak_position = i;
+                }
+                live -= freed_at[i];
+            }
+            return peak_position;
+        }
+
+        vector<shared_ptr<Node>> ops;
+        vector<size_t> last_use;
+        unordered_map<Node*, size_t> position;
+    };
+}
+
+static bool is_recomputable(const shared_ptr<Node>& node)
+{
+    if (node->get_output_size() != 1 || !node->get_control_dependencies().empty())
+    {
+        return false;
+    }
+    return dynamic_pointer_cast<op::util::UnaryElementwiseArithmetic>(node) ||
+           dynamic_pointer_cast<op::util::BinaryElementwiseArithmetic>(node) ||
+           dynamic_pointer_cast<op::Broadcast>(node) || dynamic_pointer_cast<op::Reshape>(node) ||
+           dynamic_pointer_cast<op::Convert>(node) || dynamic_pointer_cast<op::Slice>(node);
+}
+
+// Returns a node computing the same value as `node` that can be used at position `at`:
+// either `node` itself when it is still alive there, or a clone of the cheap subgraph
+// producing it. Returns nullptr if the value cannot be recomputed within `depth_left` ops.
+static shared_ptr<Node> recompute_at(const shared_ptr<Node>& node,
+                                     size_t at,
+                                     size_t depth_left,
+                                     bool is_root,
+                                     const Schedule& schedule,
+                                     unordered_map<Node*, shared_ptr<Node>>& clones)
+{
+    if (!is_root)
+    {
+        if (node->is_parameter() || node->is_constant() ||
+            schedule.last_use.at(schedule.position.at(node.get())) >= at)
+        {
+            return node;
+        }
+    }
+    auto it = clones.find(node.get());
+    if (it != clones.end())
+    {
+        return it->second;
+    }
+    if (depth_left == 0 || !is_recomputable(node))
+    {
+        return nullptr;
+    }
+
+    NodeVector new_args;
+    for (auto& arg : node->get_arguments())
+    {
+        auto new_arg = recompute_at(arg, at, depth_left - 1, false, schedule, clones);
+        if (!new_arg)
+        {
+            return nullptr;
+        }
+        new_args.push_back(new_arg);
+    }
+    auto clone = node->copy_with_new_args(new_args);
+    clones[node.get()] = clone;
+    return clone;
+}
+
+static size_t plan_temporary_pool(const shared_ptr<Function>& f, size_t alignment)
+{
+    pass::Liveness().run_on_function(f);
+    pass::MemoryLayout(alignment).run_on_function(f);
+    return f->get_temporary_pool_size();
+}
+
+pass::Rematerialization::Rematerialization(size_t memory_budget,
+                                           size_t max_recompute_depth,
+                                           size_t alignment)
+    : m_memory_budget(memory_budget)
+    , m_max_recompute_depth(max_recompute_depth)
+    , m_alignment(alignment)
+{
+}
+
+bool pass::Rematerialization::run_on_function(shared_ptr<Function> f)
+{
+    m_recomputed_op_count = 0;
+    m_initial_pool_size = plan_temporary_pool(f, m_alignment);
+    m_final_pool_size = m_initial_pool_size;
+    Schedule(f).find_peak(m_initial_peak);
+    m_final_peak = m_initial_peak;
+    if (m_initial_peak <= m_memory_budget)
+    {
+        return false;
+    }
+
+    bool modified = false;
+    while (true)
+    {
+        Schedule schedule(f);
+        size_t peak = schedule.find_peak(m_final_peak);
+        if (m_final_peak <= m_memory_budget)
+        {
+            break;
+        }
+
+        // Activations produced before the peak and consumed after it, largest first
+        vector<size_t> candidates;
+        for (size_t i = 0; i < peak; i++)
+        {
+            if (schedule.last_use[i] > peak && is_recomputable(schedule.ops[i]))
+            {
+                candidates.push_back(i);
+            }
+        }
+        stable_sort(candidates.begin(), candidates.end(), [&](size_t a, size_t b) {
+            return Schedule::pool_bytes(schedule.ops[a]) > Schedule::pool_bytes(schedule.ops[b]);
+        });
+
+        bool rewritten = false;
+        for (size_t candidate : candidates)
+        {
+            const shared_ptr<Node>& node = schedule.ops[candidate];
+            NodeVector late_users;
+            size_t first_late_use = schedule.ops.size();
+            for (auto& user : node->get_users())
+            {
+                auto it = schedule.position.find(user.get());
+                if (it != schedule.position.end() && it->second > peak)
+                {
+                    late_users.push_back(user);
+                    first_late_use = min(first_late_use, it->second);
+                }
+            }
+
+            unordered_map<Node*, shared_ptr<Node>> clones;
+            auto replacement = recompute_at(
+                node, first_late_use, m_max_recompute_depth, true, schedule, clones);
+            if (!replacement)
+            {
+                continue;
+            }
+
+            // Pin the recomputation next to its consumers
+            auto& predecessor = schedule.ops[first_late_use - 1];
+            for (auto& clone : clones)
+            {
+                clone.second->add_control_dependency(predecessor);
+            }
+            for (auto& user : late_users)
+            {
+                for (descriptor::Input& input : user->get_inputs())
+                {
+                    if (input.get_output().get_node() == node)
+                    {
+                        input.replace_output(replacement, 0);
+                    }
+                }
+            }
+            NGRAPH_DEBUG << "Rematerialization: recomputing " << node->get_name() << " with "
+                         << clones.size() << " op(s) before " << predecessor->get_name();
+            m_recomputed_op_count += clones.size();
+            rewritten = true;
+            modified = true;
+            break;
+        }
+        if (!rewritten)
+        {
+            break;
+        }
+    }
+
+    // The rewritten graph gets a fresh memory plan, so the pool size reflects the new order
+    if (modified)
+    {
+        m_final_pool_size = plan_temporary_pool(f, m_alignment);
+    }
+    NGRAPH_DEBUG << "Rematerialization: live temporaries peak " << m_initial_peak << " -> "
+                 << m_final_peak << " bytes (budget " << m_memory_budget << "), temporary pool "
+                 << m_initial_pool_size << " -> " << m_final_pool_size << " bytes, "
+                 << m_recomputed_op_count << " op(s) recomputed";
+    return modified;
+}
@@ -0,0 +1,75 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        class Rematerialization;
+    }
+}
+
+/// \brief Trades recompute for memory (gradient checkpointing).
+///
+/// In training graphs built with autodiff::Adjoints, forward activations stay alive until
+/// their adjoints consume them. While the live-tensor peak of the function exceeds the
+/// budget, this pass picks the largest activation that is live across the peak, clones the
+/// cheap forward subgraph producing it (elementwise and data movement ops) right before its
+/// late consumers, and rewires those consumers to the clone. Recomputation only starts from
+/// checkpoints: parameters, constants, or tensors that are live at that point anyway.
+///
+/// The budget is checked against the live-tensor peak simulated along the op order. The pass
+/// also runs Liveness and MemoryLayout before and after rewriting, so the temporary pool the
+/// memory planner actually lays out is reported alongside the simulated peak.
+///
+/// Cloned ops get a control dependency on the op scheduled just before their first consumer,
+/// which keeps the topological order from hoisting them back into the forward pass.
+class ngraph::pass::Rematerialization : public FunctionPass
+{
+public:
+    /// \param memory_budget Target peak in bytes of the live temporary tensors.
+    /// \param max_recompute_depth Longest chain of ops cloned to recompute one activation.
+    /// \param alignment Alignment the memory planner uses for the reported pool sizes.
+    Rematerialization(size_t memory_budget,
+                      size_t max_recompute_depth = 4,
+                      size_t alignment = 64);
+
+    bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+
+    /// \return Peak bytes of live temporary tensors along the op order before the pass ran
+    size_t get_initial_peak() const { return m_initial_peak; }
+    /// \return Peak bytes of live temporary tensors along the op order after rematerialization
+    size_t get_final_peak() const { return m_final_peak; }
+    /// \return Temporary pool size computed by the memory planner before the pass ran
+    size_t get_initial_pool_size() const { return m_initial_pool_size; }
+    /// \return Temporary pool size computed by the memory planner after rematerialization
+    size_t get_final_pool_size() const { return m_final_pool_size; }
+    /// \return Number of ops cloned for recomputation
+    size_t get_recomputed_op_count() const { return m_recomputed_op_count; }
+private:
+    size_t m_memory_budget;
+    size_t m_max_recompute_depth;
+    size_t m_alignment;
+    size_t m_initial_peak{0};
+    size_t m_final_peak{0};
+    size_t m_initial_pool_size{0};
+    size_t m_final_pool_size{0};
+    size_t m_recomputed_op_count{0};
+};
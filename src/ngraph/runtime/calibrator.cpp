@@ -0,0 +1,180 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <unordered_set>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/convolution.hpp"
+#include "ngraph/op/result.hpp"
+#include "ngraph/runtime/calibrator.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    struct ObservedTensor
+    {
+        string name;
+        size_t result_index;
+        size_t element_count;
+        float min;
+        float max;
+        vector<size_t> histogram;
+    };
+}
+
+runtime::Calibrator::Calibrator(const shared_ptr<Backend>& backend,
+                                Mode mode,
+                                double percentile,
+                                size_t histogram_bins)
+    : m_backend(backend)
+    , m_mode(mode)
+    , m_percentile(percentile)
+    , m_histogram_bins(histogram_bins)
+{
+    if (m_percentile <= 0 || m_percentile > 100)
+    {
+        throw ngraph_error("Calibration percentile must be in (0, 100]");
+    }
+    if (m_histogram_bins == 0)
+    {
+        throw ngraph_error("Calibration histogram needs at least one bin");
+    }
+}
+
+runtime::CalibrationTable
+    runtime::Calibrator::calibrate(const shared_ptr<Function>& f,
+                                   const vector<vector<shared_ptr<Tensor>>>& dataset)
+{
+    if (dataset.empty())
+    {
+        throw ngraph_error("Calibration needs at least one sample");
+    }
+
+    NodeMap node_map;
+    auto clone = clone_function(*f, node_map);
+    ResultVector results = clone->get_results();
+    vector<ObservedTensor> observed;
+    unordered_set<Node*> seen;
+
+    auto observe = [&](const shared_ptr<Node>& node) {
+        if (node->get_output_size() != 1 || node->get_element_type() != element::f32 ||
+            !seen.insert(node.get()).second)
+        {
+            return;
+        }
+        results.push_back(make_shared<op::Result>(node_map.get(node)));
+        observed.push_back({node->get_name(),
+                            results.size() - 1,
+                            shape_size(node->get_shape()),
+                            numeric_limits<float>::max(),
+                            numeric_limits<float>::lowest(),
+                            {}});
+    };
+    for (auto& node : f->get_ordered_ops())
+    {
+        if (auto conv = dynamic_pointer_cast<op::Convolution>(node))
+        {
+            observe(conv->get_argument(0));
+            observe(conv);
+        }
+    }
+
+    auto instrumented = make_shared<Function>(results, clone->get_parameters());
+    auto executable = m_backend->compile(instrumented);
+    vector<shared_ptr<Tensor>> outputs;
+    for (auto& result : results)
+    {
+        outputs.push_back(
+            m_backend->create_tensor(result->get_element_type(), result->get_shape()));
+    }
+
+    vector<float> values;
+    auto run = [&](const function<void(ObservedTensor&)>& visit) {
+        for (auto& inputs : dataset)
+        {
+            executable->call(outputs, inputs);
+            for (ObservedTensor& tensor : observed)
+            {
+                values.resize(tensor.element_count);
+                outputs[tensor.result_index]->read(values.data(), 0, values.size() * sizeof(float));
+                visit(tensor);
+            }
+        }
+    };
+
+    run([&](ObservedTensor& tensor) {
+        for (float v : values)
+        {
+            tensor.min = min(tensor.min, v);
+            tensor.max = max(tensor.max, v);
+        }
+    });
+
+    if (m_mode == Mode::PERCENTILE)
+    {
+        // Second sweep bins absolute values over [0, absmax] found by the first one
+        run([&](ObservedTensor& tensor) {
+            float abs_max = max(fabs(tensor.min), fabs(tensor.max));
+            tensor.histogram.resize(m_histogram_bins, 0);
+            if (abs_max == 0)
+            {
+                return;
+            }
+            for (float v : values)
+            {
+                size_t bin = static_cast<size_t>(fabs(v) / abs_max * m_histogram_bins);
+                tensor.histogram[min(bin, m_histogram_bins - 1)]++;
+            }
+        });
+        for (ObservedTensor& tensor : observed)
+        {
+            float abs_max = max(fabs(tensor.min), fabs(tensor.max));
+            size_t total = 0;
+            for (size_t count : tensor.histogram)
+            {
+                total += count;
+            }
+            size_t cumulative = 0;
+            for (size_t bin = 0; bin < tensor.histogram.size(); bin++)
+            {
+                cumulative += tensor.histogram[bin];
+                if (cumulative >= total * (m_percentile / 100.0))
+                {
+                    float threshold = abs_max * (bin + 1) / m_histogram_bins;
+                    tensor.min = max(tensor.min, -threshold);
+                    tensor.max = min(tensor.max, threshold);
+                    break;
+                }
+            }
+        }
+    }
+
+    CalibrationTable table;
+    for (ObservedTensor& tensor : observed)
+    {
+        NGRAPH_DEBUG << "Calibration range for " << tensor.name << ": [" << tensor.min << ", "
+                     << tensor.max << "]";
+        table[tensor.name] = {tensor.min, tensor.max};
+    }
+    return table;
+}
@@ -0,0 +1,81 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ngraph/function.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/tensor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        struct CalibrationRange
+        {
+            float min;
+            float max;
+        };
+
+        /// \brief Observed value range per tensor, keyed by the name of the producing node in
+        ///        the calibrated function.
+        using CalibrationTable = std::map<std::string, CalibrationRange>;
+
+        class Calibrator;
+    }
+}
+
+/// \brief Collects the value ranges needed for post-training quantization.
+///
+/// The function is cloned and every tensor that a quantized kernel would consume or produce
+/// (the data input and the output of each f32 Convolution) is exposed as an extra Result.
+/// The instrumented clone is compiled once on the given backend and run over a sample
+/// dataset; the original function is not modified.
+class ngraph::runtime::Calibrator
+{
+public:
+    enum class Mode
+    {
+        // Range is the absolute min/max seen over the whole dataset
+        MIN_MAX,
+        // Range is clipped to the given percentile of a histogram of absolute values, which
+        // keeps rare outliers from wasting quantization levels
+        PERCENTILE
+    };
+
+    Calibrator(const std::shared_ptr<Backend>& backend,
+               Mode mode = Mode::MIN_MAX,
+               double percentile = 99.99,
+               size_t histogram_bins = 2048);
+
+    /// \param f The f32 function to calibrate.
+    /// \param dataset One vector of input tensors per sample, ordered like the parameters of
+    ///        f and allocated on the calibration backend.
+    /// \return Observed ranges of the instrumented tensors.
+    CalibrationTable calibrate(const std::shared_ptr<Function>& f,
+                               const std::vector<std::vector<std::shared_ptr<Tensor>>>& dataset);
+
+private:
+    std::shared_ptr<Backend> m_backend;
+    Mode m_mode;
+    double m_percentile;
+    size_t m_histogram_bins;
+};
@@ -19,6 +19,7 @@
 #include "ngraph/op/add.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
 #include "ngraph/runtime/cpu/kernel/add.hpp"
+#include "ngraph/runtime/cpu/kernel/bfloat16.hpp"
 #include "ngraph/runtime/cpu/mkldnn_invoke.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 
@@ -61,6 +62,10 @@ namespace ngraph
                     };
                     functors.emplace_back(functor);
                 }
+                else if (args[0].get_element_type() == element::bf16)
+                {
+                    BUILD_BF16_BINARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::bf16_ops::add);
+                }
                 else
                 {
                     BUILD_BINARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::add);
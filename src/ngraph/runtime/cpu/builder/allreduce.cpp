@@ -21,6 +21,9 @@
 #include <mpi.h>
 #endif
 
+#include <cstring>
+#include <memory>
+
 #include "ngraph/log.hpp"
 #include "ngraph/op/allreduce.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
@@ -66,11 +69,28 @@ namespace ngraph
                     data_type = MLSL::DT_DOUBLE;
                 }
 
-                auto functor = [&, count, data_type](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* ectx) {
-                    MLSL::CommReq* req = ctx->mlsl_dist->AllReduce(
-                        arg_tensor, out_tensor, count, data_type, MLSL::RT_SUM, MLSL::GT_DATA);
-                    ctx->mlsl_env->Wait(req);
+                auto size = out[0].get_size() * out[0].get_element_type().size();
+                auto index = external_function->add_allreduce();
+                auto functor = [&, count, size, data_type, index](CPURuntimeContext* ctx,
+                                                                  CPUExecutionContext* ectx) {
+                    // Reduce in place in the output, which stays live until it is consumed,
+                    // so the memory of the argument can be reused while the reduction runs
+                    if (arg_tensor != out_tensor)
+                    {
+                        memcpy(out_tensor, arg_tensor, size);
+                    }
+                    PendingAllReduce& pending = ctx->pending_allreduces[index];
+                    pending.request = ctx->mlsl_dist->AllReduce(
+                        out_tensor, out_tensor, count, data_type, MLSL::RT_SUM, MLSL::GT_DATA);
+                    pending.pending = true;
+                };
+                auto wait = [index](CPURuntimeContext* ctx) {
+                    PendingAllReduce& pending = ctx->pending_allreduces[index];
+                    if (pending.pending)
+                    {
+                        ctx->mlsl_env->Wait(pending.request);
+                        pending.pending = false;
+                    }
                 };
 #elif NGRAPH_DISTRIBUTED_OMPI_ENABLE
                 auto data_type = MPI_FLOAT;
@@ -90,21 +110,66 @@ namespace ngraph
                 int id = call_seq;
                 call_seq++;
 
-                auto functor = [&, id, count, data_type, func_name, node_friendly_name, node_name](
-                    CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                auto size = out[0].get_size() * out[0].get_element_type().size();
+                auto index = external_function->add_allreduce();
+                auto functor = [&,
+                                id,
+                                count,
+                                size,
+                                data_type,
+                                index,
+                                func_name,
+                                node_friendly_name,
+                                node_name](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
                     NGRAPH_DEBUG_PRINT("AllReduce Execute[%d]: Function: %s  Node: %s %s Size: %d",
                                        id,
                                        func_name.c_str(),
                                        node_name.c_str(),
                                        node_friendly_name.c_str(),
                                        count);
-                    MPI_Allreduce(
-                        arg_tensor, out_tensor, count, data_type, MPI_SUM, MPI_COMM_WORLD);
+                    // Reduce in place in the output, which stays live until it is consumed,
+                    // so the memory of the argument can be reused while the reduction runs
+                    if (arg_tensor != out_tensor)
+                    {
+                        memcpy(out_tensor, arg_tensor, size);
+                    }
+                    PendingAllReduce& pending = ctx->pending_allreduces[index];
+                    MPI_Iallreduce(MPI_IN_PLACE,
+                                   out_tensor,
+                                   count,
+                                   data_type,
+                                   MPI_SUM,
+                                   MPI_COMM_WORLD,
+                                   &pending.request);
+                    pending.pending = true;
+                };
+                auto wait = [index](CPURuntimeContext* ctx) {
+                    PendingAllReduce& pending = ctx->pending_allreduces[index];
+                    if (pending.pending)
+                    {
+                        MPI_Wait(&pending.request, MPI_STATUS_IGNORE);
+                        pending.pending = false;
+                    }
                 };
 #else
                 throw ngraph_error("Distributed Library not supported/mentioned");
 #endif
-                functors.emplace_back(functor);
+                // The reduction completes when the result is first read. Flow graph ops run on
+                // arbitrary threads, which not every communication library allows, so they
+                // wait right away.
+                if (external_function->uses_tbb())
+                {
+                    functors.emplace_back([functor, wait](CPURuntimeContext* ctx,
+                                                          CPUExecutionContext* ectx) {
+                        functor(ctx, ectx);
+                        wait(ctx);
+                    });
+                }
+                else
+                {
+                    functors.emplace_back(functor);
+                    external_function->add_async_output(out[0].get_name(), wait);
+                }
             }
 
             REGISTER_OP_BUILDER(AllReduce);
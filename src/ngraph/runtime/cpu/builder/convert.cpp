@@ -16,7 +16,9 @@
 
 #include "ngraph/op/convert.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/bfloat16.hpp"
 #include "ngraph/runtime/cpu/kernel/convert.hpp"
+#include "ngraph/runtime/cpu/kernel/float16.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -39,7 +41,27 @@ namespace ngraph
 
                 std::function<decltype(runtime::cpu::kernel::convert<float, int>)> kernel;
 
-                if (out[0].get_element_type() == element::boolean)
+                if (args[0].get_element_type() == element::bf16 &&
+                    out[0].get_element_type() == element::f32)
+                {
+                    kernel = runtime::cpu::kernel::convert_bf16_to_f32;
+                }
+                else if (args[0].get_element_type() == element::f32 &&
+                         out[0].get_element_type() == element::bf16)
+                {
+                    kernel = runtime::cpu::kernel::convert_f32_to_bf16;
+                }
+                else if (args[0].get_element_type() == element::f16 &&
+                         out[0].get_element_type() == element::f32)
+                {
+                    kernel = runtime::cpu::kernel::convert_f16_to_f32;
+                }
+                else if (args[0].get_element_type() == element::f32 &&
+                         out[0].get_element_type() == element::f16)
+                {
+                    kernel = runtime::cpu::kernel::convert_f32_to_f16;
+                }
+                else if (out[0].get_element_type() == element::boolean)
                 {
                     SELECT_KERNEL(
                         kernel, args[0].get_element_type(), runtime::cpu::kernel::convert_to_i8);
@@ -76,8 +76,15 @@ namespace ngraph
                 {
                     std::function<decltype(runtime::cpu::kernel::convolution<float>)> kernel;
 
-                    SELECT_KERNEL(
-                        kernel, out[0].get_element_type(), runtime::cpu::kernel::convolution);
+                    if (out[0].get_element_type() == element::bf16)
+                    {
+                        kernel = runtime::cpu::kernel::convolution_bf16;
+                    }
+                    else
+                    {
+                        SELECT_KERNEL(
+                            kernel, out[0].get_element_type(), runtime::cpu::kernel::convolution);
+                    }
 
                     auto window_movement_strides = convolution->get_window_movement_strides();
                     auto window_dilation_strides = convolution->get_window_dilation_strides();
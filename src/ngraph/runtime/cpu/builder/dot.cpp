@@ -19,7 +19,9 @@
 
 #include "ngraph/op/dot.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/cpu_kernel_tuner.hpp"
 #include "ngraph/runtime/cpu/cpu_kernels.hpp"
+#include "ngraph/runtime/cpu/kernel/bfloat16.hpp"
 #include "ngraph/runtime/cpu/kernel/dot.hpp"
 
 using namespace std;
@@ -65,6 +67,38 @@ namespace ngraph
                     return;
                 }
 
+                // bfloat16 operands are widened to float block by block and multiplied with
+                // float accumulation, the result is rounded once. In row-major order the Dot is
+                // the product of an [m, k] and a [k, n] matrix, k spanning the reduction axes.
+                if (out[0].get_element_type() == element::bf16)
+                {
+                    size_t free_axes_count = arg0_shape.size() - reduction_axes_count;
+                    size_t m = 1, k = 1, n = 1;
+                    for (size_t i = 0; i < arg0_shape.size(); i++)
+                    {
+                        if (i < free_axes_count)
+                        {
+                            m *= arg0_shape[i];
+                        }
+                        else
+                        {
+                            k *= arg0_shape[i];
+                        }
+                    }
+                    for (size_t i = reduction_axes_count; i < arg1_shape.size(); i++)
+                    {
+                        n *= arg1_shape[i];
+                    }
+
+                    auto functor = [&, m, k, n](CPURuntimeContext* ctx,
+                                                CPUExecutionContext* ectx) {
+                        runtime::cpu::kernel::dot_bf16(
+                            arg0_tensor, arg1_tensor, out_tensor, m, k, n, ectx->arena);
+                    };
+                    functors.emplace_back(functor);
+                    return;
+                }
+
                 if (arg0_shape.empty() || arg1_shape.empty())
                 {
                     auto first = (arg0_shape.empty() ? args[0] : args[1]);
@@ -183,7 +217,33 @@ namespace ngraph
                                 static_cast<float*>(out_tensor),
                                 max<size_t>(1UL, result_shape[1]));
                         };
-                    functors.emplace_back(functor);
+                    auto eigen_functor = [&, arg0_shape, arg1_shape, result_shape](
+                        CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        runtime::cpu::kernel::dot<float, 2, 2, 1>(arg0_tensor,
+                                                                  arg1_tensor,
+                                                                  out_tensor,
+                                                                  arg0_shape,
+                                                                  arg1_shape,
+                                                                  result_shape,
+                                                                  ectx->arena);
+                    };
+                    auto ref_functor = [&, arg0_shape, arg1_shape, result_shape](
+                        CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        runtime::cpu::kernel::dot_ref<float>(arg0_tensor,
+                                                             arg1_tensor,
+                                                             out_tensor,
+                                                             arg0_shape,
+                                                             arg1_shape,
+                                                             result_shape,
+                                                             1);
+                    };
+                    functors.emplace_back(CPUKernelTuner::get().select(
+                        external_function,
+                        node,
+                        args,
+                        out,
+                        "",
+                        {{"cblas", functor}, {"eigen", eigen_functor}, {"reference", ref_functor}}));
                     return;
                 }
 
@@ -202,7 +262,42 @@ namespace ngraph
                                result_shape,
                                reduction_axes_count);
                     };
-                functors.emplace_back(functor);
+
+                // Eigen contractions of the ranks that have a kernel are the alternative
+                std::function<decltype(runtime::cpu::kernel::dot_3d_2d_1rd<float>)> eigen_kernel;
+                if (out[0].get_element_type() == element::f32 && reduction_axes_count == 1 &&
+                    arg0_shape.size() == 3 && arg1_shape.size() == 3)
+                {
+                    eigen_kernel = runtime::cpu::kernel::dot_3d_3d_1rd<float>;
+                }
+                else if (out[0].get_element_type() == element::f32 && reduction_axes_count == 1 &&
+                         arg0_shape.size() == 3 && arg1_shape.size() == 2)
+                {
+                    eigen_kernel = runtime::cpu::kernel::dot_3d_2d_1rd<float>;
+                }
+                if (!eigen_kernel)
+                {
+                    functors.emplace_back(functor);
+                    return;
+                }
+
+                auto eigen_functor = [&, eigen_kernel, arg0_shape, arg1_shape, result_shape](
+                    CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                    eigen_kernel(arg0_tensor,
+                                 arg1_tensor,
+                                 out_tensor,
+                                 arg0_shape,
+                                 arg1_shape,
+                                 result_shape,
+                                 ectx->arena);
+                };
+                functors.emplace_back(CPUKernelTuner::get().select(
+                    external_function,
+                    node,
+                    args,
+                    out,
+                    "",
+                    {{"reference", functor}, {"eigen", eigen_functor}}));
             }
 
             REGISTER_OP_BUILDER(Dot);
@@ -0,0 +1,84 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstring>
+
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/float16.hpp"
+#include "ngraph/runtime/cpu/op/dot_f16_weights.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::DotF16Weights)
+            {
+                auto dot = static_cast<const ngraph::op::DotF16Weights*>(node);
+
+                auto& functors = external_function->get_functors();
+
+                auto& arg_tensor = external_function->get_tensor_data(args[0].get_name());
+                auto& weights_tensor = external_function->get_tensor_data(args[1].get_name());
+                auto& out_tensor = external_function->get_tensor_data(out[0].get_name());
+
+                size_t m = args[0].get_shape()[0];
+                size_t k = args[0].get_shape()[1];
+                size_t n = out[0].get_shape()[1];
+                bool transpose_weights = dot->get_transpose_weights();
+                bool bf16_weights = args[1].get_element_type() == element::bf16;
+
+                if (!m || !n)
+                {
+                    auto functor = [](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {};
+                    functors.emplace_back(functor);
+                    return;
+                }
+
+                if (!k)
+                {
+                    auto size = m * n * sizeof(float);
+                    auto functor = [&, size](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        memset(out_tensor, 0, size);
+                    };
+                    functors.emplace_back(functor);
+                    return;
+                }
+
+                auto functor = [&, m, k, n, transpose_weights, bf16_weights](
+                    CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                    runtime::cpu::kernel::dot_f16_weights(arg_tensor,
+                                                          weights_tensor,
+                                                          out_tensor,
+                                                          m,
+                                                          k,
+                                                          n,
+                                                          transpose_weights,
+                                                          bf16_weights,
+                                                          ectx->arena);
+                };
+                functors.emplace_back(functor);
+            }
+
+            REGISTER_OP_BUILDER(DotF16Weights);
+        }
+    }
+}
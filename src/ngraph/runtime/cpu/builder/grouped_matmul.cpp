@@ -0,0 +1,150 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <numeric>
+#include <tuple>
+
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/cpu_kernels.hpp"
+#include "ngraph/runtime/cpu/op/grouped_matmul.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::GroupedMatmul)
+            {
+                auto matmul = static_cast<const ngraph::op::GroupedMatmul*>(node);
+
+                auto& functors = external_function->get_functors();
+
+                size_t count = matmul->get_matmul_count();
+                auto sizes = [matmul, &out](size_t i) {
+                    bool transpose_a = matmul->get_is_a_transposed(i);
+                    size_t k = matmul->get_a_shape(i)[transpose_a ? 0 : 1];
+                    return make_tuple(transpose_a,
+                                      matmul->get_is_b_transposed(i),
+                                      out[i].get_shape()[0],
+                                      out[i].get_shape()[1],
+                                      k);
+                };
+
+                // Products of the same sizes and transposes form one group of the batched GEMM
+                vector<size_t> order(count);
+                iota(order.begin(), order.end(), 0);
+                stable_sort(order.begin(), order.end(), [&sizes](size_t i, size_t j) {
+                    return sizes(i) < sizes(j);
+                });
+
+                vector<cblas::Transpose> transa_array;
+                vector<cblas::Transpose> transb_array;
+                vector<int64_t> m_array;
+                vector<int64_t> n_array;
+                vector<int64_t> k_array;
+                vector<int64_t> lda_array;
+                vector<int64_t> ldb_array;
+                vector<int64_t> ldc_array;
+                vector<int64_t> group_sizes;
+                vector<void**> a_data;
+                vector<void**> b_data;
+                vector<void**> c_data;
+                for (size_t index = 0; index < count; index++)
+                {
+                    size_t i = order[index];
+                    a_data.push_back(&external_function->get_tensor_data(args[2 * i].get_name()));
+                    b_data.push_back(
+                        &external_function->get_tensor_data(args[2 * i + 1].get_name()));
+                    c_data.push_back(&external_function->get_tensor_data(out[i].get_name()));
+                    if (index > 0 && sizes(i) == sizes(order[index - 1]))
+                    {
+                        group_sizes.back()++;
+                        continue;
+                    }
+
+                    transa_array.push_back(matmul->get_is_a_transposed(i)
+                                               ? cblas::Transpose::Transpose
+                                               : cblas::Transpose::None);
+                    transb_array.push_back(matmul->get_is_b_transposed(i)
+                                               ? cblas::Transpose::Transpose
+                                               : cblas::Transpose::None);
+                    m_array.push_back(get<2>(sizes(i)));
+                    n_array.push_back(get<3>(sizes(i)));
+                    k_array.push_back(get<4>(sizes(i)));
+                    lda_array.push_back(max<size_t>(1, matmul->get_a_shape(i)[1]));
+                    ldb_array.push_back(max<size_t>(1, matmul->get_b_shape(i)[1]));
+                    ldc_array.push_back(max<size_t>(1, out[i].get_shape()[1]));
+                    group_sizes.push_back(1);
+                }
+                vector<float> alpha_array(group_sizes.size(), 1.0f);
+                vector<float> beta_array(group_sizes.size(), 0.0f);
+
+                auto functor = [&,
+                                transa_array,
+                                transb_array,
+                                m_array,
+                                n_array,
+                                k_array,
+                                lda_array,
+                                ldb_array,
+                                ldc_array,
+                                group_sizes,
+                                alpha_array,
+                                beta_array,
+                                a_data,
+                                b_data,
+                                c_data](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                    size_t count = a_data.size();
+                    vector<const float*> a_array(count);
+                    vector<const float*> b_array(count);
+                    vector<float*> c_array(count);
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        a_array[i] = static_cast<const float*>(*a_data[i]);
+                        b_array[i] = static_cast<const float*>(*b_data[i]);
+                        c_array[i] = static_cast<float*>(*c_data[i]);
+                    }
+
+                    cblas::cblas_sgemm_batch(cblas::Layout::RowMajor,
+                                             transa_array.data(),
+                                             transb_array.data(),
+                                             m_array.data(),
+                                             n_array.data(),
+                                             k_array.data(),
+                                             alpha_array.data(),
+                                             a_array.data(),
+                                             lda_array.data(),
+                                             b_array.data(),
+                                             ldb_array.data(),
+                                             beta_array.data(),
+                                             c_array.data(),
+                                             ldc_array.data(),
+                                             group_sizes.size(),
+                                             group_sizes.data());
+                };
+                functors.emplace_back(functor);
+            }
+
+            REGISTER_OP_BUILDER(GroupedMatmul);
+        }
+    }
+}
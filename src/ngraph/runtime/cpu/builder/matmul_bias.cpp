@@ -16,7 +16,9 @@
 
 #include "ngraph/runtime/cpu/op/matmul_bias.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/cpu_kernel_tuner.hpp"
 #include "ngraph/runtime/cpu/cpu_kernels.hpp"
+#include "ngraph/runtime/cpu/kernel/dot.hpp"
 #include "ngraph/runtime/cpu/op/batch_dot.hpp"
 
 using namespace std;
@@ -66,7 +68,7 @@ namespace ngraph
 
                 const float beta = 0.0f;
 
-                auto mm_functor =
+                CPUKernelFunctor mm_functor =
                     [&, transpose_A, transpose_B, m, n, k, lda, ldb, beta, arg2_shape](
                         CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
                         cblas::cblas_sgemm(
@@ -86,6 +88,28 @@ namespace ngraph
                             max<size_t>(1, arg2_shape[1]));
                     };
 
+                // An Eigen contraction is the alternative to sgemm for untransposed operands
+                if (!transpose_A && !transpose_B)
+                {
+                    auto eigen_functor = [&, arg0_shape, arg1_shape, arg2_shape](
+                        CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        runtime::cpu::kernel::dot<float, 2, 2, 1>(arg0_tensor,
+                                                                  arg1_tensor,
+                                                                  out0_tensor,
+                                                                  arg0_shape,
+                                                                  arg1_shape,
+                                                                  arg2_shape,
+                                                                  ectx->arena);
+                    };
+                    mm_functor = CPUKernelTuner::get().select(
+                        external_function,
+                        node,
+                        args,
+                        out,
+                        "",
+                        {{"cblas", mm_functor}, {"eigen", eigen_functor}});
+                }
+
                 CPUKernelFunctor bias_functor = [](CPURuntimeContext* ctx,
                                                    CPUExecutionContext* ectx) {};
 
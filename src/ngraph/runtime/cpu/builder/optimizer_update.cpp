@@ -0,0 +1,136 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/kernel/optimizer_update.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/op/optimizer_update.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::SGDMomentumUpdate)
+            {
+                auto& functors = external_function->get_functors();
+
+                auto& weights_tensor = external_function->get_tensor_data(args[0].get_name());
+                auto& velocity_tensor = external_function->get_tensor_data(args[1].get_name());
+                auto& gradient_tensor = external_function->get_tensor_data(args[2].get_name());
+                auto& lr_tensor = external_function->get_tensor_data(args[3].get_name());
+                auto& out_weights_tensor = external_function->get_tensor_data(out[0].get_name());
+                auto& out_velocity_tensor = external_function->get_tensor_data(out[1].get_name());
+
+                auto update = static_cast<const ngraph::op::SGDMomentumUpdate*>(node);
+                float momentum = update->get_momentum();
+                size_t count = out[0].get_size();
+
+                std::function<decltype(runtime::cpu::kernel::sgd_momentum_update<float>)> kernel;
+                if (args[0].get_element_type() == element::f32)
+                {
+                    kernel = runtime::cpu::kernel::sgd_momentum_update<float>;
+                }
+                else if (args[0].get_element_type() == element::f64)
+                {
+                    kernel = runtime::cpu::kernel::sgd_momentum_update<double>;
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported element type " +
+                                       args[0].get_element_type().c_type_string() +
+                                       " for SGDMomentumUpdate");
+                }
+
+                auto functor = [&, kernel, momentum, count](CPURuntimeContext* ctx,
+                                                            CPUExecutionContext* ectx) {
+                    kernel(weights_tensor,
+                           velocity_tensor,
+                           gradient_tensor,
+                           lr_tensor,
+                           out_weights_tensor,
+                           out_velocity_tensor,
+                           momentum,
+                           count,
+                           ectx->arena);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::AdamUpdate)
+            {
+                auto& functors = external_function->get_functors();
+
+                auto& weights_tensor = external_function->get_tensor_data(args[0].get_name());
+                auto& m_tensor = external_function->get_tensor_data(args[1].get_name());
+                auto& v_tensor = external_function->get_tensor_data(args[2].get_name());
+                auto& gradient_tensor = external_function->get_tensor_data(args[3].get_name());
+                auto& lr_tensor = external_function->get_tensor_data(args[4].get_name());
+                auto& out_weights_tensor = external_function->get_tensor_data(out[0].get_name());
+                auto& out_m_tensor = external_function->get_tensor_data(out[1].get_name());
+                auto& out_v_tensor = external_function->get_tensor_data(out[2].get_name());
+
+                auto update = static_cast<const ngraph::op::AdamUpdate*>(node);
+                float beta1 = update->get_beta1();
+                float beta2 = update->get_beta2();
+                float epsilon = update->get_epsilon();
+                size_t count = out[0].get_size();
+
+                std::function<decltype(runtime::cpu::kernel::adam_update<float>)> kernel;
+                if (args[0].get_element_type() == element::f32)
+                {
+                    kernel = runtime::cpu::kernel::adam_update<float>;
+                }
+                else if (args[0].get_element_type() == element::f64)
+                {
+                    kernel = runtime::cpu::kernel::adam_update<double>;
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported element type " +
+                                       args[0].get_element_type().c_type_string() +
+                                       " for AdamUpdate");
+                }
+
+                auto functor = [&, kernel, beta1, beta2, epsilon, count](
+                    CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                    kernel(weights_tensor,
+                           m_tensor,
+                           v_tensor,
+                           gradient_tensor,
+                           lr_tensor,
+                           out_weights_tensor,
+                           out_m_tensor,
+                           out_v_tensor,
+                           beta1,
+                           beta2,
+                           epsilon,
+                           count,
+                           ectx->arena);
+                };
+                functors.emplace_back(functor);
+            }
+
+            REGISTER_OP_BUILDER(SGDMomentumUpdate);
+            REGISTER_OP_BUILDER(AdamUpdate);
+        }
+    }
+}
@@ -21,6 +21,7 @@
 #include "ngraph/op/quantize.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
 #include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/cpu/kernel/quantization.hpp"
 #include "ngraph/runtime/cpu/mkldnn_invoke.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 #include "ngraph/runtime/reference/dequantize.hpp"
@@ -35,6 +36,118 @@ namespace ngraph
     {
         namespace cpu
         {
+            // Views the input as [outer, channels, inner] with the quantization axes folded
+            // into channels, and a single channel as one row. Returns false when the axes are
+            // not contiguous.
+            static bool get_channel_view(const Shape& shape,
+                                         const AxisSet& axes,
+                                         size_t& outer,
+                                         size_t& channels,
+                                         size_t& inner)
+            {
+                outer = channels = inner = 1;
+                if (!axes.empty() && *axes.rbegin() - *axes.begin() + 1 != axes.size())
+                {
+                    return false;
+                }
+                for (size_t i = 0; i < shape.size(); i++)
+                {
+                    if (axes.count(i) != 0)
+                    {
+                        channels *= shape[i];
+                    }
+                    else if (axes.empty() || i < *axes.begin())
+                    {
+                        outer *= shape[i];
+                    }
+                    else
+                    {
+                        inner *= shape[i];
+                    }
+                }
+                if (channels == 1)
+                {
+                    inner *= outer;
+                    outer = 1;
+                }
+                return true;
+            }
+
+            template <typename QUANT, typename REAL>
+            static CPUKernelFunctor make_dequantize_functor(void*& arg0_tensor,
+                                                            void*& arg1_tensor,
+                                                            void*& arg2_tensor,
+                                                            void*& out_tensor,
+                                                            const Shape& arg0_shape,
+                                                            const Shape& arg1_shape,
+                                                            const AxisSet& daxes)
+            {
+                size_t outer, channels, inner;
+                if (get_channel_view(arg0_shape, daxes, outer, channels, inner))
+                {
+                    return [&, outer, channels, inner](CPURuntimeContext* ctx,
+                                                       CPUExecutionContext* ectx) {
+                        kernel::dequantize<QUANT, REAL>(arg0_tensor,
+                                                        arg1_tensor,
+                                                        arg2_tensor,
+                                                        out_tensor,
+                                                        outer,
+                                                        channels,
+                                                        inner,
+                                                        ectx->arena);
+                    };
+                }
+                return [&, arg0_shape, arg1_shape, daxes](CPURuntimeContext* ctx,
+                                                          CPUExecutionContext* ectx) {
+                    ngraph::runtime::reference::dequantize<QUANT>(static_cast<QUANT*>(arg0_tensor),
+                                                                  static_cast<REAL*>(arg1_tensor),
+                                                                  static_cast<QUANT*>(arg2_tensor),
+                                                                  static_cast<REAL*>(out_tensor),
+                                                                  arg0_shape,
+                                                                  arg1_shape,
+                                                                  daxes);
+                };
+            }
+
+            template <typename REAL, typename QUANT>
+            static CPUKernelFunctor make_quantize_functor(void*& arg0_tensor,
+                                                          void*& arg1_tensor,
+                                                          void*& arg2_tensor,
+                                                          void*& out_tensor,
+                                                          const Shape& arg0_shape,
+                                                          const Shape& arg1_shape,
+                                                          const AxisSet& daxes,
+                                                          op::Quantize::RoundMode round_mode)
+            {
+                size_t outer, channels, inner;
+                if (get_channel_view(arg0_shape, daxes, outer, channels, inner))
+                {
+                    return [&, outer, channels, inner, round_mode](CPURuntimeContext* ctx,
+                                                                   CPUExecutionContext* ectx) {
+                        kernel::quantize<REAL, QUANT>(arg0_tensor,
+                                                      arg1_tensor,
+                                                      arg2_tensor,
+                                                      out_tensor,
+                                                      outer,
+                                                      channels,
+                                                      inner,
+                                                      round_mode,
+                                                      ectx->arena);
+                    };
+                }
+                return [&, arg0_shape, arg1_shape, daxes, round_mode](CPURuntimeContext* ctx,
+                                                                      CPUExecutionContext* ectx) {
+                    ngraph::runtime::reference::quantize<REAL>(static_cast<REAL*>(arg0_tensor),
+                                                               static_cast<REAL*>(arg1_tensor),
+                                                               static_cast<QUANT*>(arg2_tensor),
+                                                               static_cast<QUANT*>(out_tensor),
+                                                               arg0_shape,
+                                                               arg1_shape,
+                                                               daxes,
+                                                               round_mode);
+                };
+            }
+
             template <>
             void Builder::BUILDER_DECL(ngraph::op::Dequantize)
             {
@@ -118,31 +231,23 @@ namespace ngraph
                     {
                         if (out[0].get_element_type() == element::f32)
                         {
-                            functor = [&, arg0_shape, arg1_shape, daxes](
-                                CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                                ngraph::runtime::reference::dequantize<int8_t>(
-                                    static_cast<int8_t*>(arg0_tensor),
-                                    static_cast<float*>(arg1_tensor),
-                                    static_cast<int8_t*>(arg2_tensor),
-                                    static_cast<float*>(out_tensor),
-                                    arg0_shape,
-                                    arg1_shape,
-                                    daxes);
-                            };
+                            functor = make_dequantize_functor<int8_t, float>(arg0_tensor,
+                                                                             arg1_tensor,
+                                                                             arg2_tensor,
+                                                                             out_tensor,
+                                                                             arg0_shape,
+                                                                             arg1_shape,
+                                                                             daxes);
                         }
                         else if (out[0].get_element_type() == element::f64)
                         {
-                            functor = [&, arg0_shape, arg1_shape, daxes](
-                                CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                                ngraph::runtime::reference::dequantize<int8_t>(
-                                    static_cast<int8_t*>(arg0_tensor),
-                                    static_cast<double*>(arg1_tensor),
-                                    static_cast<int8_t*>(arg2_tensor),
-                                    static_cast<double*>(out_tensor),
-                                    arg0_shape,
-                                    arg1_shape,
-                                    daxes);
-                            };
+                            functor = make_dequantize_functor<int8_t, double>(arg0_tensor,
+                                                                              arg1_tensor,
+                                                                              arg2_tensor,
+                                                                              out_tensor,
+                                                                              arg0_shape,
+                                                                              arg1_shape,
+                                                                              daxes);
                         }
                         else
                         {
@@ -153,31 +258,23 @@ namespace ngraph
                     {
                         if (out[0].get_element_type() == element::f32)
                         {
-                            functor = [&, arg0_shape, arg1_shape, daxes](
-                                CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                                ngraph::runtime::reference::dequantize<uint8_t>(
-                                    static_cast<uint8_t*>(arg0_tensor),
-                                    static_cast<float*>(arg1_tensor),
-                                    static_cast<uint8_t*>(arg2_tensor),
-                                    static_cast<float*>(out_tensor),
-                                    arg0_shape,
-                                    arg1_shape,
-                                    daxes);
-                            };
+                            functor = make_dequantize_functor<uint8_t, float>(arg0_tensor,
+                                                                              arg1_tensor,
+                                                                              arg2_tensor,
+                                                                              out_tensor,
+                                                                              arg0_shape,
+                                                                              arg1_shape,
+                                                                              daxes);
                         }
                         else if (out[0].get_element_type() == element::f64)
                         {
-                            functor = [&, arg0_shape, arg1_shape, daxes](
-                                CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                                ngraph::runtime::reference::dequantize<uint8_t>(
-                                    static_cast<uint8_t*>(arg0_tensor),
-                                    static_cast<double*>(arg1_tensor),
-                                    static_cast<uint8_t*>(arg2_tensor),
-                                    static_cast<double*>(out_tensor),
-                                    arg0_shape,
-                                    arg1_shape,
-                                    daxes);
-                            };
+                            functor = make_dequantize_functor<uint8_t, double>(arg0_tensor,
+                                                                               arg1_tensor,
+                                                                               arg2_tensor,
+                                                                               out_tensor,
+                                                                               arg0_shape,
+                                                                               arg1_shape,
+                                                                               daxes);
                         }
                         else
                         {
@@ -188,31 +285,23 @@ namespace ngraph
                     {
                         if (out[0].get_element_type() == element::f32)
                         {
-                            functor = [&, arg0_shape, arg1_shape, daxes](
-                                CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                                ngraph::runtime::reference::dequantize<int32_t>(
-                                    static_cast<int32_t*>(arg0_tensor),
-                                    static_cast<float*>(arg1_tensor),
-                                    static_cast<int32_t*>(arg2_tensor),
-                                    static_cast<float*>(out_tensor),
-                                    arg0_shape,
-                                    arg1_shape,
-                                    daxes);
-                            };
+                            functor = make_dequantize_functor<int32_t, float>(arg0_tensor,
+                                                                              arg1_tensor,
+                                                                              arg2_tensor,
+                                                                              out_tensor,
+                                                                              arg0_shape,
+                                                                              arg1_shape,
+                                                                              daxes);
                         }
                         else if (out[0].get_element_type() == element::f64)
                         {
-                            functor = [&, arg0_shape, arg1_shape, daxes](
-                                CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                                ngraph::runtime::reference::dequantize<int32_t>(
-                                    static_cast<int32_t*>(arg0_tensor),
-                                    static_cast<double*>(arg1_tensor),
-                                    static_cast<int32_t*>(arg2_tensor),
-                                    static_cast<double*>(out_tensor),
-                                    arg0_shape,
-                                    arg1_shape,
-                                    daxes);
-                            };
+                            functor = make_dequantize_functor<int32_t, double>(arg0_tensor,
+                                                                               arg1_tensor,
+                                                                               arg2_tensor,
+                                                                               out_tensor,
+                                                                               arg0_shape,
+                                                                               arg1_shape,
+                                                                               daxes);
                         }
                         else
                         {
@@ -319,48 +408,36 @@ namespace ngraph
                     {
                         if (out[0].get_element_type() == element::i8)
                         {
-                            functor = [&, arg0_shape, arg1_shape, daxes, round_mode](
-                                CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                                ngraph::runtime::reference::quantize<float>(
-                                    static_cast<float*>(arg0_tensor),
-                                    static_cast<float*>(arg1_tensor),
-                                    static_cast<int8_t*>(arg2_tensor),
-                                    static_cast<int8_t*>(out_tensor),
-                                    arg0_shape,
-                                    arg1_shape,
-                                    daxes,
-                                    round_mode);
-                            };
+                            functor = make_quantize_functor<float, int8_t>(arg0_tensor,
+                                                                           arg1_tensor,
+                                                                           arg2_tensor,
+                                                                           out_tensor,
+                                                                           arg0_shape,
+                                                                           arg1_shape,
+                                                                           daxes,
+                                                                           round_mode);
                         }
                         else if (out[0].get_element_type() == element::u8)
                         {
-                            functor = [&, arg0_shape, arg1_shape, daxes, round_mode](
-                                CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                                ngraph::runtime::reference::quantize<float>(
-                                    static_cast<float*>(arg0_tensor),
-                                    static_cast<float*>(arg1_tensor),
-                                    static_cast<uint8_t*>(arg2_tensor),
-                                    static_cast<uint8_t*>(out_tensor),
-                                    arg0_shape,
-                                    arg1_shape,
-                                    daxes,
-                                    round_mode);
-                            };
+                            functor = make_quantize_functor<float, uint8_t>(arg0_tensor,
+                                                                            arg1_tensor,
+                                                                            arg2_tensor,
+                                                                            out_tensor,
+                                                                            arg0_shape,
+                                                                            arg1_shape,
+                                                                            daxes,
+                                                                            round_mode);
                         }
                         else if (out[0].get_element_type() == element::i32)
                         {
-                            functor = [&, arg0_shape, arg1_shape, daxes, round_mode](
-                                CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                                ngraph::runtime::reference::quantize<float>(
-                                    static_cast<float*>(arg0_tensor),
-                                    static_cast<float*>(arg1_tensor),
-                                    static_cast<int32_t*>(arg2_tensor),
-                                    static_cast<int32_t*>(out_tensor),
-                                    arg0_shape,
-                                    arg1_shape,
-                                    daxes,
-                                    round_mode);
-                            };
+                            functor = make_quantize_functor<float, int32_t>(arg0_tensor,
+                                                                            arg1_tensor,
+                                                                            arg2_tensor,
+                                                                            out_tensor,
+                                                                            arg0_shape,
+                                                                            arg1_shape,
+                                                                            daxes,
+                                                                            round_mode);
                         }
                         else
                         {
@@ -371,48 +448,36 @@ namespace ngraph
                     {
                         if (out[0].get_element_type() == element::i8)
                         {
-                            functor = [&, arg0_shape, arg1_shape, daxes, round_mode](
-                                CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                                ngraph::runtime::reference::quantize<double>(
-                                    static_cast<double*>(arg0_tensor),
-                                    static_cast<double*>(arg1_tensor),
-                                    static_cast<int8_t*>(arg2_tensor),
-                                    static_cast<int8_t*>(out_tensor),
-                                    arg0_shape,
-                                    arg1_shape,
-                                    daxes,
-                                    round_mode);
-                            };
+                            functor = make_quantize_functor<double, int8_t>(arg0_tensor,
+                                                                            arg1_tensor,
+                                                                            arg2_tensor,
+                                                                            out_tensor,
+                                                                            arg0_shape,
+                                                                            arg1_shape,
+                                                                            daxes,
+                                                                            round_mode);
                         }
                         else if (out[0].get_element_type() == element::u8)
                         {
-                            functor = [&, arg0_shape, arg1_shape, daxes, round_mode](
-                                CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                                ngraph::runtime::reference::quantize<double>(
-                                    static_cast<double*>(arg0_tensor),
-                                    static_cast<double*>(arg1_tensor),
-                                    static_cast<uint8_t*>(arg2_tensor),
-                                    static_cast<uint8_t*>(out_tensor),
-                                    arg0_shape,
-                                    arg1_shape,
-                                    daxes,
-                                    round_mode);
-                            };
+                            functor = make_quantize_functor<double, uint8_t>(arg0_tensor,
+                                                                             arg1_tensor,
+                                                                             arg2_tensor,
+                                                                             out_tensor,
+                                                                             arg0_shape,
+                                                                             arg1_shape,
+                                                                             daxes,
+                                                                             round_mode);
                         }
                         else if (out[0].get_element_type() == element::i32)
                         {
-                            functor = [&, arg0_shape, arg1_shape, daxes, round_mode](
-                                CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                                ngraph::runtime::reference::quantize<double>(
-                                    static_cast<double*>(arg0_tensor),
-                                    static_cast<double*>(arg1_tensor),
-                                    static_cast<int32_t*>(arg2_tensor),
-                                    static_cast<int32_t*>(out_tensor),
-                                    arg0_shape,
-                                    arg1_shape,
-                                    daxes,
-                                    round_mode);
-                            };
+                            functor = make_quantize_functor<double, int32_t>(arg0_tensor,
+                                                                             arg1_tensor,
+                                                                             arg2_tensor,
+                                                                             out_tensor,
+                                                                             arg0_shape,
+                                                                             arg1_shape,
+                                                                             daxes,
+                                                                             round_mode);
                         }
                         else
                         {
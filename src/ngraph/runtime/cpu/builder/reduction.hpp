@@ -14,6 +14,10 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <sstream>
+
+#include "ngraph/runtime/cpu/cpu_kernel_tuner.hpp"
+
 #define BUILD_REDUCTION_FUNCTOR(OP, K)                                                             \
     auto& functors = external_function->get_functors();                                            \
                                                                                                    \
@@ -40,90 +44,83 @@
         return;                                                                                    \
     }                                                                                              \
                                                                                                    \
+    std::function<decltype(runtime::cpu::kernel::K<float>)> ref_kernel;                            \
+                                                                                                   \
+    SELECT_KERNEL(ref_kernel, result_element_type, runtime::cpu::kernel::K);                       \
+                                                                                                   \
+    auto ref_functor = [&, ref_kernel, arg_shape, result_shape, reduction_axes](                   \
+        CPURuntimeContext* ctx, CPUExecutionContext* ectx) {                                       \
+        ref_kernel(arg_tensor, out_tensor, arg_shape, result_shape, reduction_axes, ectx->arena);  \
+    };                                                                                             \
+                                                                                                   \
+    /* Eigen kernel for the reduction axes, tuned against the reference one */                     \
+    CPUKernelFunctor functor;                                                                      \
     if (reduction_axes.size() == arg_rank)                                                         \
     {                                                                                              \
         std::function<decltype(runtime::cpu::kernel::reduce_##K##_all<float, 2>)> kernel;          \
         SELECT_KERNEL_BY_RANK(                                                                     \
             kernel, result_element_type, arg_rank, runtime::cpu::kernel::reduce_##K##_all);        \
-        auto functor = [&, kernel, arg_shape, result_shape](CPURuntimeContext* ctx,                \
-                                                            CPUExecutionContext* ectx) {           \
+        functor = [&, kernel, arg_shape, result_shape](CPURuntimeContext* ctx,                     \
+                                                       CPUExecutionContext* ectx) {                \
             kernel(arg_tensor, out_tensor, arg_shape, result_shape, ectx->arena);                  \
         };                                                                                         \
-        functors.emplace_back(functor);                                                            \
-        return;                                                                                    \
     }                                                                                              \
-                                                                                                   \
-    if (reduction_axes.size() == 1)                                                                \
+    else if (reduction_axes.size() == 1 && *reduction_axes.begin() == arg_rank - 1)                \
+    {                                                                                              \
+        std::function<decltype(runtime::cpu::kernel::reduce_##K##_innermost_1rd<float, 2>)>        \
+            kernel;                                                                                \
+        SELECT_KERNEL_BY_RANK(kernel,                                                              \
+                              result_element_type,                                                 \
+                              arg_rank,                                                            \
+                              runtime::cpu::kernel::reduce_##K##_innermost_1rd);                   \
+        functor = [&, kernel, arg_shape, result_shape](CPURuntimeContext* ctx,                     \
+                                                       CPUExecutionContext* ectx) {                \
+            kernel(arg_tensor, out_tensor, arg_shape, result_shape, ectx->arena);                  \
+        };                                                                                         \
+    }                                                                                              \
+    else if (reduction_axes.size() == 1)                                                           \
     {                                                                                              \
-        if (*reduction_axes.begin() == arg_rank - 1)                                               \
-        {                                                                                          \
-            std::function<decltype(runtime::cpu::kernel::reduce_##K##_innermost_1rd<float, 2>)>    \
-                kernel;                                                                            \
-            SELECT_KERNEL_BY_RANK(kernel,                                                          \
-                                  result_element_type,                                             \
-                                  arg_rank,                                                        \
-                                  runtime::cpu::kernel::reduce_##K##_innermost_1rd);               \
-            auto functor = [&, kernel, arg_shape, result_shape](CPURuntimeContext* ctx,            \
-                                                                CPUExecutionContext* ectx) {       \
-                kernel(arg_tensor, out_tensor, arg_shape, result_shape, ectx->arena);              \
-            };                                                                                     \
-            functors.emplace_back(functor);                                                        \
-            return;                                                                                \
-        }                                                                                          \
-                                                                                                   \
         std::function<decltype(runtime::cpu::kernel::reduce_##K##_1rd<float, 2>)> kernel;          \
         SELECT_KERNEL_BY_RANK(                                                                     \
             kernel, result_element_type, arg_rank, runtime::cpu::kernel::reduce_##K##_1rd);        \
-        auto functor = [&, kernel, arg_shape, result_shape, reduction_axes](                       \
+        functor = [&, kernel, arg_shape, result_shape, reduction_axes](                            \
             CPURuntimeContext* ctx, CPUExecutionContext* ectx) {                                   \
             kernel(arg_tensor, out_tensor, arg_shape, result_shape, reduction_axes, ectx->arena);  \
         };                                                                                         \
-        functors.emplace_back(functor);                                                            \
-        return;                                                                                    \
     }                                                                                              \
-                                                                                                   \
-    if (reduction_axes.size() == 2 && arg_rank == 3)                                               \
+    else if (reduction_axes.size() == 2 && arg_rank >= 3 && arg_rank <= 5)                         \
     {                                                                                              \
         std::function<decltype(runtime::cpu::kernel::reduce_##K##_3d_2rd<float>)> kernel;          \
-        SELECT_KERNEL(kernel, result_element_type, runtime::cpu::kernel::reduce_##K##_3d_2rd);     \
-        auto functor = [&, kernel, arg_shape, result_shape, reduction_axes](                       \
-            CPURuntimeContext* ctx, CPUExecutionContext* ectx) {                                   \
-            kernel(arg_tensor, out_tensor, arg_shape, result_shape, reduction_axes, ectx->arena);  \
-        };                                                                                         \
-        functors.emplace_back(functor);                                                            \
-        return;                                                                                    \
-    }                                                                                              \
-                                                                                                   \
-    if (reduction_axes.size() == 2 && arg_rank == 4)                                               \
-    {                                                                                              \
-        std::function<decltype(runtime::cpu::kernel::reduce_##K##_4d_2rd<float>)> kernel;          \
-        SELECT_KERNEL(kernel, result_element_type, runtime::cpu::kernel::reduce_##K##_4d_2rd);     \
-        auto functor = [&, kernel, arg_shape, result_shape, reduction_axes](                       \
+        if (arg_rank == 3)                                                                         \
+        {                                                                                          \
+            SELECT_KERNEL(kernel, result_element_type, runtime::cpu::kernel::reduce_##K##_3d_2rd); \
+        }                                                                                          \
+        else if (arg_rank == 4)                                                                    \
+        {                                                                                          \
+            SELECT_KERNEL(kernel, result_element_type, runtime::cpu::kernel::reduce_##K##_4d_2rd); \
+        }                                                                                          \
+        else                                                                                       \
+        {                                                                                          \
+            SELECT_KERNEL(kernel, result_element_type, runtime::cpu::kernel::reduce_##K##_5d_2rd); \
+        }                                                                                          \
+        functor = [&, kernel, arg_shape, result_shape, reduction_axes](                            \
             CPURuntimeContext* ctx, CPUExecutionContext* ectx) {                                   \
             kernel(arg_tensor, out_tensor, arg_shape, result_shape, reduction_axes, ectx->arena);  \
         };                                                                                         \
-        functors.emplace_back(functor);                                                            \
-        return;                                                                                    \
     }                                                                                              \
                                                                                                    \
-    if (reduction_axes.size() == 2 && arg_rank == 5)                                               \
+    if (!functor)                                                                                  \
     {                                                                                              \
-        std::function<decltype(runtime::cpu::kernel::reduce_##K##_5d_2rd<float>)> kernel;          \
-        SELECT_KERNEL(kernel, result_element_type, runtime::cpu::kernel::reduce_##K##_5d_2rd);     \
-        auto functor = [&, kernel, arg_shape, result_shape, reduction_axes](                       \
-            CPURuntimeContext* ctx, CPUExecutionContext* ectx) {                                   \
-            kernel(arg_tensor, out_tensor, arg_shape, result_shape, reduction_axes, ectx->arena);  \
-        };                                                                                         \
-        functors.emplace_back(functor);                                                            \
+        functors.emplace_back(ref_functor);                                                        \
         return;                                                                                    \
     }                                                                                              \
                                                                                                    \
-    std::function<decltype(runtime::cpu::kernel::K<float>)> ref_kernel;                            \
-                                                                                                   \
-    SELECT_KERNEL(ref_kernel, result_element_type, runtime::cpu::kernel::K);                       \
-                                                                                                   \
-    auto functor = [&, ref_kernel, arg_shape, result_shape, reduction_axes](                       \
-        CPURuntimeContext* ctx, CPUExecutionContext* ectx) {                                       \
-        ref_kernel(arg_tensor, out_tensor, arg_shape, result_shape, reduction_axes, ectx->arena);  \
-    };                                                                                             \
-    functors.emplace_back(functor);
+    std::stringstream attributes;                                                                  \
+    attributes << reduction_axes;                                                                  \
+    functors.emplace_back(CPUKernelTuner::get().select(                                            \
+        external_function,                                                                         \
+        node,                                                                                      \
+        args,                                                                                      \
+        out,                                                                                       \
+        attributes.str(),                                                                          \
+        {{"eigen", functor}, {"reference", ref_functor}}));
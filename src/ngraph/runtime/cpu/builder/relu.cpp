@@ -17,6 +17,7 @@
 #include "ngraph/runtime/cpu/kernel/relu.hpp"
 #include "ngraph/op/relu.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/bfloat16.hpp"
 #include "ngraph/runtime/cpu/mkldnn_invoke.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 
@@ -57,6 +58,10 @@ namespace ngraph
                     };
                     functors.emplace_back(functor);
                 }
+                else if (args[0].get_element_type() == element::bf16)
+                {
+                    BUILD_BF16_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::bf16_ops::relu);
+                }
                 else
                 {
                     BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::relu);
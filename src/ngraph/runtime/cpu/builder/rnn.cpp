@@ -14,14 +14,334 @@
 // limitations under the License.
 //*****************************************************************************
 
-#include "ngraph/runtime/cpu/op/rnn.hpp"
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <numeric>
+
+#include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/cpu/cpu_external_function.hpp"
 #include "ngraph/runtime/cpu/mkldnn_invoke.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
+#include "ngraph/runtime/cpu/op/rnn.hpp"
 
 using namespace std;
 using namespace ngraph;
 
+namespace
+{
+    // Runs an Rnn with per-sample sequence lengths. Samples are sorted by decreasing length so
+    // the samples still running at any timestep are a prefix of the batch. The timesteps are
+    // split into segments over which that prefix does not change, and each segment runs as a
+    // left to right MKLDNN rnn over just the running samples, so padding is never computed. The
+    // right to left direction gathers the valid timesteps of each sample in reverse and runs the
+    // same way.
+    //
+    // The staging buffers and the segment primitives, which are bound to their memory primitives,
+    // are shared by all call contexts of the executable, so calls run one at a time.
+    class VariableLengthRnn
+    {
+    public:
+        VariableLengthRnn(const ngraph::op::Rnn* rnn)
+            : m_element_type(rnn->get_input_element_type(0))
+            , m_length_type(rnn->get_input_element_type(5))
+            , m_max_steps(rnn->get_src_sequence_length())
+            , m_batch(rnn->get_batch_size())
+            , m_slc(rnn->get_src_layer_feature_size())
+            , m_sic(rnn->get_src_iter_feature_size())
+            , m_gates(rnn->get_gates_per_cell())
+            , m_states(rnn->get_num_cell_states())
+            , m_layers(rnn->get_num_fused_layers())
+            , m_directions(rnn->get_direction())
+        {
+            switch (rnn->get_rnn_type())
+            {
+            case runtime::cpu::rnn_utils::rnntype::vanilla_rnn:
+                m_algorithm = mkldnn::algorithm::vanilla_rnn;
+                break;
+            case runtime::cpu::rnn_utils::rnntype::vanilla_gru:
+                m_algorithm = mkldnn::algorithm::vanilla_gru;
+                break;
+            case runtime::cpu::rnn_utils::rnntype::vanilla_lstm:
+                m_algorithm = mkldnn::algorithm::vanilla_lstm;
+                break;
+            default: throw ngraph_error("unsupported mkldnn rnn algorithm");
+            }
+
+            size_t alignment = runtime::cpu::CPU_ExternalFunction::s_memory_pool_alignment;
+            size_t es = m_element_type.size();
+            size_t iter_size = m_layers * m_states * m_batch * m_sic * es;
+            m_src.reset(new runtime::AlignedBuffer(m_max_steps * m_batch * m_slc * es, alignment));
+            m_dst.reset(new runtime::AlignedBuffer(m_max_steps * m_batch * m_sic * es, alignment));
+            m_src_iter.reset(new runtime::AlignedBuffer(iter_size, alignment));
+            m_dst_iter.reset(new runtime::AlignedBuffer(iter_size, alignment));
+            m_state.reset(new runtime::AlignedBuffer(iter_size, alignment));
+        }
+
+        void operator()(const char* src_layer,
+                        const char* src_iter,
+                        const char* weights_layer,
+                        const char* weights_iter,
+                        const char* bias,
+                        const void* sequence_lengths,
+                        char* dst_layer,
+                        char* dst_iter)
+        {
+            lock_guard<mutex> lock(m_mutex);
+            vector<size_t> lengths(m_batch);
+            for (size_t n = 0; n < m_batch; n++)
+            {
+                int64_t length = m_length_type == element::i32
+                                     ? static_cast<const int32_t*>(sequence_lengths)[n]
+                                     : static_cast<const int64_t*>(sequence_lengths)[n];
+                lengths[n] = static_cast<size_t>(
+                    std::min<int64_t>(std::max<int64_t>(length, 0), m_max_steps));
+            }
+            vector<size_t> order(m_batch);
+            iota(order.begin(), order.end(), 0);
+            stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+                return lengths[a] > lengths[b];
+            });
+
+            size_t es = m_element_type.size();
+            size_t row = m_sic * es;
+            memset(dst_layer, 0, m_max_steps * m_batch * m_directions * row);
+            auto state = static_cast<char*>(m_state->get_ptr());
+            auto segment_src = static_cast<char*>(m_src->get_ptr());
+            auto segment_dst = static_cast<char*>(m_dst->get_ptr());
+            auto segment_src_iter = static_cast<char*>(m_src_iter->get_ptr());
+            auto segment_dst_iter = static_cast<char*>(m_dst_iter->get_ptr());
+
+            for (size_t d = 0; d < m_directions; d++)
+            {
+                // Offset of sample n of state s of layer l in the ldsnc state of direction d
+                auto iter_offset = [&](size_t l, size_t s, size_t n) {
+                    return (((l * m_directions + d) * m_states + s) * m_batch + n) * row;
+                };
+                for (size_t l = 0; l < m_layers; l++)
+                {
+                    for (size_t s = 0; s < m_states; s++)
+                    {
+                        for (size_t i = 0; i < m_batch; i++)
+                        {
+                            memcpy(state + ((l * m_states + s) * m_batch + i) * row,
+                                   src_iter + iter_offset(l, s, order[i]),
+                                   row);
+                        }
+                    }
+                }
+
+                // With a single layer or direction the weights of a direction are contiguous
+                auto direction_weights_layer = weights_layer + d * m_slc * m_gates * row;
+                auto direction_weights_iter = weights_iter + d * m_sic * m_gates * row;
+                auto direction_bias = bias + d * m_gates * row;
+                auto time_step = [&](size_t t, size_t n) {
+                    return d == 0 ? t : lengths[n] - 1 - t;
+                };
+
+                size_t running = m_batch;
+                for (size_t t = 0;;)
+                {
+                    while (running > 0 && lengths[order[running - 1]] <= t)
+                    {
+                        running--;
+                    }
+                    if (running == 0)
+                    {
+                        break;
+                    }
+                    size_t steps = lengths[order[running - 1]] - t;
+
+                    for (size_t step = 0; step < steps; step++)
+                    {
+                        for (size_t i = 0; i < running; i++)
+                        {
+                            size_t n = order[i];
+                            memcpy(segment_src + (step * running + i) * m_slc * es,
+                                   src_layer + (time_step(t + step, n) * m_batch + n) * m_slc * es,
+                                   m_slc * es);
+                        }
+                    }
+                    for (size_t ls = 0; ls < m_layers * m_states; ls++)
+                    {
+                        memcpy(segment_src_iter + ls * running * row,
+                               state + ls * m_batch * row,
+                               running * row);
+                    }
+
+                    auto& segment = get_segment(steps, running);
+                    segment.src_layer.set_data_handle(segment_src);
+                    segment.src_iter.set_data_handle(segment_src_iter);
+                    segment.weights_layer.set_data_handle(
+                        const_cast<char*>(direction_weights_layer));
+                    segment.weights_iter.set_data_handle(const_cast<char*>(direction_weights_iter));
+                    segment.bias.set_data_handle(const_cast<char*>(direction_bias));
+                    segment.dst_layer.set_data_handle(segment_dst);
+                    segment.dst_iter.set_data_handle(segment_dst_iter);
+                    segment.workspace.set_data_handle(segment.workspace_buffer->get_ptr());
+                    mkldnn::stream st(mkldnn::stream::kind::eager);
+                    try
+                    {
+                        st.submit({segment.rnn}).wait();
+                    }
+                    catch (const mkldnn::error& e)
+                    {
+                        throw ngraph_error("Could not run mkdnn primitive " + e.message);
+                    }
+
+                    for (size_t step = 0; step < steps; step++)
+                    {
+                        for (size_t i = 0; i < running; i++)
+                        {
+                            size_t n = order[i];
+                            size_t dst_row = (time_step(t + step, n) * m_batch + n) * m_directions;
+                            memcpy(dst_layer + (dst_row + d) * row,
+                                   segment_dst + (step * running + i) * row,
+                                   row);
+                        }
+                    }
+                    for (size_t ls = 0; ls < m_layers * m_states; ls++)
+                    {
+                        memcpy(state + ls * m_batch * row,
+                               segment_dst_iter + ls * running * row,
+                               running * row);
+                    }
+                    t += steps;
+                }
+
+                // Samples keep the state of their last valid timestep
+                for (size_t l = 0; l < m_layers; l++)
+                {
+                    for (size_t s = 0; s < m_states; s++)
+                    {
+                        for (size_t i = 0; i < m_batch; i++)
+                        {
+                            memcpy(dst_iter + iter_offset(l, s, order[i]),
+                                   state + ((l * m_states + s) * m_batch + i) * row,
+                                   row);
+                        }
+                    }
+                }
+            }
+        }
+
+    private:
+        struct Segment
+        {
+            Segment(const mkldnn::rnn_forward::primitive_desc& pd,
+                    const vector<mkldnn::memory::desc>& mds)
+                : src_layer({mds[0], runtime::cpu::executor::global_cpu_engine}, nullptr)
+                , src_iter({mds[1], runtime::cpu::executor::global_cpu_engine}, nullptr)
+                , weights_layer({mds[2], runtime::cpu::executor::global_cpu_engine}, nullptr)
+                , weights_iter({mds[3], runtime::cpu::executor::global_cpu_engine}, nullptr)
+                , bias({mds[4], runtime::cpu::executor::global_cpu_engine}, nullptr)
+                , dst_layer({mds[5], runtime::cpu::executor::global_cpu_engine}, nullptr)
+                , dst_iter({mds[6], runtime::cpu::executor::global_cpu_engine}, nullptr)
+                , workspace(pd.workspace_primitive_desc(), nullptr)
+                , workspace_buffer(new runtime::AlignedBuffer(
+                      pd.workspace_primitive_desc().get_size(),
+                      runtime::cpu::CPU_ExternalFunction::s_memory_pool_alignment))
+                , rnn(pd,
+                      src_layer,
+                      src_iter,
+                      weights_layer,
+                      weights_iter,
+                      bias,
+                      dst_layer,
+                      dst_iter,
+                      workspace)
+            {
+            }
+
+            mkldnn::memory src_layer;
+            mkldnn::memory src_iter;
+            mkldnn::memory weights_layer;
+            mkldnn::memory weights_iter;
+            mkldnn::memory bias;
+            mkldnn::memory dst_layer;
+            mkldnn::memory dst_iter;
+            mkldnn::memory workspace;
+            unique_ptr<runtime::AlignedBuffer> workspace_buffer;
+            mkldnn::rnn_forward rnn;
+        };
+
+        // Primitives are built for the (steps, batch) shapes of the segments seen so far
+        Segment& get_segment(size_t steps, size_t batch)
+        {
+            auto key = make_pair(steps, batch);
+            auto it = m_segments.find(key);
+            if (it != m_segments.end())
+            {
+                return *it->second;
+            }
+            if (m_segments.size() >= s_max_segments)
+            {
+                m_segments.clear();
+            }
+
+            auto et = runtime::cpu::mkldnn_utils::get_mkldnn_data_type(m_element_type);
+            auto md = [&](const mkldnn::memory::dims& dims, mkldnn::memory::format format) {
+                return mkldnn::memory::desc(dims, et, format);
+            };
+            int l = static_cast<int>(m_layers);
+            int t = static_cast<int>(steps);
+            int n = static_cast<int>(batch);
+            int slc = static_cast<int>(m_slc);
+            int sic = static_cast<int>(m_sic);
+            int g = static_cast<int>(m_gates);
+            int s = static_cast<int>(m_states);
+            vector<mkldnn::memory::desc> mds{md({t, n, slc}, mkldnn::memory::format::tnc),
+                                             md({l, 1, s, n, sic}, mkldnn::memory::format::ldsnc),
+                                             md({l, 1, slc, g, sic}, mkldnn::memory::format::ldigo),
+                                             md({l, 1, sic, g, sic}, mkldnn::memory::format::ldigo),
+                                             md({l, 1, g, sic}, mkldnn::memory::format::ldgo),
+                                             md({t, n, sic}, mkldnn::memory::format::tnc),
+                                             md({l, 1, s, n, sic}, mkldnn::memory::format::ldsnc)};
+            mkldnn::rnn_cell::desc cell(m_algorithm);
+            mkldnn::rnn_forward::desc desc(mkldnn::prop_kind::forward_training,
+                                           cell,
+                                           mkldnn::rnn_direction::unidirectional_left2right,
+                                           mds[0],
+                                           mds[1],
+                                           mds[2],
+                                           mds[3],
+                                           mds[4],
+                                           mds[5],
+                                           mds[6]);
+            mkldnn::rnn_forward::primitive_desc pd(desc,
+                                                   runtime::cpu::executor::global_cpu_engine);
+            unique_ptr<Segment> segment(new Segment(pd, mds));
+            auto& result = *segment;
+            m_segments[key] = move(segment);
+            return result;
+        }
+
+        static const size_t s_max_segments = 256;
+
+        element::Type m_element_type;
+        element::Type m_length_type;
+        mkldnn::algorithm m_algorithm;
+        size_t m_max_steps;
+        size_t m_batch;
+        size_t m_slc;
+        size_t m_sic;
+        size_t m_gates;
+        size_t m_states;
+        size_t m_layers;
+        size_t m_directions;
+        unique_ptr<runtime::AlignedBuffer> m_src;
+        unique_ptr<runtime::AlignedBuffer> m_dst;
+        unique_ptr<runtime::AlignedBuffer> m_src_iter;
+        unique_ptr<runtime::AlignedBuffer> m_dst_iter;
+        unique_ptr<runtime::AlignedBuffer> m_state;
+        map<pair<size_t, size_t>, unique_ptr<Segment>> m_segments;
+        mutex m_mutex;
+    };
+}
+
 namespace ngraph
 {
     namespace runtime
@@ -40,6 +360,35 @@ namespace ngraph
 
                 auto& functors = external_function->get_functors();
 
+                if (static_cast<const ngraph::op::Rnn*>(node)->has_sequence_lengths())
+                {
+                    auto& src_layer_tensor = external_function->get_tensor_data(args[0].get_name());
+                    auto& src_iter_tensor = external_function->get_tensor_data(args[1].get_name());
+                    auto& weights_layer_tensor =
+                        external_function->get_tensor_data(args[2].get_name());
+                    auto& weights_iter_tensor =
+                        external_function->get_tensor_data(args[3].get_name());
+                    auto& bias_tensor = external_function->get_tensor_data(args[4].get_name());
+                    auto& lengths_tensor = external_function->get_tensor_data(args[5].get_name());
+                    auto& dst_layer_tensor = external_function->get_tensor_data(out[0].get_name());
+                    auto& dst_iter_tensor = external_function->get_tensor_data(out[1].get_name());
+
+                    auto kernel = std::make_shared<VariableLengthRnn>(
+                        static_cast<const ngraph::op::Rnn*>(node));
+                    auto functor = [&, kernel](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        (*kernel)(static_cast<const char*>(src_layer_tensor),
+                                  static_cast<const char*>(src_iter_tensor),
+                                  static_cast<const char*>(weights_layer_tensor),
+                                  static_cast<const char*>(weights_iter_tensor),
+                                  static_cast<const char*>(bias_tensor),
+                                  lengths_tensor,
+                                  static_cast<char*>(dst_layer_tensor),
+                                  static_cast<char*>(dst_iter_tensor));
+                    };
+                    functors.emplace_back(functor);
+                    return;
+                }
+
                 auto& src_layer_tensor = external_function->get_tensor_data(args[0].get_name());
                 auto& src_iter_tensor = external_function->get_tensor_data(args[1].get_name());
                 auto& weights_layer_tensor = external_function->get_tensor_data(args[2].get_name());
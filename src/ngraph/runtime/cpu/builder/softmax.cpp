@@ -16,6 +16,7 @@
 
 #include "ngraph/op/softmax.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/cpu_kernel_tuner.hpp"
 #include "ngraph/runtime/cpu/kernel/softmax.hpp"
 #include "ngraph/runtime/cpu/mkldnn_invoke.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
@@ -66,6 +67,9 @@ namespace ngraph
                 }
                 else
                 {
+                    // The kernel for the axes comes first, then the alternatives it is tuned
+                    // against
+                    vector<CPUKernelTuner::Candidate> candidates;
                     if (axes.size() == arg_shape.size())
                     {
                         std::function<decltype(runtime::cpu::kernel::softmax_all<float, 1>)> kernel;
@@ -79,7 +83,7 @@ namespace ngraph
                                                               CPUExecutionContext* ectx) {
                             kernel(arg_tensor, out_tensor, arg_shape, ectx->arena);
                         };
-                        functors.emplace_back(functor);
+                        candidates.push_back({"all", functor});
                     }
                     else if (axes.size() == 1)
                     {
@@ -99,24 +103,22 @@ namespace ngraph
                                                                   CPUExecutionContext* ectx) {
                                 kernel(arg_tensor, out_tensor, arg_shape, ectx->arena);
                             };
-                            functors.emplace_back(functor);
+                            candidates.push_back({"innermost_1rd", functor});
                         }
-                        else
-                        {
-                            std::function<decltype(runtime::cpu::kernel::softmax_1rd<float, 1>)>
-                                kernel;
 
-                            PARTIAL_SELECT_KERNEL_BY_RANK(kernel,
-                                                          args[0].get_element_type(),
-                                                          args[0].get_shape().size(),
-                                                          runtime::cpu::kernel::softmax_1rd);
+                        std::function<decltype(runtime::cpu::kernel::softmax_1rd<float, 1>)>
+                            kernel;
 
-                            auto functor = [&, kernel, arg_shape, axes](CPURuntimeContext* ctx,
-                                                                        CPUExecutionContext* ectx) {
-                                kernel(arg_tensor, out_tensor, arg_shape, axes, ectx->arena);
-                            };
-                            functors.emplace_back(functor);
-                        }
+                        PARTIAL_SELECT_KERNEL_BY_RANK(kernel,
+                                                      args[0].get_element_type(),
+                                                      args[0].get_shape().size(),
+                                                      runtime::cpu::kernel::softmax_1rd);
+
+                        auto functor = [&, kernel, arg_shape, axes](CPURuntimeContext* ctx,
+                                                                    CPUExecutionContext* ectx) {
+                            kernel(arg_tensor, out_tensor, arg_shape, axes, ectx->arena);
+                        };
+                        candidates.push_back({"1rd", functor});
                     }
                     else if (arg_shape.size() == 3 && axes.size() == 2)
                     {
@@ -130,7 +132,7 @@ namespace ngraph
                                                                     CPUExecutionContext* ectx) {
                             kernel(arg_tensor, out_tensor, arg_shape, axes, ectx->arena);
                         };
-                        functors.emplace_back(functor);
+                        candidates.push_back({"3d_2rd", functor});
                     }
                     else if (arg_shape.size() == 4 && axes.size() == 3)
                     {
@@ -144,12 +146,16 @@ namespace ngraph
                                                                     CPUExecutionContext* ectx) {
                             kernel(arg_tensor, out_tensor, arg_shape, axes, ectx->arena);
                         };
-                        functors.emplace_back(functor);
+                        candidates.push_back({"4d_3rd", functor});
                     }
-                    else if (softmax->get_element_type() == element::f32)
+
+                    if (softmax->get_element_type() == element::f32)
                     {
-                        NGRAPH_WARN << "Falling back to refernce kernel for softmax " << arg_shape
-                                    << " over " << axes;
+                        if (candidates.empty())
+                        {
+                            NGRAPH_WARN << "Falling back to refernce kernel for softmax "
+                                        << arg_shape << " over " << axes;
+                        }
                         auto functor = [&, arg_shape, axes](CPURuntimeContext* ctx,
                                                             CPUExecutionContext* ectx) {
                             runtime::reference::softmax<float>(static_cast<float*>(arg_tensor),
@@ -157,14 +163,20 @@ namespace ngraph
                                                                arg_shape,
                                                                axes);
                         };
-                        functors.emplace_back(functor);
+                        candidates.push_back({"reference", functor});
                     }
-                    else
+
+                    if (candidates.empty())
                     {
                         NGRAPH_ERR << "Unsupported Softmax " << arg_shape << " over " << axes
                                    << " in cpu buiilder";
                         throw ngraph_error("Unsupported Softmax");
                     }
+
+                    stringstream attributes;
+                    attributes << axes;
+                    functors.emplace_back(CPUKernelTuner::get().select(
+                        external_function, node, args, out, attributes.str(), candidates));
                 }
             }
 
@@ -18,6 +18,7 @@
 
 #include "ngraph/op/sum.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/bfloat16.hpp"
 #include "ngraph/runtime/cpu/kernel/reduce_sum.hpp"
 
 #include "reduction.hpp"
@@ -34,6 +35,27 @@ namespace ngraph
             template <>
             void Builder::BUILDER_DECL(ngraph::op::Sum)
             {
+                // bfloat16 sums are accumulated in float and rounded once
+                if (args[0].get_element_type() == element::bf16)
+                {
+                    auto& functors = external_function->get_functors();
+                    auto& arg_tensor = external_function->get_tensor_data(args[0].get_name());
+                    auto& out_tensor = external_function->get_tensor_data(out[0].get_name());
+
+                    auto arg_shape = args[0].get_shape();
+                    auto result_shape = out[0].get_shape();
+                    auto sum = static_cast<const ngraph::op::Sum*>(node);
+                    auto reduction_axes = sum->get_reduction_axes();
+
+                    auto functor = [&, arg_shape, result_shape, reduction_axes](
+                        CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        runtime::cpu::kernel::sum_bf16(
+                            arg_tensor, out_tensor, arg_shape, result_shape, reduction_axes);
+                    };
+                    functors.emplace_back(functor);
+                    return;
+                }
+
                 BUILD_REDUCTION_FUNCTOR(Sum, sum);
             }
 
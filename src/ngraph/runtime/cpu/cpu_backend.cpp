@@ -14,14 +14,18 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <cstring>
+
 #include <tbb/tbb_stddef.h>
 
 #include "cpu_backend_visibility.h"
 #include "ngraph/graph_util.hpp"
+#include "ngraph/op/constant.hpp"
 #include "ngraph/runtime/backend_manager.hpp"
 #include "ngraph/runtime/cpu/cpu_backend.hpp"
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
+#include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
 #include "ngraph/util.hpp"
 
@@ -116,6 +120,60 @@ std::shared_ptr<ngraph::runtime::cpu::CPU_CallFrame> runtime::cpu::CPU_Executabl
     return instance.m_call_frame;
 }
 
+void runtime::cpu::CPU_Executable::share_result_layout(
+    size_t index, const shared_ptr<op::Parameter>& parameter) const
+{
+    const FunctionInstance& instance = m_function_instance;
+    const auto& layouts = instance.m_external_function->get_result_layout_descriptors();
+    if (index >= layouts.size())
+    {
+        throw ngraph_error("Result index out of range when sharing its layout");
+    }
+    if (parameter->get_output_size() != 1)
+    {
+        throw ngraph_error("Only single-output parameters can take a result layout");
+    }
+
+    auto& tv = parameter->get_output_tensor(0);
+    auto layout = make_shared<LayoutDescriptor>(tv);
+    if (layouts[index]->is_mkldnn_layout())
+    {
+        layout->set_mkldnn_md(layouts[index]->get_mkldnn_md());
+    }
+    tv.set_tensor_layout(layout);
+}
+
+void runtime::cpu::CPU_Executable::set_scheduling(ExecutionPriority priority, int core_budget)
+{
+    m_function_instance.m_external_function->set_scheduling(priority, core_budget);
+}
+
+void runtime::cpu::CPU_Executable::warmup(bool lock_memory)
+{
+    vector<shared_ptr<runtime::Tensor>> inputs;
+    for (const auto& parameter : get_parameters())
+    {
+        auto tv = make_shared<CPUTensorView>(
+            parameter->get_element_type(), parameter->get_shape(), nullptr);
+        // Ones rather than zeros, so that integer divisions by an input do not trap
+        const element::Type& type = parameter->get_element_type();
+        auto one = make_shared<op::Constant>(type, Shape{}, vector<int>{1});
+        size_t element_size = type.size();
+        for (size_t offset = 0; offset < tv->get_size_in_bytes(); offset += element_size)
+        {
+            memcpy(tv->get_data_ptr() + offset, one->get_data_ptr(), element_size);
+        }
+        inputs.push_back(tv);
+    }
+    vector<shared_ptr<runtime::Tensor>> outputs;
+    for (const auto& result : get_results())
+    {
+        outputs.push_back(
+            make_shared<CPUTensorView>(result->get_element_type(), result->get_shape(), nullptr));
+    }
+    m_function_instance.m_call_frame->warmup(outputs, inputs, lock_memory);
+}
+
 bool runtime::cpu::CPU_Executable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
                                         const vector<shared_ptr<runtime::Tensor>>& inputs)
 {
@@ -20,6 +20,7 @@
 #include <memory>
 
 #include "cpu_backend_visibility.h"
+#include "ngraph/op/parameter.hpp"
 #include "ngraph/pass/pass_config.hpp"
 #include "ngraph/runtime/backend.hpp"
 
@@ -31,6 +32,7 @@ namespace ngraph
         {
             class CPU_ExternalFunction;
             class CPU_CallFrame;
+            enum class ExecutionPriority;
 
             class CPU_BACKEND_API CPU_Backend : public runtime::Backend
             {
@@ -78,6 +80,26 @@ namespace ngraph
 
                 std::shared_ptr<CPU_CallFrame> get_call_frame();
 
+                /// \brief Pins the layout chosen for result `index` of this executable on the
+                ///        output tensor of `parameter`.
+                ///
+                /// Call this before compiling the consuming function. Its executable then takes
+                /// the result tensor as is, including MKLDNN blocked layouts, instead of
+                /// converting it to the default layout at the boundary and back again inside.
+                void share_result_layout(size_t index,
+                                         const std::shared_ptr<op::Parameter>& parameter) const;
+
+                /// \brief Schedules the calls of this executable against those of the other
+                ///        executables in the process.
+                ///
+                /// Calls wait at op boundaries while calls of higher priority use the cores,
+                /// so low-priority work only runs on cores left idle. Each op runs on at most
+                /// `core_budget` cores, or on all cores of the executable's thread pool when
+                /// the budget is 0.
+                void set_scheduling(ExecutionPriority priority, int core_budget = 0);
+
+                void warmup(bool lock_memory = false) override;
+
                 std::vector<PerformanceCounter> get_performance_data() const override;
 
             private:
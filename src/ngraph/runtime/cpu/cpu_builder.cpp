@@ -68,6 +68,7 @@
 #include "ngraph/runtime/cpu/kernel/and.hpp"
 #include "ngraph/runtime/cpu/kernel/asin.hpp"
 #include "ngraph/runtime/cpu/kernel/atan.hpp"
+#include "ngraph/runtime/cpu/kernel/bfloat16.hpp"
 #include "ngraph/runtime/cpu/kernel/broadcast.hpp"
 #include "ngraph/runtime/cpu/kernel/ceil.hpp"
 #include "ngraph/runtime/cpu/kernel/cos.hpp"
@@ -120,19 +121,40 @@ namespace ngraph
             template <>
             void Builder::BUILDER_DECL(ngraph::op::Subtract)
             {
-                BUILD_BINARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::subtract);
+                if (args[0].get_element_type() == element::bf16)
+                {
+                    BUILD_BF16_BINARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::bf16_ops::subtract);
+                }
+                else
+                {
+                    BUILD_BINARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::subtract);
+                }
             }
 
             template <>
             void Builder::BUILDER_DECL(ngraph::op::Multiply)
             {
-                BUILD_BINARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::multiply);
+                if (args[0].get_element_type() == element::bf16)
+                {
+                    BUILD_BF16_BINARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::bf16_ops::multiply);
+                }
+                else
+                {
+                    BUILD_BINARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::multiply);
+                }
             }
 
             template <>
             void Builder::BUILDER_DECL(ngraph::op::Divide)
             {
-                BUILD_BINARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::divide);
+                if (args[0].get_element_type() == element::bf16)
+                {
+                    BUILD_BF16_BINARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::bf16_ops::divide);
+                }
+                else
+                {
+                    BUILD_BINARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::divide);
+                }
             }
 
             template <>
@@ -210,12 +232,26 @@ namespace ngraph
             template <>
             void Builder::BUILDER_DECL(ngraph::op::Maximum)
             {
-                BUILD_BINARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::maximum);
+                if (args[0].get_element_type() == element::bf16)
+                {
+                    BUILD_BF16_BINARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::bf16_ops::maximum);
+                }
+                else
+                {
+                    BUILD_BINARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::maximum);
+                }
             }
             template <>
             void Builder::BUILDER_DECL(ngraph::op::Minimum)
             {
-                BUILD_BINARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::minimum);
+                if (args[0].get_element_type() == element::bf16)
+                {
+                    BUILD_BF16_BINARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::bf16_ops::minimum);
+                }
+                else
+                {
+                    BUILD_BINARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::minimum);
+                }
             }
 
             template <>
@@ -275,7 +311,14 @@ namespace ngraph
             template <>
             void Builder::BUILDER_DECL(ngraph::op::Negative)
             {
-                BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::negative);
+                if (args[0].get_element_type() == element::bf16)
+                {
+                    BUILD_BF16_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::bf16_ops::negative);
+                }
+                else
+                {
+                    BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::negative);
+                }
             }
 
             template <>
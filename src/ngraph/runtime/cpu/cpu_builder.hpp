@@ -232,6 +232,32 @@
     };                                                                                             \
     functors.emplace_back(functor);
 
+// bfloat16 variants of the elementwise functors, OP is a struct of kernel::bf16_ops
+#define BUILD_BF16_UNARY_ELEMWISE_FUNCTOR(OP)                                                      \
+    auto& functors = external_function->get_functors();                                            \
+    auto element_count = out[0].get_size();                                                        \
+    auto& arg0_tensor = external_function->get_tensor_data(args[0].get_name());                    \
+    auto& out0_tensor = external_function->get_tensor_data(out[0].get_name());                     \
+                                                                                                   \
+    auto functor = [&, element_count](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {         \
+        runtime::cpu::kernel::bf16_unary_elementwise<OP>(                                          \
+            arg0_tensor, out0_tensor, element_count, ectx->arena);                                 \
+    };                                                                                             \
+    functors.emplace_back(functor);
+
+#define BUILD_BF16_BINARY_ELEMWISE_FUNCTOR(OP)                                                     \
+    auto& functors = external_function->get_functors();                                            \
+    auto element_count = out[0].get_size();                                                        \
+    auto& arg0_tensor = external_function->get_tensor_data(args[0].get_name());                    \
+    auto& arg1_tensor = external_function->get_tensor_data(args[1].get_name());                    \
+    auto& out0_tensor = external_function->get_tensor_data(out[0].get_name());                     \
+                                                                                                   \
+    auto functor = [&, element_count](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {         \
+        runtime::cpu::kernel::bf16_binary_elementwise<OP>(                                         \
+            arg0_tensor, arg1_tensor, out0_tensor, element_count, ectx->arena);                    \
+    };                                                                                             \
+    functors.emplace_back(functor);
+
 #define REGISTER_OP_BUILDER(OP)                                                                    \
     static struct __register_##OP##_builder                                                        \
     {                                                                                              \
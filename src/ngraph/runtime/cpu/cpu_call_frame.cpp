@@ -15,12 +15,17 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <cstring>
 
+#include "ngraph/log.hpp"
 #include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
+#include "ngraph/runtime/cpu/cpu_topology.hpp"
 #include "ngraph/runtime/cpu/cpu_tracing.hpp"
+#include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 
 #ifdef NGRAPH_DISTRIBUTED_MLSL_ENABLE
 #include <mlsl.hpp>
@@ -38,6 +43,19 @@ runtime::cpu::CPU_CallFrame::CPU_CallFrame(std::shared_ptr<CPU_ExternalFunction>
     , m_compiled_destroy_ctx_func(compiled_destroy_ctx_func)
     , m_compiled_function(compiled_function)
 {
+    for (const auto& layout : m_external_function->get_parameter_layout_descriptors())
+    {
+        bool native = true;
+        if (layout->is_mkldnn_layout())
+        {
+            auto native_md = mkldnn_utils::create_blocked_mkldnn_md(
+                layout->get_shape(), layout->get_strides(), layout->get_element_type());
+            native = mkldnn_utils::compare_mkldnn_mds(layout->get_mkldnn_md(), native_md);
+        }
+        m_native_inputs.push_back(native);
+    }
+    m_input_staging.resize(m_native_inputs.size());
+
     setup_runtime_context();
     if (!m_external_function->is_direct_execution())
     {
@@ -49,6 +67,10 @@ runtime::cpu::CPU_CallFrame::CPU_CallFrame(std::shared_ptr<CPU_ExternalFunction>
 
 runtime::cpu::CPU_CallFrame::~CPU_CallFrame()
 {
+    for (const auto& memory : m_locked_memory)
+    {
+        unlock_memory(memory.first, memory.second);
+    }
     if (!m_external_function->is_direct_execution())
     {
         NGRAPH_ASSERT(m_compiled_destroy_ctx_func) << "compiled_destroy_ctx_func cannot be null.";
@@ -67,8 +89,8 @@ void runtime::cpu::CPU_CallFrame::inner_call(
     {
         shared_ptr<runtime::cpu::CPUTensorView> tv =
             static_pointer_cast<runtime::cpu::CPUTensorView>(input_tvs[i]);
-        ctx->p_en[i] = tv->get_stale();
-        inputs.push_back(tv->get_data_ptr());
+        ctx->p_en[i] = tv->get_stale() || m_recompute_inputs;
+        inputs.push_back(get_input_data_ptr(i, *tv));
     }
     for (size_t i = 0; i < output_tvs.size(); i++)
     {
@@ -78,14 +100,22 @@ void runtime::cpu::CPU_CallFrame::inner_call(
     }
 
     // Invoke compiled computation
-    if (!m_external_function->is_direct_execution())
-    {
-        m_compiled_function(inputs.data(), outputs.data(), ctx, cg_ctx);
-    }
-    else
     {
-        m_external_function->get_executor()(ctx, inputs, outputs);
+        executor::CPUExecutor::ScheduledCall scheduled_call(
+            executor::GetCPUExecutor(),
+            m_external_function->get_priority(),
+            m_external_function->get_device_index());
+        ctx->priority = scheduled_call.get_priority();
+        if (!m_external_function->is_direct_execution())
+        {
+            m_compiled_function(inputs.data(), outputs.data(), ctx, cg_ctx);
+        }
+        else
+        {
+            m_external_function->get_executor()(ctx, inputs, outputs);
+        }
     }
+    m_recompute_inputs = false;
 
     if (runtime::cpu::IsTracingEnabled())
     {
@@ -95,6 +125,48 @@ void runtime::cpu::CPU_CallFrame::inner_call(
     }
 }
 
+// Inputs go to the kernels as is when they are in the layout their parameter was compiled
+// for. Otherwise, e.g. host data fed to a parameter pinned to a blocked layout with
+// CPU_Executable::share_result_layout, they are reordered into a staging buffer first.
+void* runtime::cpu::CPU_CallFrame::get_input_data_ptr(size_t index, CPUTensorView& tv)
+{
+    const auto& expected = m_external_function->get_parameter_layout_descriptors().at(index);
+    auto actual = dynamic_pointer_cast<runtime::cpu::LayoutDescriptor>(tv.get_tensor_layout());
+    bool actual_is_mkldnn = actual && actual->is_mkldnn_layout();
+    if (actual == expected || !expected->is_mkldnn_layout() ||
+        (!actual_is_mkldnn && m_native_inputs[index]))
+    {
+        return tv.get_data_ptr();
+    }
+
+    auto input_md = actual_is_mkldnn
+                        ? actual->get_mkldnn_md()
+                        : mkldnn_utils::create_blocked_mkldnn_md(tv.get_shape(),
+                                                                 row_major_strides(tv.get_shape()),
+                                                                 tv.get_element_type());
+    if (mkldnn_utils::compare_mkldnn_mds(input_md, expected->get_mkldnn_md()))
+    {
+        return tv.get_data_ptr();
+    }
+
+    NGRAPH_DEBUG << "Reordering input " << index << " of "
+                 << m_external_function->get_function_name() << " from layout "
+                 << input_md.data.format << " to " << expected->get_mkldnn_md().data.format;
+    auto& staging = m_input_staging[index];
+    if (!staging)
+    {
+        staging.reset(new AlignedBuffer(expected->get_allocated_size(),
+                                        CPU_ExternalFunction::s_memory_pool_alignment));
+    }
+    mkldnn::memory input{{input_md, executor::global_cpu_engine}, tv.get_data_ptr()};
+    mkldnn::memory output{{expected->get_mkldnn_md(), executor::global_cpu_engine},
+                          staging->get_ptr()};
+    mkldnn::reorder prim{input, output};
+    mkldnn::stream s(mkldnn::stream::kind::eager);
+    s.submit({prim}).wait();
+    return staging->get_ptr();
+}
+
 void runtime::cpu::CPU_CallFrame::call(
     const std::vector<std::shared_ptr<runtime::Tensor>>& output_tvs,
     const std::vector<std::shared_ptr<runtime::Tensor>>& input_tvs)
@@ -104,6 +176,60 @@ void runtime::cpu::CPU_CallFrame::call(
     inner_call(output_tvs, input_tvs);
 }
 
+void runtime::cpu::CPU_CallFrame::warmup(
+    const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+    const std::vector<std::shared_ptr<runtime::Tensor>>& inputs,
+    bool lock_memory)
+{
+    // After the first call, results of cacheable ops live in the scratch memory
+    if (ctx->first_iteration)
+    {
+        executor::GetCPUExecutor().warm_up(m_external_function->get_device_index());
+        for (auto buffer : ctx->memory_buffers)
+        {
+            memset(buffer->get_ptr(), 0, buffer->size());
+        }
+        for (const auto& constant : m_external_function->get_constant_memory())
+        {
+            prefault_memory(constant.first, constant.second);
+        }
+        call(outputs, inputs);
+        m_recompute_inputs = true;
+    }
+
+    if (!lock_memory)
+    {
+        return;
+    }
+    vector<pair<void*, size_t>> memory;
+    for (auto buffer : ctx->memory_buffers)
+    {
+        memory.emplace_back(buffer->get_ptr(), buffer->size());
+    }
+    for (const auto& staging : m_input_staging)
+    {
+        if (staging)
+        {
+            memory.emplace_back(staging->get_ptr(), staging->size());
+        }
+    }
+    // Constants may be shared with other executables, whose locks on them are counted apart
+    const auto& constants = m_external_function->get_constant_memory();
+    memory.insert(memory.end(), constants.begin(), constants.end());
+    for (const auto& range : memory)
+    {
+        if (!runtime::cpu::lock_memory(range.first, range.second))
+        {
+            NGRAPH_WARN << "Could not lock " << range.second << " bytes of "
+                        << m_external_function->get_function_name() << " in memory";
+        }
+        else
+        {
+            m_locked_memory.push_back(range);
+        }
+    }
+}
+
 void runtime::cpu::CPU_CallFrame::propagate_layouts(
     const std::vector<std::shared_ptr<runtime::Tensor>>& tvs,
     const LayoutDescriptorPtrs& layouts) const
@@ -129,6 +255,7 @@ void runtime::cpu::CPU_CallFrame::setup_runtime_context()
     ctx = new CPURuntimeContext;
 
     ctx->pc = 0;
+    ctx->priority = ExecutionPriority::NORMAL;
     ctx->op_durations = nullptr;
     if (runtime::cpu::IsTracingEnabled())
     {
@@ -143,12 +270,18 @@ void runtime::cpu::CPU_CallFrame::setup_runtime_context()
     for (auto buffer_size : m_external_function->get_memory_buffer_sizes())
     {
         auto buffer = new AlignedBuffer(buffer_size, alignment);
+        executor::GetCPUExecutor().bind_memory(
+            m_external_function->get_thread_pool_index(), buffer->get_ptr(), buffer_size);
         ctx->memory_buffers.push_back(buffer);
     }
     const auto& mkldnn_emitter = m_external_function->get_mkldnn_emitter();
     ctx->mkldnn_primitives = mkldnn_emitter->get_mkldnn_primitives().data();
+    ctx->mkldnn_primitive_owners = mkldnn_emitter->get_mkldnn_primitive_owners().data();
     ctx->mkldnn_workspaces = mkldnn_emitter->get_mkldnn_workspaces().data();
     ctx->states = m_external_function->m_states.data();
+#ifdef NGRAPH_DISTRIBUTED_ENABLE
+    ctx->pending_allreduces = new PendingAllReduce[m_external_function->get_allreduce_count()];
+#endif
 
     if (m_external_function->is_direct_execution() && std::getenv("NGRAPH_CPU_USE_TBB") != nullptr)
     {
@@ -197,6 +330,9 @@ void runtime::cpu::CPU_CallFrame::cleanup_runtime_context()
         delete ctx->c;
     }
 
+#ifdef NGRAPH_DISTRIBUTED_ENABLE
+    delete[] ctx->pending_allreduces;
+#endif
 #ifdef NGRAPH_DISTRIBUTED_MLSL_ENABLE
     if (MLSL::Environment::GetEnv().IsInitialized() && ctx->mlsl_dist != nullptr)
     {
@@ -22,6 +22,7 @@
 #include <vector>
 
 #include "ngraph/function.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
 #include "ngraph/runtime/cpu/cpu_runtime_context.hpp"
 #include "ngraph/runtime/tensor.hpp"
@@ -36,6 +37,7 @@ namespace ngraph
         {
             class CPU_ExternalFunction;
             class CPU_Debugger;
+            class CPUTensorView;
 
             using InitContextFuncTy = CPURuntimeContextCG*();
             using DestroyContextFuncTy = void(CPURuntimeContextCG*);
@@ -66,6 +68,15 @@ namespace ngraph
                 void call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
                           const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
 
+                /// \brief Does the one-off work of the first call: runs the function once on
+                ///        `inputs` after touching its scratch memory and waking its threads.
+                ///        The next call recomputes everything computed from the inputs, stale
+                ///        or not. With `lock_memory` the scratch and constant memory is then
+                ///        locked in RAM.
+                void warmup(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                            const std::vector<std::shared_ptr<runtime::Tensor>>& inputs,
+                            bool lock_memory);
+
                 void propagate_layouts(const std::vector<std::shared_ptr<runtime::Tensor>>& tvs,
                                        const LayoutDescriptorPtrs& layouts) const;
 
@@ -81,8 +92,22 @@ namespace ngraph
                 void inner_call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
                                 const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
 
+                void* get_input_data_ptr(size_t index, CPUTensorView& tv);
+
                 std::shared_ptr<CPU_ExternalFunction> m_external_function;
 
+                /// Whether each parameter was compiled for the default row-major layout
+                std::vector<bool> m_native_inputs;
+
+                /// Per parameter buffer holding inputs reordered to the compiled layout
+                std::vector<std::unique_ptr<AlignedBuffer>> m_input_staging;
+
+                /// Set when the last call ran on synthetic inputs
+                bool m_recompute_inputs = false;
+
+                /// Memory locked in RAM by warmup, constants included, unlocked on destruction
+                std::vector<std::pair<void*, size_t>> m_locked_memory;
+
                 CPURuntimeContext* ctx = nullptr;
 
                 /* Codegen specific */
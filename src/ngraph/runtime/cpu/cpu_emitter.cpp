@@ -17,6 +17,8 @@
 #include "ngraph/runtime/cpu/cpu_emitter.hpp"
 #include <algorithm>
 #include <cmath>
+#include <iomanip>
+#include <limits>
 #include <numeric>
 #include <string>
 #include <typeindex>
@@ -117,6 +119,7 @@
 #include "ngraph/runtime/cpu/op/lstm.hpp"
 #include "ngraph/runtime/cpu/op/matmul_bias.hpp"
 #include "ngraph/runtime/cpu/op/max_pool_with_indices.hpp"
+#include "ngraph/runtime/cpu/op/optimizer_update.hpp"
 #include "ngraph/runtime/cpu/op/rnn.hpp"
 #include "ngraph/runtime/cpu/op/sigmoid.hpp"
 #include "ngraph/runtime/cpu/op/sigmoid_mul.hpp"
@@ -150,6 +153,14 @@ static string eigen_matrix_format(const ngraph::Shape& shape, const ngraph::Stri
     return ss.str();
 }
 
+// A float literal with enough digits to read back as the same float
+static string float_literal(float value)
+{
+    stringstream ss;
+    ss << showpoint << setprecision(numeric_limits<float>::max_digits10) << value << "f";
+    return ss.str();
+}
+
 namespace ngraph
 {
     namespace runtime
@@ -562,6 +573,10 @@ namespace ngraph
             template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::Rnn)
             {
+                if (static_cast<const ngraph::op::Rnn*>(node)->has_sequence_lengths())
+                {
+                    throw ngraph_error("Rnn with sequence lengths is only supported via DEX");
+                }
                 auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
                 auto rnn_index = mkldnn_emitter->build_rnn<ngraph::op::Rnn>(node, args, out);
                 auto& deps = mkldnn_emitter->get_primitive_deps(rnn_index);
@@ -1889,6 +1904,51 @@ namespace ngraph
                 writer.block_end();
             }
 
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::SGDMomentumUpdate)
+            {
+                auto update = static_cast<const ngraph::op::SGDMomentumUpdate*>(node);
+                auto et = args[0].get_element_type().c_type_string();
+                writer.block_begin();
+                writer << et << " lr = " << args[3].get_name() << "[0];\n";
+                writer << et << " mu = " << float_literal(update->get_momentum()) << ";\n";
+                writer << "#pragma omp parallel for simd\n";
+                writer << "for (size_t i = 0; i < " << out[0].get_size() << "; i++)\n";
+                writer.block_begin();
+                writer << et << " velocity = mu * " << args[1].get_name() << "[i] + "
+                       << args[2].get_name() << "[i];\n";
+                writer << out[1].get_name() << "[i] = velocity;\n";
+                writer << out[0].get_name() << "[i] = " << args[0].get_name()
+                       << "[i] - lr * velocity;\n";
+                writer.block_end();
+                writer.block_end();
+            }
+
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::AdamUpdate)
+            {
+                auto update = static_cast<const ngraph::op::AdamUpdate*>(node);
+                auto et = args[0].get_element_type().c_type_string();
+                writer.block_begin();
+                writer << et << " lr = " << args[4].get_name() << "[0];\n";
+                // Computed in the element type, as the kernel of the direct execution mode does
+                writer << et << " b1 = " << float_literal(update->get_beta1()) << ";\n";
+                writer << et << " b2 = " << float_literal(update->get_beta2()) << ";\n";
+                writer << et << " eps = " << float_literal(update->get_epsilon()) << ";\n";
+                writer << "#pragma omp parallel for simd\n";
+                writer << "for (size_t i = 0; i < " << out[0].get_size() << "; i++)\n";
+                writer.block_begin();
+                writer << et << " g = " << args[3].get_name() << "[i];\n";
+                writer << et << " m = b1 * " << args[1].get_name() << "[i] + (1 - b1) * g;\n";
+                writer << et << " v = b2 * " << args[2].get_name() << "[i] + (1 - b2) * g * g;\n";
+                writer << out[1].get_name() << "[i] = m;\n";
+                writer << out[2].get_name() << "[i] = v;\n";
+                writer << out[0].get_name() << "[i] = " << args[0].get_name()
+                       << "[i] - lr * m / (std::sqrt(v) + eps);\n";
+                writer.block_end();
+                writer.block_end();
+            }
+
             template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::ReplaceSlice)
             {
@@ -3156,43 +3216,9 @@ namespace ngraph
             {
                 auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
 
-                auto input_desc = mkldnn_utils::get_input_mkldnn_md(node, 0);
+                auto input_desc = mkldnn_utils::get_convert_layout_input_md(node);
                 auto result_desc = mkldnn_utils::get_output_mkldnn_md(node, 0);
 
-                //this is a special case to handle nchw(oihw) to goihw/Goihw16g/Goihw8g for GroupConvolution's weights
-                if (input_desc.data.format == mkldnn_nchw &&
-                    result_desc.data.format == mkldnn_goihw)
-                {
-                    input_desc = result_desc;
-                }
-                else if (input_desc.data.format == mkldnn_nchw &&
-                         input_desc.data.ndims == 4 /*nchw*/ &&
-                         result_desc.data.ndims == 5 /*Goihw16g/Goihw8g/etc*/ &&
-                         node->get_users().size() == 1)
-                {
-                    Shape weights_shape_groups;
-                    if (auto gconv = std::dynamic_pointer_cast<ngraph::op::GroupConvolution>(
-                            node->get_users()[0]))
-                    {
-                        weights_shape_groups = gconv->get_weights_dimensions();
-                    }
-                    else if (auto gconvb =
-                                 std::dynamic_pointer_cast<ngraph::op::GroupConvolutionBias>(
-                                     node->get_users()[0]))
-                    {
-                        weights_shape_groups = gconvb->get_weights_dimensions();
-                    }
-                    else
-                    {
-                        throw ngraph_error("Incompatible input/output shape in ConvertLayout op");
-                    }
-                    input_desc = mkldnn::memory::desc(
-                        mkldnn::memory::dims(weights_shape_groups.begin(),
-                                             weights_shape_groups.end()),
-                        mkldnn_utils::get_mkldnn_data_type(args[0].get_element_type()),
-                        mkldnn::memory::format::goihw);
-                }
-
                 size_t reorder_index = mkldnn_emitter->build_reorder(input_desc, result_desc);
 
                 auto& deps = mkldnn_emitter->get_primitive_deps(reorder_index);
@@ -14,11 +14,17 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <thread>
 
+#if defined(EIGEN_OPENMP)
+#include <omp.h>
+#endif
+
 #include "cpu_executor.hpp"
 
 #include "ngraph/except.hpp"
+#include "ngraph/log.hpp"
 
 static int GetNumCores()
 {
@@ -54,6 +60,46 @@ static int GetNumThreadPools()
     return count < 1 ? 1 : count;
 }
 
+// Eigen thread environment that pins each new thread to the next CPU of a list
+class PinnedThreadEnvironment : public Eigen::StlThreadEnvironment
+{
+public:
+    PinnedThreadEnvironment(const std::vector<int>& cpus)
+        : m_cpus(cpus)
+    {
+    }
+
+    EnvThread* CreateThread(std::function<void()> f)
+    {
+        int cpu = m_cpus[m_next_cpu++ % m_cpus.size()];
+        return Eigen::StlThreadEnvironment::CreateThread([cpu, f]() {
+            ngraph::runtime::cpu::pin_current_thread({cpu});
+            f();
+        });
+    }
+
+private:
+    std::vector<int> m_cpus;
+    size_t m_next_cpu = 0;
+};
+
+// Priority of the call the current thread runs an op of, -1 outside of calls
+static thread_local int s_enclosing_priority = -1;
+
+// Makes calls started by the current thread run on behalf of a call of `priority`
+class EnclosingPriority
+{
+public:
+    EnclosingPriority(ngraph::runtime::cpu::ExecutionPriority priority)
+        : m_saved(s_enclosing_priority)
+    {
+        s_enclosing_priority = static_cast<int>(priority);
+    }
+    ~EnclosingPriority() { s_enclosing_priority = m_saved; }
+private:
+    int m_saved;
+};
+
 namespace ngraph
 {
     namespace runtime
@@ -63,17 +109,64 @@ namespace ngraph
             namespace executor
             {
                 CPUExecutor::CPUExecutor(int num_thread_pools)
-                    : m_num_thread_pools(num_thread_pools)
                 {
+                    std::vector<NumaNode> numa_nodes;
+                    if (std::getenv("NGRAPH_CPU_NUMA_AFFINITY") != nullptr)
+                    {
+                        numa_nodes = get_numa_topology();
+                        if (numa_nodes.empty())
+                        {
+                            NGRAPH_WARN << "NGRAPH_CPU_NUMA_AFFINITY is set but the CPU topology "
+                                           "could not be read, thread pools are not pinned";
+                        }
+                        num_thread_pools =
+                            std::max(num_thread_pools, static_cast<int>(numa_nodes.size()));
+                    }
+                    m_num_thread_pools = num_thread_pools;
+                    m_num_cores = GetNumCores();
+                    if (!numa_nodes.empty())
+                    {
+                        m_num_cores = 0;
+                        for (const NumaNode& node : numa_nodes)
+                        {
+                            m_num_cores += static_cast<int>(node.cpus.size());
+                        }
+                    }
+                    for (auto& cores : m_active_cores)
+                    {
+                        cores = 0;
+                    }
+
                     for (int i = 0; i < num_thread_pools; i++)
                     {
+                        // Pools sharing a node split its cores
+                        std::vector<int> pool_cpus;
+                        if (!numa_nodes.empty())
+                        {
+                            size_t node_count = numa_nodes.size();
+                            const NumaNode& node = numa_nodes[i % node_count];
+                            size_t node_pools =
+                                (num_thread_pools - i % node_count + node_count - 1) / node_count;
+                            size_t slice = i / node_count;
+                            for (size_t j = slice; j < node.cpus.size(); j += node_pools)
+                            {
+                                pool_cpus.push_back(node.cpus[j]);
+                            }
+                            if (pool_cpus.empty())
+                            {
+                                pool_cpus = node.cpus;
+                            }
+                            m_pool_numa_nodes.push_back(node.id);
+                        }
+
                         int num_threads_per_pool;
 #if defined(EIGEN_OPENMP)
                         // Eigen threadpool will still be used for reductions
                         // and other tensor operations that dont use a parallelFor
                         num_threads_per_pool = 1;
 #else
-                        num_threads_per_pool = GetNumCores();
+                        num_threads_per_pool =
+                            pool_cpus.empty() ? GetNumCores() : static_cast<int>(pool_cpus.size());
 #endif
                         // User override
                         char* eigen_tp_count = std::getenv("NGRAPH_CPU_EIGEN_THREAD_COUNT");
@@ -92,13 +185,79 @@ namespace ngraph
                             num_threads_per_pool = tp_count;
                         }
 
-                        m_thread_pools.push_back(std::unique_ptr<Eigen::ThreadPool>(
-                            new Eigen::ThreadPool(num_threads_per_pool)));
+                        if (pool_cpus.empty())
+                        {
+                            m_thread_pools.push_back(std::unique_ptr<Eigen::ThreadPoolInterface>(
+                                new Eigen::ThreadPool(num_threads_per_pool)));
+                        }
+                        else
+                        {
+                            m_thread_pools.push_back(std::unique_ptr<Eigen::ThreadPoolInterface>(
+                                new Eigen::ThreadPoolTempl<PinnedThreadEnvironment>(
+                                    num_threads_per_pool, PinnedThreadEnvironment(pool_cpus))));
+                        }
                         m_thread_pool_devices.push_back(
                             std::unique_ptr<Eigen::ThreadPoolDevice>(new Eigen::ThreadPoolDevice(
                                 m_thread_pools[i].get(), num_threads_per_pool)));
+                        m_device_pools.push_back(i);
+                        m_device_cores.push_back(
+                            pool_cpus.empty() ? GetNumCores() : static_cast<int>(pool_cpus.size()));
                         m_tbb_arenas.emplace_back(1);
                     }
+
+                    // Devices sharing a pool with fewer cores, one per core budget
+                    for (int i = 0; i < num_thread_pools; i++)
+                    {
+                        m_budget_device_offsets.push_back(
+                            static_cast<int>(m_thread_pool_devices.size()));
+                        int num_threads = m_thread_pool_devices[i]->numThreads();
+                        for (int budget = 1; budget < m_device_cores[i]; budget++)
+                        {
+                            m_thread_pool_devices.emplace_back(new Eigen::ThreadPoolDevice(
+                                m_thread_pools[i].get(), std::min(budget, num_threads)));
+                            m_device_pools.push_back(i);
+                            m_device_cores.push_back(budget);
+                        }
+                    }
+                }
+
+                CPUExecutor::ScheduledCall::ScheduledCall(CPUExecutor& executor,
+                                                          ExecutionPriority priority,
+                                                          int device)
+                    : m_executor(executor)
+                    , m_priority(priority)
+                    , m_cores(0)
+                    , m_enclosing_priority(s_enclosing_priority)
+                {
+                    if (m_enclosing_priority >= 0)
+                    {
+                        m_priority = static_cast<ExecutionPriority>(
+                            std::max(static_cast<int>(priority), m_enclosing_priority));
+                    }
+                    else
+                    {
+                        m_executor.wait_for_turn(m_priority, device);
+                        m_cores = std::min(m_executor.m_device_cores[device],
+                                           m_executor.m_num_cores);
+                        m_executor.m_active_cores[static_cast<int>(m_priority)] += m_cores;
+                    }
+                    s_enclosing_priority = static_cast<int>(m_priority);
+                }
+
+                CPUExecutor::ScheduledCall::~ScheduledCall()
+                {
+                    s_enclosing_priority = m_enclosing_priority;
+                    if (m_cores == 0)
+                    {
+                        return;
+                    }
+                    m_executor.m_active_cores[static_cast<int>(m_priority)] -= m_cores;
+                    if (m_priority != ExecutionPriority::LOW)
+                    {
+                        // Taking the lock orders the update before waiters test for it
+                        std::lock_guard<std::mutex> lock(m_executor.m_schedule_mutex);
+                        m_executor.m_schedule_cv.notify_all();
+                    }
                 }
 
                 void CPUExecutor::execute(CPUKernelFunctor& f,
@@ -106,15 +265,99 @@ namespace ngraph
                                           CPUExecutionContext* ectx,
                                           bool use_tbb)
                 {
-                    auto tbb_functor = [&]() { f(ctx, ectx); };
+                    auto tbb_functor = [&]() {
+                        EnclosingPriority enclosing(ctx->priority);
+                        f(ctx, ectx);
+                    };
+#if defined(EIGEN_OPENMP)
+                    // Kernels parallelize with OpenMP rather than the Eigen pool, hold them
+                    // to the core budget of the device
+                    int saved_omp_threads = omp_get_max_threads();
+                    bool budgeted = ectx->arena >= m_num_thread_pools;
+                    if (budgeted)
+                    {
+                        omp_set_num_threads(m_device_cores[ectx->arena]);
+                    }
+#endif
                     if (use_tbb)
                     {
-                        m_tbb_arenas[ectx->arena].execute(tbb_functor);
+                        m_tbb_arenas[m_device_pools[ectx->arena]].execute(tbb_functor);
                     }
                     else
                     {
+                        EnclosingPriority enclosing(ctx->priority);
                         f(ctx, ectx);
                     }
+#if defined(EIGEN_OPENMP)
+                    if (budgeted)
+                    {
+                        omp_set_num_threads(saved_omp_threads);
+                    }
+#endif
+                }
+
+                int CPUExecutor::get_device_index(int pool, int core_budget) const
+                {
+                    if (core_budget <= 0 || core_budget >= m_device_cores.at(pool))
+                    {
+                        return pool;
+                    }
+                    return m_budget_device_offsets[pool] + core_budget - 1;
+                }
+
+                bool CPUExecutor::is_blocked(ExecutionPriority priority, int cores) const
+                {
+                    int busy = 0;
+                    for (int p = static_cast<int>(priority) + 1; p < s_num_priorities; p++)
+                    {
+                        busy += m_active_cores[p];
+                    }
+                    return busy > 0 && busy + cores > m_num_cores;
+                }
+
+                void CPUExecutor::wait_for_turn(ExecutionPriority priority, int device)
+                {
+                    int cores = std::min(m_device_cores[device], m_num_cores);
+                    if (!is_blocked(priority, cores))
+                    {
+                        return;
+                    }
+                    std::unique_lock<std::mutex> lock(m_schedule_mutex);
+                    m_schedule_cv.wait(lock, [&]() { return !is_blocked(priority, cores); });
+                }
+
+                int CPUExecutor::assign_thread_pool()
+                {
+                    if (m_pool_numa_nodes.empty())
+                    {
+                        return 0;
+                    }
+                    return m_next_thread_pool++ % m_num_thread_pools;
+                }
+
+                int CPUExecutor::get_numa_node(int pool) const
+                {
+                    return m_pool_numa_nodes.empty() ? -1 : m_pool_numa_nodes.at(pool);
+                }
+
+                void CPUExecutor::bind_memory(int pool, void* data, size_t size) const
+                {
+                    int node = get_numa_node(pool);
+                    if (node >= 0 && data != nullptr && !bind_memory_to_node(data, size, node))
+                    {
+                        NGRAPH_DEBUG << "Could not place " << size << " bytes on NUMA node "
+                                     << node;
+                    }
+                }
+
+                void CPUExecutor::warm_up(int device)
+                {
+                    auto& pool_device = get_device(device);
+                    // A cost high enough for parallelFor to run a block on every thread
+                    pool_device.parallelFor(pool_device.numThreads(),
+                                            Eigen::TensorOpCost(0, 0, 1e6),
+                                            [](Eigen::Index, Eigen::Index) {});
+                    m_tbb_arenas[m_device_pools[device]].initialize();
                 }
 
                 CPUExecutor& GetCPUExecutor()
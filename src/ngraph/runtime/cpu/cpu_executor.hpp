@@ -16,12 +16,17 @@
 
 #pragma once
 
+#include <atomic>
+#include <condition_variable>
 #include <functional>
+#include <mutex>
 #include <thread>
+#include <vector>
 
 #include <mkldnn.hpp>
 
 #include "ngraph/runtime/cpu/cpu_runtime_context.hpp"
+#include "ngraph/runtime/cpu/cpu_topology.hpp"
 
 #define EIGEN_USE_THREADS
 #include <unsupported/Eigen/CXX11/Tensor>
@@ -39,11 +44,40 @@ namespace ngraph
                 extern mkldnn::engine global_cpu_engine;
 
                 // CPUExecutor owns the resources for executing a graph.
+                //
+                // With NGRAPH_CPU_NUMA_AFFINITY set, there is at least one thread pool per NUMA
+                // node, pool threads are pinned to physical cores of their node and executables
+                // are spread over the pools, with their memory placed on the pool's node.
+                //
+                // Executables sharing the executor are scheduled by priority class: a call
+                // waits at op boundaries while calls of higher classes leave too few idle
+                // cores for it, and runs its ops on a device limited to its core budget.
                 class CPUExecutor
                 {
                 public:
                     explicit CPUExecutor(int num_thread_pools);
 
+                    // Registers a call with the scheduler for its lifetime. Calls made from
+                    // within another call, e.g. by an op, run on behalf of the enclosing call:
+                    // they take its priority if higher and never wait for it.
+                    class ScheduledCall
+                    {
+                    public:
+                        ScheduledCall(CPUExecutor& executor,
+                                      ExecutionPriority priority,
+                                      int device);
+                        ~ScheduledCall();
+                        ScheduledCall(const ScheduledCall&) = delete;
+                        ScheduledCall& operator=(const ScheduledCall&) = delete;
+
+                        ExecutionPriority get_priority() const { return m_priority; }
+                    private:
+                        CPUExecutor& m_executor;
+                        ExecutionPriority m_priority;
+                        int m_cores;
+                        int m_enclosing_priority;
+                    };
+
                     Eigen::ThreadPoolDevice& get_device(int id)
                     {
                         return *m_thread_pool_devices[id].get();
@@ -54,11 +88,48 @@ namespace ngraph
                                  CPUExecutionContext* ectx,
                                  bool use_tbb = false);
                     int get_num_thread_pools() { return m_num_thread_pools; }
+                    /// \brief Id of the device running on `pool` with at most `core_budget`
+                    ///        threads. A budget of 0 or of the whole pool gives the pool's
+                    ///        own device, whose id is `pool`.
+                    int get_device_index(int pool, int core_budget) const;
+                    /// \brief Blocks until a call of `priority` running on `device` may run
+                    ///        its next op, i.e. until the calls of higher priority in flight
+                    ///        leave enough idle cores for it.
+                    void wait_for_turn(ExecutionPriority priority, int device);
+                    /// \brief Picks the thread pool a new executable runs on, round robin over
+                    ///        the pools with NUMA affinity and pool 0 otherwise.
+                    int assign_thread_pool();
+                    /// \brief NUMA node the threads of `pool` are pinned to, -1 if unpinned.
+                    int get_numa_node(int pool) const;
+                    /// \brief Places memory used by executables running on `pool` on the
+                    ///        pool's NUMA node. Does nothing without NUMA affinity.
+                    void bind_memory(int pool, void* data, size_t size) const;
+                    /// \brief Wakes every thread of `device` and initializes its TBB arena, so
+                    ///        the first op running on the device does not pay for it.
+                    void warm_up(int device);
+
                 private:
-                    std::vector<std::unique_ptr<Eigen::ThreadPool>> m_thread_pools;
+                    bool is_blocked(ExecutionPriority priority, int cores) const;
+
+                    static const int s_num_priorities = 3;
+
+                    std::vector<std::unique_ptr<Eigen::ThreadPoolInterface>> m_thread_pools;
+                    // Devices 0 to m_num_thread_pools - 1 use their whole pool, the others
+                    // one core budget of a pool each
                     std::vector<std::unique_ptr<Eigen::ThreadPoolDevice>> m_thread_pool_devices;
+                    std::vector<int> m_device_pools;
+                    // Cores the ops running on each device may use
+                    std::vector<int> m_device_cores;
+                    std::vector<int> m_budget_device_offsets;
                     std::vector<tbb::task_arena> m_tbb_arenas;
                     int m_num_thread_pools;
+                    int m_num_cores;
+                    std::vector<int> m_pool_numa_nodes;
+                    std::atomic<int> m_next_thread_pool{0};
+                    // Cores claimed by the calls in flight, by priority
+                    std::atomic<int> m_active_cores[s_num_priorities];
+                    std::mutex m_schedule_mutex;
+                    std::condition_variable m_schedule_cv;
                 };
 
                 extern CPUExecutor& GetCPUExecutor();
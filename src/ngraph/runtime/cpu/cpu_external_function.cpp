@@ -117,6 +117,7 @@
 #include "ngraph/op/tanh.hpp"
 #include "ngraph/op/topk.hpp"
 #include "ngraph/pass/algebraic_simplification.hpp"
+#include "ngraph/pass/allreduce_bucketing.hpp"
 #include "ngraph/pass/common_function_collection.hpp"
 #include "ngraph/pass/constant_folding.hpp"
 #include "ngraph/pass/core_fusion.hpp"
@@ -159,20 +160,25 @@
 #include "ngraph/runtime/cpu/op/lstm.hpp"
 #include "ngraph/runtime/cpu/op/matmul_bias.hpp"
 #include "ngraph/runtime/cpu/op/max_pool_with_indices.hpp"
+#include "ngraph/runtime/cpu/op/optimizer_update.hpp"
 #include "ngraph/runtime/cpu/op/rnn.hpp"
 #include "ngraph/runtime/cpu/op/sigmoid.hpp"
 #include "ngraph/runtime/cpu/op/sigmoid_mul.hpp"
 #include "ngraph/runtime/cpu/op/update_slice.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_assignment.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_collapse_dims.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_f16_lowering.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_horizontal_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_layout.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_mat_fusion.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_matmul_horizontal_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_memory_assignment.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_memory_optimization.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_mixed_precision.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_post_layout_optimizations.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_rnn_fusion.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_weight_sharing.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_workspace_insertion.hpp"
 #include "ngraph/runtime/cpu/pass/halide_subgraph_extraction.hpp"
 
@@ -227,6 +233,9 @@ runtime::cpu::CPU_ExternalFunction::CPU_ExternalFunction(
     , m_compiled_function(nullptr)
     , m_function_name(function->get_name())
     , m_is_built(false)
+    , m_thread_pool_index(executor::GetCPUExecutor().assign_thread_pool())
+    , m_priority(ExecutionPriority::NORMAL)
+    , m_device_index(m_thread_pool_index)
 {
 }
 
@@ -238,6 +247,13 @@ runtime::cpu::CPU_ExternalFunction::~CPU_ExternalFunction()
     }
 }
 
+void runtime::cpu::CPU_ExternalFunction::set_scheduling(ExecutionPriority priority,
+                                                         int core_budget)
+{
+    m_priority = priority;
+    m_device_index = executor::GetCPUExecutor().get_device_index(m_thread_pool_index, core_budget);
+}
+
 class StaticInitializers
 {
 public:
@@ -336,6 +352,9 @@ static const runtime::cpu::OpMap dispatcher{
     {TI(ngraph::op::Atan), &runtime::cpu::CPU_Emitter::emit<op::Atan>},
     {TI(ngraph::op::ReplaceSlice), &runtime::cpu::CPU_Emitter::emit<op::ReplaceSlice>},
     {TI(ngraph::op::UpdateSlice), &runtime::cpu::CPU_Emitter::emit<op::UpdateSlice>},
+    {TI(ngraph::op::SGDMomentumUpdate),
+     &runtime::cpu::CPU_Emitter::emit<op::SGDMomentumUpdate>},
+    {TI(ngraph::op::AdamUpdate), &runtime::cpu::CPU_Emitter::emit<op::AdamUpdate>},
     {TI(ngraph::op::OneHot), &runtime::cpu::CPU_Emitter::emit<op::OneHot>},
     {TI(ngraph::op::Floor), &runtime::cpu::CPU_Emitter::emit<op::Floor>},
     {TI(ngraph::op::Ceiling), &runtime::cpu::CPU_Emitter::emit<op::Ceiling>},
@@ -430,6 +449,16 @@ static void
     writer << "}\n";
 }
 
+static const size_t s_op_functions_per_unit = 16;
+
+// Op functions are emitted static, but the units they are compiled in are linked together
+static string get_external_definition(const string& op_function)
+{
+    const string prefix = "static ";
+    return op_function.compare(0, prefix.size(), prefix) == 0 ? op_function.substr(prefix.size())
+                                                               : op_function;
+}
+
 static void generate_class_declarations(CodeWriter& writer)
 {
     writer << "// Declare all classes\n";
@@ -454,23 +483,25 @@ void runtime::cpu::CPU_ExternalFunction::compile(ngraph::pass::PassConfig& pass_
 
     ngraph::pass::Manager pass_manager;
     register_common_passes(pass_manager, pass_config);
-    unordered_map<Node*, Node*> node_function_map;
-    string common_function_string;
+    unordered_map<Node*, string> node_function_map;
+    vector<string> op_functions;
     auto femitter = bind(&ngraph::runtime::cpu::CPU_ExternalFunction::emit_op_as_function,
                          this,
                          placeholders::_1,
                          placeholders::_2);
     pass_manager.register_pass<ngraph::pass::CommonFunctionCollection>(
-        femitter, node_function_map, common_function_string);
+        femitter, node_function_map, op_functions);
     pass_manager.run_passes(m_function);
 
-    unordered_map<shared_ptr<Function>, list<shared_ptr<Node>>> function_ordered_ops;
+    unordered_map<shared_ptr<Function>, shared_ptr<const list<shared_ptr<Node>>>>
+        function_ordered_ops;
     // only one function is allowed
     NGRAPH_ASSERT(pass_manager.get_state().get_functions().size() == 1)
         << "only one function is allowed";
     for (shared_ptr<Function> current_function : pass_manager.get_state().get_functions())
     {
-        function_ordered_ops.insert({current_function, current_function->get_ordered_ops()});
+        function_ordered_ops.insert(
+            {current_function, current_function->get_ordered_ops_shared()});
     }
 
     CodeWriter writer;
@@ -566,7 +597,7 @@ using namespace ngraph::runtime;
         size_t index = 0;
         for (shared_ptr<Function> current_function : pass_manager.get_state().get_functions())
         {
-            for (shared_ptr<Node> node : function_ordered_ops.at(current_function))
+            for (shared_ptr<Node> node : *function_ordered_ops.at(current_function))
             {
                 if (!node->is_parameter() && !node->is_constant())
                 {
@@ -616,7 +647,7 @@ using namespace ngraph::runtime;
     writer << "// Declare all constants\n";
     for (shared_ptr<Function> current_function : pass_manager.get_state().get_functions())
     {
-        for (shared_ptr<Node> node : function_ordered_ops.at(current_function))
+        for (shared_ptr<Node> node : *function_ordered_ops.at(current_function))
         {
             ngraph::op::Constant* c = dynamic_cast<ngraph::op::Constant*>(node.get());
             if (c)
@@ -626,6 +657,9 @@ using namespace ngraph::runtime;
                 string type = tv->get_element_type().c_type_string();
                 writer << "static " << type << "* " << tv->get_name() << " = ((" << type << "*)("
                        << c->get_data_ptr() << "));\n";
+                executor::GetCPUExecutor().bind_memory(
+                    m_thread_pool_index, const_cast<void*>(c->get_data_ptr()), tv->size());
+                m_constant_memory.emplace_back(const_cast<void*>(c->get_data_ptr()), tv->size());
 
                 auto output_tensor = &node->get_output_tensor();
                 auto tensor_set = get_tensor_set(output_tensor);
@@ -654,11 +688,17 @@ using namespace ngraph::runtime;
 
     generate_runtime_context_class(writer);
 
-    writer << common_function_string << "\n";
+    writer << "// Declare all op functions\n";
+    for (const string& op_function : op_functions)
+    {
+        string definition = get_external_definition(op_function);
+        writer << definition.substr(0, definition.find("\n{")) << ";\n";
+    }
+    writer << "\n";
 
     for (shared_ptr<Function> current_function : pass_manager.get_state().get_functions())
     {
-        auto ordered_ops = function_ordered_ops.at(current_function);
+        auto& ordered_ops = *function_ordered_ops.at(current_function);
         set<string> output_names;
         for (shared_ptr<Node> op : current_function->get_results())
         {
@@ -905,8 +945,7 @@ using namespace ngraph::runtime;
             }
             else
             {
-                string func_name =
-                    ngraph::pass::CommonFunctionCollection::create_function_name(*it->second);
+                const string& func_name = it->second;
                 vector<string> names;
                 for (const TensorViewWrapper& tv : in)
                 {
@@ -1020,18 +1059,43 @@ using namespace ngraph::runtime;
     string code = writer.get_code();
     runtime::cpu::CPU_ExternalFunction::write_to_file(writer.get_code(), s_output_dir, filename);
 
+    // The op functions are spread over units of a fixed number of functions, which compile in
+    // parallel and are cached separately, so that a change to the graph only recompiles the
+    // units it touches
+    CodeWriter unit_prelude;
+    unit_prelude += pch_header_source;
+    generate_class_declarations(unit_prelude);
+    vector<string> sources{code};
+    for (size_t i = 0; i < op_functions.size(); i += s_op_functions_per_unit)
+    {
+        CodeWriter unit;
+        unit += unit_prelude.get_code();
+        for (size_t j = i; j < op_functions.size() && j < i + s_op_functions_per_unit; j++)
+        {
+            unit << get_external_definition(op_functions[j]) << "\n";
+        }
+        sources.push_back(unit.get_code());
+        runtime::cpu::CPU_ExternalFunction::write_to_file(
+            "\n// Op function unit " + to_string(sources.size() - 1) + "\n" + unit.get_code(),
+            s_output_dir,
+            filename);
+    }
+
     m_compiler.reset(new codegen::Compiler());
     m_execution_engine.reset(new codegen::ExecutionEngine());
 
     m_compiler->set_precompiled_header_source(pch_header_source);
 
-    auto codegen_module = m_compiler->compile(code);
+    auto codegen_modules = m_compiler->compile(sources);
 
-    if (codegen_module == nullptr)
+    for (auto& codegen_module : codegen_modules)
     {
-        throw runtime_error("function failed to compile");
+        if (codegen_module == nullptr)
+        {
+            throw runtime_error("function failed to compile");
+        }
+        m_execution_engine->add_module(codegen_module);
     }
-    m_execution_engine->add_module(codegen_module);
     m_execution_engine->finalize();
 
     m_compiled_init_ctx_func = m_execution_engine->find_function<InitContextFuncTy>("init_cg_ctx");
@@ -1109,6 +1173,11 @@ void runtime::cpu::CPU_ExternalFunction::register_common_passes(
     REGISTER_KNOBBED_PASS(LikeReplacement, true, ngraph::pass);
     REGISTER_KNOBBED_PASS(NopElimination, true, ngraph::pass);
     REGISTER_KNOBBED_PASS(ZeroDimTensorElimination, true, ngraph::pass);
+    // Ahead of the fusions, which match f32 ops. Codegen has no f16 emitters.
+    if (m_direct_execution)
+    {
+        REGISTER_KNOBBED_PASS(CPUF16Lowering, true, runtime::cpu::pass);
+    }
     REGISTER_KNOBBED_PASS(LSTMFusion, true, runtime::cpu::pass);
     REGISTER_KNOBBED_PASS(RNNFusion, true, runtime::cpu::pass);
     REGISTER_KNOBBED_PASS(AlgebraicSimplification, true, ngraph::pass);
@@ -1119,10 +1188,24 @@ void runtime::cpu::CPU_ExternalFunction::register_common_passes(
     REGISTER_KNOBBED_PASS(ReshapeSinking, false, ngraph::pass);
     REGISTER_KNOBBED_PASS(ReshapeElimination, false, ngraph::pass);
     REGISTER_KNOBBED_PASS(CoreFusion, true, ngraph::pass);
+    // Ahead of CPUFusion, which turns the Dots into MatmulBias. Only the builders have
+    // bfloat16 kernels.
+    if (m_direct_execution)
+    {
+        REGISTER_KNOBBED_PASS(CPUMixedPrecision, false, runtime::cpu::pass);
+    }
     REGISTER_KNOBBED_PASS(CPUFusion, true, runtime::cpu::pass);
     REGISTER_KNOBBED_PASS(CPUQuantFusion, true, runtime::cpu::pass);
     REGISTER_KNOBBED_PASS(CPUHorizontalFusion, true, runtime::cpu::pass);
+    // After CPUFusion, to batch the MatmulBias it creates. Codegen has no GroupedMatmul emitter.
+    if (m_direct_execution)
+    {
+        REGISTER_KNOBBED_PASS(CPUMatmulHorizontalFusion, true, runtime::cpu::pass);
+    }
     REGISTER_KNOBBED_PASS(CPUCollapseDims, true, runtime::cpu::pass);
+#ifdef NGRAPH_DISTRIBUTED_ENABLE
+    REGISTER_KNOBBED_PASS(AllReduceBucketing, true, ngraph::pass);
+#endif
 #if defined(NGRAPH_HALIDE)
     REGISTER_KNOBBED_PASS(HalideSubgraphExtraction, true, ngraph::runtime::cpu::pass);
 #endif
@@ -1135,6 +1218,7 @@ void runtime::cpu::CPU_ExternalFunction::register_common_passes(
     REGISTER_KNOBBED_PASS_WITH_ARGS(
         CommonSubexpressionElimination, true, ngraph::pass, runtime::cpu::get_cse_handlers_map());
     REGISTER_KNOBBED_PASS(CPUPostLayoutOptimizations, true, runtime::cpu::pass);
+    REGISTER_KNOBBED_PASS(CPUWeightSharing, true, runtime::cpu::pass);
     REGISTER_KNOBBED_PASS(CPUMemoryOptimization, true, runtime::cpu::pass);
     REGISTER_KNOBBED_PASS(GetOutputElementElimination, false, ngraph::pass);
     REGISTER_KNOBBED_PASS_WITH_ARGS(
@@ -1237,14 +1321,21 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
         }
     }
 
+    // The graph is final from here on
+    auto ordered_ops = m_function->get_ordered_ops_shared();
+
     // Constants
-    for (auto& node : m_function->get_ordered_ops())
+    for (auto& node : *ordered_ops)
     {
         if (node->is_constant())
         {
             auto output_tensor = &node->get_output_tensor();
             tensor_data[output_tensor->get_name()] =
                 const_cast<void*>(static_pointer_cast<ngraph::op::Constant>(node)->get_data_ptr());
+            executor::GetCPUExecutor().bind_memory(
+                m_thread_pool_index, tensor_data[output_tensor->get_name()], output_tensor->size());
+            m_constant_memory.emplace_back(tensor_data[output_tensor->get_name()],
+                                           output_tensor->size());
             auto tensor_set = get_tensor_set(output_tensor);
             // process all tensors in the set containing the output tensor of the constant
             for (auto& ele_t : tensor_set)
@@ -1293,7 +1384,7 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
         }
     }
 
-    for (shared_ptr<Node> node : m_function->get_ordered_ops())
+    for (shared_ptr<Node> node : *ordered_ops)
     {
         if (node->is_parameter() || node->is_constant())
         {
@@ -1329,6 +1420,29 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
         op_names.push_back(node->get_name());
         handler->second(this, node.get(), in, out);
 
+        // Wait for the asynchronous ops producing the inputs
+        vector<function<void(CPURuntimeContext*)>> waits;
+        for (const auto& name : in_names)
+        {
+            auto it = m_async_outputs.find(name);
+            if (it != m_async_outputs.end())
+            {
+                waits.push_back(it->second);
+            }
+        }
+        if (!waits.empty())
+        {
+            auto op_functor = functors.back();
+            functors.back() = [waits, op_functor](CPURuntimeContext* ctx,
+                                                  CPUExecutionContext* ectx) {
+                for (auto& wait : waits)
+                {
+                    wait(ctx);
+                }
+                op_functor(ctx, ectx);
+            };
+        }
+
         auto cacheable = true;
         if (node->is_op())
         {
@@ -1420,7 +1534,7 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
 
         //dump the op's order of execution along with the address of
         //tensor_data which holds the base address of each tensor.
-        for (shared_ptr<Node> node : m_function->get_ordered_ops())
+        for (shared_ptr<Node> node : *ordered_ops)
         {
             std::vector<string> node_inputs;
             std::vector<string> node_outputs;
@@ -1504,8 +1618,10 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
                                     {
                                         start_ts = cpu::Clock::now();
                                     }
-                                    CPUExecutionContext ectx{0};
-                                    executor::GetCPUExecutor().execute(*functor, ctx, &ectx, true);
+                                    auto& cpu_executor = executor::GetCPUExecutor();
+                                    cpu_executor.wait_for_turn(ctx->priority, m_device_index);
+                                    CPUExecutionContext ectx{m_device_index};
+                                    cpu_executor.execute(*functor, ctx, &ectx, true);
                                     if (runtime::cpu::IsTracingEnabled() || m_emit_timing)
                                     {
                                         end_ts = cpu::Clock::now();
@@ -1626,8 +1742,11 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
                     {
                         start_ts = cpu::Clock::now();
                     }
-                    CPUExecutionContext ectx{0};
-                    executor::GetCPUExecutor().execute(functors.at(ctx->pc), ctx, &ectx);
+                    // Op boundary, yield to calls of higher priority
+                    auto& cpu_executor = executor::GetCPUExecutor();
+                    cpu_executor.wait_for_turn(ctx->priority, m_device_index);
+                    CPUExecutionContext ectx{m_device_index};
+                    cpu_executor.execute(functors.at(ctx->pc), ctx, &ectx);
                     if (ctx->breakpoints.count(ctx->pc + 1))
                     {
                         ctx->pc++;
@@ -1667,6 +1786,10 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
                 }
             }
         }
+        for (auto& async_output : m_async_outputs)
+        {
+            async_output.second(ctx);
+        }
         ctx->first_iteration = false;
         if (runtime::cpu::IsTracingEnabled())
         {
@@ -120,6 +120,11 @@ namespace ngraph
                     return m_states.size() - 1;
                 }
 
+                /// \brief Reserves an entry of CPURuntimeContext::pending_allreduces, so every
+                ///        call context tracks the requests of its own AllReduce ops.
+                size_t add_allreduce() { return m_allreduce_count++; }
+                size_t get_allreduce_count() const { return m_allreduce_count; }
+
                 const std::string& get_function_name() const { return m_function_name; }
                 const std::shared_ptr<ngraph::Function> get_function() { return m_function; }
                 // Temporary Memory Pool alignment
@@ -138,6 +143,29 @@ namespace ngraph
                     return callees;
                 }
                 bool is_direct_execution() const { return m_direct_execution; }
+                bool uses_tbb() const { return m_use_tbb; }
+                /// \brief Marks tensor `name` as completed asynchronously by the op producing
+                ///        it. Ops reading the tensor, and the end of every call, run `wait` first.
+                ///        Must be called by the builder of the producing op.
+                void add_async_output(const std::string& name,
+                                      std::function<void(CPURuntimeContext*)> wait)
+                {
+                    m_async_outputs[name] = wait;
+                }
+                /// \brief Executor thread pool the function runs on.
+                int get_thread_pool_index() const { return m_thread_pool_index; }
+                /// \brief Sets the priority class of the calls of the function and the number
+                ///        of cores each op may use, 0 for all cores of its thread pool. Takes
+                ///        effect for calls that start afterwards.
+                void set_scheduling(ExecutionPriority priority, int core_budget);
+                ExecutionPriority get_priority() const { return m_priority; }
+                /// \brief Executor device the ops of the function run on.
+                int get_device_index() const { return m_device_index; }
+                /// \brief Data and size of each constant of the function.
+                const std::vector<std::pair<void*, size_t>>& get_constant_memory() const
+                {
+                    return m_constant_memory;
+                }
                 void write_to_file(const std::string& code,
                                    const std::string& directory,
                                    const std::string& filename);
@@ -174,6 +202,7 @@ namespace ngraph
 #endif
 
                 std::vector<ngraph::State*> m_states;
+                size_t m_allreduce_count = 0;
 
             private:
                 // Register passes that are common to codegen and DEX
@@ -287,7 +316,13 @@ namespace ngraph
                 std::list<std::tuple<std::reference_wrapper<void*>, size_t, size_t>>
                     function_output_index_offset;
                 std::unordered_map<std::string, std::shared_ptr<CPU_ExternalFunction>> callees;
+                std::unordered_map<std::string, std::function<void(CPURuntimeContext*)>>
+                    m_async_outputs;
                 bool m_is_built;
+                int m_thread_pool_index;
+                ExecutionPriority m_priority;
+                int m_device_index;
+                std::vector<std::pair<void*, size_t>> m_constant_memory;
                 std::vector<runtime::PerformanceCounter> m_perf_counters;
 
 #if defined(NGRAPH_HALIDE)
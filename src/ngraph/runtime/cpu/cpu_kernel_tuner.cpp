@@ -0,0 +1,240 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <sstream>
+
+#include "ngraph/assertion.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
+#include "ngraph/runtime/cpu/cpu_external_function.hpp"
+#include "ngraph/runtime/cpu/cpu_kernel_tuner.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Each candidate runs at most this many times, and stops after the time budget once it ran twice
+static const size_t s_max_runs = 10;
+static const size_t s_time_budget_ns = 50 * 1000 * 1000;
+
+runtime::cpu::CPUKernelTuner& runtime::cpu::CPUKernelTuner::get()
+{
+    static CPUKernelTuner s_tuner;
+    return s_tuner;
+}
+
+const string& runtime::cpu::CPUKernelTuner::get_cpu_model()
+{
+    static const string s_cpu_model = []() {
+        ifstream cpuinfo("/proc/cpuinfo");
+        string line;
+        while (getline(cpuinfo, line))
+        {
+            if (line.compare(0, 10, "model name") == 0)
+            {
+                auto colon = line.find(':');
+                if (colon != string::npos)
+                {
+                    return trim(line.substr(colon + 1));
+                }
+            }
+        }
+        return string("unknown");
+    }();
+    return s_cpu_model;
+}
+
+void runtime::cpu::CPUKernelTuner::load(const string& path)
+{
+    if (path == m_path)
+    {
+        return;
+    }
+    m_path = path;
+    m_decisions.clear();
+
+    // One decision per line, the key and the name of the kernel separated by a tab
+    ifstream database(path);
+    string line;
+    while (getline(database, line))
+    {
+        auto tab = line.rfind('\t');
+        if (tab != string::npos)
+        {
+            m_decisions[line.substr(0, tab)] = line.substr(tab + 1);
+        }
+    }
+}
+
+size_t runtime::cpu::CPUKernelTuner::time(CPU_ExternalFunction* external_function,
+                                          const vector<TensorViewWrapper>& args,
+                                          const vector<TensorViewWrapper>& out,
+                                          const vector<Candidate>& candidates)
+{
+    // Tensors are only allocated when the executable is called, the candidates run on scratch
+    // tensors that the data pointers they captured are redirected to meanwhile
+    vector<pair<void**, void*>> saved;
+    vector<unique_ptr<AlignedBuffer>> scratch;
+    auto bind = [&](const TensorViewWrapper& tv, bool input) {
+        void*& data = external_function->get_tensor_data(tv.get_name());
+        for (auto& s : saved)
+        {
+            if (s.first == &data)
+            {
+                return;
+            }
+        }
+        saved.emplace_back(&data, data);
+        size_t size = tv.get_tensor()->size();
+        scratch.emplace_back(new AlignedBuffer(max<size_t>(size, 1), 64));
+        data = scratch.back()->get_ptr();
+        memset(data, 0, size);
+        // Small values so that the kernels of exp-based ops take their common path
+        if (input && tv.get_element_type() == element::f32)
+        {
+            auto values = static_cast<float*>(data);
+            for (size_t i = 0; i < size / sizeof(float); i++)
+            {
+                values[i] = static_cast<float>(i % 17) * 0.125f - 1.0f;
+            }
+        }
+    };
+    for (auto& arg : args)
+    {
+        bind(arg, true);
+    }
+    for (auto& result : out)
+    {
+        bind(result, false);
+    }
+
+    CPUExecutionContext ectx{0};
+    size_t best = 0;
+    size_t best_time = numeric_limits<size_t>::max();
+    for (size_t i = 0; i < candidates.size(); i++)
+    {
+        auto& functor = candidates[i].functor;
+        stopwatch timer;
+        // The first run warms the caches and is not counted
+        functor(nullptr, &ectx);
+        size_t fastest = numeric_limits<size_t>::max();
+        for (size_t run = 0; run < s_max_runs; run++)
+        {
+            timer.start();
+            functor(nullptr, &ectx);
+            timer.stop();
+            fastest = min(fastest, timer.get_nanoseconds());
+            // A candidate already slower than the best one is not worth more runs
+            if (fastest / 2 > best_time ||
+                (run > 0 && timer.get_total_nanoseconds() > s_time_budget_ns))
+            {
+                break;
+            }
+        }
+        NGRAPH_DEBUG << "Kernel " << candidates[i].name << ": " << fastest << "ns";
+        if (fastest < best_time)
+        {
+            best = i;
+            best_time = fastest;
+        }
+    }
+
+    for (auto& s : saved)
+    {
+        *s.first = s.second;
+    }
+    return best;
+}
+
+runtime::cpu::CPUKernelFunctor
+    runtime::cpu::CPUKernelTuner::select(CPU_ExternalFunction* external_function,
+                                         const Node* node,
+                                         const vector<TensorViewWrapper>& args,
+                                         const vector<TensorViewWrapper>& out,
+                                         const string& attributes,
+                                         const vector<Candidate>& candidates)
+{
+    NGRAPH_ASSERT(!candidates.empty()) << "No kernel to select for " << node->get_name();
+
+    const char* path = getenv("NGRAPH_CPU_TUNING_DB");
+    bool autotune = getenv("NGRAPH_CPU_AUTOTUNE") != nullptr;
+    lock_guard<mutex> lock(m_mutex);
+    auto selected = [this](const Candidate& candidate) {
+        m_selection_counts[candidate.name]++;
+        return candidate.functor;
+    };
+    if (candidates.size() == 1 || (path == nullptr && !autotune))
+    {
+        return selected(candidates[0]);
+    }
+
+    stringstream key;
+    key << node->description();
+    for (auto& arg : args)
+    {
+        key << " " << arg.get_element_type().c_type_string() << arg.get_shape();
+    }
+    key << " ->";
+    for (auto& result : out)
+    {
+        key << " " << result.get_element_type().c_type_string() << result.get_shape();
+    }
+    key << " " << attributes << " " << get_cpu_model();
+
+    load(path ? path : "");
+    auto decision = m_decisions.find(key.str());
+    if (decision != m_decisions.end())
+    {
+        for (auto& candidate : candidates)
+        {
+            if (candidate.name == decision->second)
+            {
+                return selected(candidate);
+            }
+        }
+    }
+    if (!autotune)
+    {
+        return selected(candidates[0]);
+    }
+
+    auto& best = candidates[time(external_function, args, out, candidates)];
+    NGRAPH_DEBUG << "Selected kernel " << best.name << " for " << key.str();
+    m_decisions[key.str()] = best.name;
+    if (path)
+    {
+        ofstream database(path, ios::app);
+        database << key.str() << "\t" << best.name << "\n";
+        if (!database)
+        {
+            NGRAPH_WARN << "Could not write to the tuning database " << path;
+        }
+    }
+    return selected(best);
+}
+
+size_t runtime::cpu::CPUKernelTuner::get_selection_count(const string& name)
+{
+    lock_guard<mutex> lock(m_mutex);
+    auto count = m_selection_counts.find(name);
+    return count == m_selection_counts.end() ? 0 : count->second;
+}
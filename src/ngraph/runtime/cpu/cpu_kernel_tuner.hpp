@@ -0,0 +1,88 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ngraph/node.hpp"
+#include "ngraph/runtime/cpu/cpu_runtime_context.hpp"
+#include "ngraph/runtime/cpu/cpu_tensor_view_wrapper.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            class CPU_ExternalFunction;
+
+            /// \brief Picks the kernel an op instance runs with among the alternatives its
+            ///        builder has, by timing them on the shapes of the instance.
+            ///
+            /// Decisions are kept in a tuning database keyed by the op, the shapes and element
+            /// types of its inputs and outputs, the attributes the kernels depend on and the CPU
+            /// model. NGRAPH_CPU_TUNING_DB names the file the database is read from and written
+            /// to. Ops without a decision are timed while compiling when NGRAPH_CPU_AUTOTUNE is
+            /// set, otherwise they run the first candidate, the builder's heuristic choice.
+            class CPUKernelTuner
+            {
+            public:
+                struct Candidate
+                {
+                    std::string name;
+                    // Must not use the runtime context, which does not exist while compiling
+                    CPUKernelFunctor functor;
+                };
+
+                static CPUKernelTuner& get();
+
+                /// \brief Returns the functor of the candidate to run `node` with.
+                /// \param attributes Node attributes, other than shapes and types, that the
+                ///        relative speed of the candidates depends on
+                CPUKernelFunctor select(CPU_ExternalFunction* external_function,
+                                        const Node* node,
+                                        const std::vector<TensorViewWrapper>& args,
+                                        const std::vector<TensorViewWrapper>& out,
+                                        const std::string& attributes,
+                                        const std::vector<Candidate>& candidates);
+
+                /// \brief The model name of the CPU, part of every key
+                static const std::string& get_cpu_model();
+
+                /// \brief How many times a candidate named `name` was selected so far
+                size_t get_selection_count(const std::string& name);
+
+            private:
+                CPUKernelTuner() {}
+                void load(const std::string& path);
+                size_t time(CPU_ExternalFunction* external_function,
+                            const std::vector<TensorViewWrapper>& args,
+                            const std::vector<TensorViewWrapper>& out,
+                            const std::vector<Candidate>& candidates);
+
+                std::mutex m_mutex;
+                // Database file the decisions were loaded from
+                std::string m_path;
+                std::unordered_map<std::string, std::string> m_decisions;
+                std::unordered_map<std::string, size_t> m_selection_counts;
+            };
+        }
+    }
+}
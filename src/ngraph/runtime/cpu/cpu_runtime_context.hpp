@@ -28,6 +28,8 @@
 
 #ifdef NGRAPH_DISTRIBUTED_MLSL_ENABLE
 #include <mlsl.hpp>
+#elif NGRAPH_DISTRIBUTED_OMPI_ENABLE
+#include <mpi.h>
 #endif
 
 namespace mkldnn
@@ -51,10 +53,36 @@ namespace ngraph
     {
         namespace cpu
         {
+            struct MKLDNNPrimitiveCacheEntry;
+
+#ifdef NGRAPH_DISTRIBUTED_ENABLE
+#ifdef NGRAPH_DISTRIBUTED_MLSL_ENABLE
+            using AllReduceRequest = MLSL::CommReq*;
+#elif NGRAPH_DISTRIBUTED_OMPI_ENABLE
+            using AllReduceRequest = MPI_Request;
+#endif
+
+            // AllReduce started by a call and not yet waited for
+            struct PendingAllReduce
+            {
+                AllReduceRequest request;
+                bool pending = false;
+            };
+#endif
+
             typedef std::chrono::high_resolution_clock Clock;
             typedef std::chrono::time_point<Clock> Timestamp;
             typedef std::chrono::microseconds Timescale;
 
+            /// \brief Scheduling class of an executable. Calls of a class wait at op boundaries
+            ///        while calls of higher classes are using the cores they need.
+            enum class ExecutionPriority
+            {
+                LOW,
+                NORMAL,
+                HIGH
+            };
+
             extern "C" {
             struct CPURuntimeContext
             {
@@ -62,6 +90,7 @@ namespace ngraph
                 bool* p_en;
                 bool first_iteration;
                 mkldnn::primitive* const* mkldnn_primitives;
+                MKLDNNPrimitiveCacheEntry* const* mkldnn_primitive_owners;
                 std::vector<AlignedBuffer*> memory_buffers;
                 char* const* mkldnn_workspaces;
                 tbb::flow::graph* G;
@@ -69,6 +98,11 @@ namespace ngraph
                 State* const* states;
                 std::set<size_t> breakpoints;
                 size_t pc;
+                ExecutionPriority priority;
+#ifdef NGRAPH_DISTRIBUTED_ENABLE
+                // Indexed as allocated by CPU_ExternalFunction::add_allreduce()
+                PendingAllReduce* pending_allreduces;
+#endif
 #ifdef NGRAPH_DISTRIBUTED_MLSL_ENABLE
                 MLSL::Environment* mlsl_env;
                 MLSL::Distribution* mlsl_dist;
@@ -20,6 +20,7 @@
 #include "cpu_tensor_view.hpp"
 #include "ngraph/descriptor/layout/tensor_layout.hpp"
 #include "ngraph/except.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
@@ -30,6 +31,26 @@ using namespace mkldnn;
 using namespace ngraph;
 using namespace std;
 
+struct runtime::cpu::CPUTensorView::ReadReorder
+{
+    ReadReorder(const shared_ptr<descriptor::layout::TensorLayout>& layout,
+                const memory::desc& input_desc,
+                const memory::desc& output_desc,
+                void* source,
+                void* target)
+        : layout(layout)
+        , input({input_desc, executor::global_cpu_engine}, source)
+        , output({output_desc, executor::global_cpu_engine}, target)
+        , prim(input, output)
+    {
+    }
+
+    shared_ptr<descriptor::layout::TensorLayout> layout;
+    memory input;
+    memory output;
+    reorder prim;
+};
+
 // TODO(jmenon): Refactor all the alignment specifications into
 // a single place and allow lower or no alignment when possible
 
@@ -101,6 +122,19 @@ void runtime::cpu::CPUTensorView::write(const void* source, size_t tensor_offset
     {
         throw out_of_range("write access past end of tensor");
     }
+    auto cpu_tvl = dynamic_pointer_cast<runtime::cpu::LayoutDescriptor>(get_tensor_layout());
+    if (cpu_tvl && cpu_tvl->is_mkldnn_layout())
+    {
+        // The bytes a partial write leaves alone must be row-major as well
+        if (tensor_offset != 0 || n != buffer_size)
+        {
+            AlignedBuffer native(buffer_size, BufferAlignment);
+            read(native.get_ptr(), 0, buffer_size);
+            memcpy(get_data_ptr(), native.get_ptr(), buffer_size);
+        }
+        m_descriptor->set_tensor_layout(
+            std::make_shared<runtime::cpu::LayoutDescriptor>(*m_descriptor));
+    }
     char* target = get_data_ptr();
     memcpy(&target[tensor_offset], source, n);
 }
@@ -137,18 +171,23 @@ void runtime::cpu::CPUTensorView::read(void* target, size_t tensor_offset, size_
         return true;
     };
 
-    if (needs_conversion())
+    lock_guard<mutex> lock(m_read_reorder_mutex);
+    if (m_read_reorder && m_read_reorder->layout == tvl)
+    {
+        m_read_reorder->output.set_data_handle(target);
+        mkldnn::stream s(mkldnn::stream::kind::eager);
+        s.submit({m_read_reorder->prim}).wait();
+    }
+    else if (needs_conversion())
     {
-        auto tensor_shape = this->get_shape();
         auto input_desc = cpu_tvl->get_mkldnn_md();
         auto output_desc = mkldnn_utils::create_blocked_mkldnn_md(
             this->get_shape(), cpu_tvl->get_strides(), this->get_element_type());
 
-        memory input{{input_desc, executor::global_cpu_engine}, aligned_buffer};
-        memory output{{output_desc, executor::global_cpu_engine}, target};
-        reorder prim{input, output};
+        m_read_reorder.reset(
+            new ReadReorder(tvl, input_desc, output_desc, aligned_buffer, target));
         mkldnn::stream s(mkldnn::stream::kind::eager);
-        s.submit({prim}).wait();
+        s.submit({m_read_reorder->prim}).wait();
     }
     else
     {
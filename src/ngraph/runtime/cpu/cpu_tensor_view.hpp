@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <memory>
+#include <mutex>
 #include <string>
 
 #include "ngraph/runtime/tensor.hpp"
@@ -46,6 +48,10 @@ namespace ngraph
                 const char* get_data_ptr() const;
 
                 /// \brief Write bytes directly into the tensor
+                ///
+                /// The data is taken as row-major; a blocked layout the tensor got as the output
+                /// of an earlier call is dropped, after converting the rest of the tensor to
+                /// row-major when the write is partial.
                 /// \param p Pointer to source of data
                 /// \param tensor_offset Offset into tensor storage to begin writing. Must be element-aligned.
                 /// \param n Number of bytes to write, must be integral number of elements.
@@ -64,9 +70,16 @@ namespace ngraph
                 CPUTensorView(CPUTensorView&&) = delete;
                 CPUTensorView& operator=(const CPUTensorView&) = delete;
 
+                struct ReadReorder;
+
                 char* buffer;
                 char* aligned_buffer;
                 size_t buffer_size;
+
+                // Conversion from a blocked layout to row-major, reused across reads while
+                // the layout stays the same
+                mutable std::unique_ptr<ReadReorder> m_read_reorder;
+                mutable std::mutex m_read_reorder_mutex;
             };
         }
     }
@@ -0,0 +1,279 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <utility>
+
+#ifdef __linux__
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "ngraph/file_util.hpp"
+#include "ngraph/runtime/cpu/cpu_topology.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Returns the integer in a sysfs file, or -1 when the file cannot be read
+static int read_int(const string& path)
+{
+    if (!file_util::exists(path))
+    {
+        return -1;
+    }
+    istringstream ss(file_util::read_file_to_string(path));
+    int value = -1;
+    ss >> value;
+    return value;
+}
+
+// Numbers of the entries named `prefix`<number> in `directory`
+static vector<int> get_numbered_entries(const string& directory, const string& prefix)
+{
+    vector<int> numbers;
+    if (!file_util::exists(directory))
+    {
+        return numbers;
+    }
+    file_util::iterate_files(directory, [&](const string& path, bool is_dir) {
+        string name = file_util::get_file_name(path);
+        if (is_dir && name.compare(0, prefix.size(), prefix) == 0 && name.size() > prefix.size() &&
+            name.find_first_not_of("0123456789", prefix.size()) == string::npos)
+        {
+            numbers.push_back(stoi(name.substr(prefix.size())));
+        }
+    });
+    sort(numbers.begin(), numbers.end());
+    return numbers;
+}
+
+vector<int> runtime::cpu::parse_cpu_list(const string& list)
+{
+    vector<int> cpus;
+    istringstream ss(list);
+    string range;
+    while (getline(ss, range, ','))
+    {
+        istringstream range_ss(range);
+        int first;
+        if (!(range_ss >> first))
+        {
+            continue;
+        }
+        int last = first;
+        char dash;
+        if (range_ss >> dash && dash == '-')
+        {
+            range_ss >> last;
+        }
+        for (int cpu = first; cpu <= last; cpu++)
+        {
+            cpus.push_back(cpu);
+        }
+    }
+    return cpus;
+}
+
+vector<runtime::cpu::NumaNode> runtime::cpu::get_numa_topology(const string& sysfs_root)
+{
+    string cpu_root = file_util::path_join(sysfs_root, "cpu");
+    vector<int> online_cpus;
+    string online_path = file_util::path_join(cpu_root, "online");
+    if (file_util::exists(online_path))
+    {
+        online_cpus = parse_cpu_list(file_util::read_file_to_string(online_path));
+    }
+    else
+    {
+        online_cpus = get_numbered_entries(cpu_root, "cpu");
+    }
+    set<int> online(online_cpus.begin(), online_cpus.end());
+
+    auto read_topology = [&](int cpu, const string& entry) {
+        return read_int(file_util::path_join(cpu_root, "cpu" + to_string(cpu), "topology", entry));
+    };
+
+    // Group the online CPUs by node, or by socket on kernels without NUMA support
+    map<int, vector<int>> node_cpus;
+    string node_root = file_util::path_join(sysfs_root, "node");
+    for (int node : get_numbered_entries(node_root, "node"))
+    {
+        string cpu_list = file_util::path_join(node_root, "node" + to_string(node), "cpulist");
+        for (int cpu : parse_cpu_list(file_util::read_file_to_string(cpu_list)))
+        {
+            if (online.count(cpu) != 0)
+            {
+                node_cpus[node].push_back(cpu);
+            }
+        }
+    }
+    if (node_cpus.empty())
+    {
+        for (int cpu : online_cpus)
+        {
+            node_cpus[max(read_topology(cpu, "physical_package_id"), 0)].push_back(cpu);
+        }
+    }
+
+    vector<NumaNode> nodes;
+    for (auto& entry : node_cpus)
+    {
+        NumaNode node{entry.first, {}};
+        set<pair<int, int>> cores;
+        for (int cpu : entry.second)
+        {
+            int package = read_topology(cpu, "physical_package_id");
+            int core = read_topology(cpu, "core_id");
+            // Without topology information every CPU counts as a core
+            if (core < 0 || cores.insert(make_pair(package, core)).second)
+            {
+                node.cpus.push_back(cpu);
+            }
+        }
+        if (!node.cpus.empty())
+        {
+            nodes.push_back(node);
+        }
+    }
+    return nodes;
+}
+
+bool runtime::cpu::pin_current_thread(const vector<int>& cpus)
+{
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (int cpu : cpus)
+    {
+        if (cpu >= 0 && cpu < CPU_SETSIZE)
+        {
+            CPU_SET(cpu, &set);
+        }
+    }
+    return CPU_COUNT(&set) > 0 && sched_setaffinity(0, sizeof(set), &set) == 0;
+#else
+    return false;
+#endif
+}
+
+bool runtime::cpu::bind_memory_to_node(void* data, size_t size, int node)
+{
+#if defined(__linux__) && defined(SYS_mbind)
+    // Values of MPOL_PREFERRED and MPOL_MF_MOVE from <linux/mempolicy.h>. A preferred node
+    // rather than a strict binding, so allocations fall back to other nodes when it is full.
+    const int mpol_preferred = 1;
+    const unsigned long mpol_mf_move = 1 << 1;
+    const size_t bits = sizeof(unsigned long) * CHAR_BIT;
+
+    uintptr_t page_size = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+    uintptr_t begin = (reinterpret_cast<uintptr_t>(data) + page_size - 1) & ~(page_size - 1);
+    uintptr_t end = (reinterpret_cast<uintptr_t>(data) + size) & ~(page_size - 1);
+    if (node < 0 || begin >= end)
+    {
+        return false;
+    }
+    vector<unsigned long> node_mask(node / bits + 1, 0);
+    node_mask[node / bits] |= 1UL << (node % bits);
+    // The kernel reads one bit less than the maximum node passed
+    return syscall(SYS_mbind,
+                   begin,
+                   end - begin,
+                   mpol_preferred,
+                   node_mask.data(),
+                   node_mask.size() * bits + 1,
+                   mpol_mf_move) == 0;
+#else
+    return false;
+#endif
+}
+
+void runtime::cpu::prefault_memory(const void* data, size_t size)
+{
+#ifdef __linux__
+    size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#else
+    size_t page_size = 4096;
+#endif
+    auto bytes = static_cast<const volatile char*>(data);
+    for (size_t offset = 0; offset < size; offset += page_size)
+    {
+        (void)bytes[offset];
+    }
+}
+
+#ifdef __linux__
+// Number of locks held on each locked page. The kernel does not count them, so a page is only
+// unlocked once the last range on it is.
+static mutex s_page_locks_mutex;
+static map<uintptr_t, size_t> s_page_locks;
+#endif
+
+bool runtime::cpu::lock_memory(const void* data, size_t size)
+{
+#ifdef __linux__
+    if (size == 0)
+    {
+        return true;
+    }
+    if (mlock(data, size) != 0)
+    {
+        return false;
+    }
+    uintptr_t page_size = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+    uintptr_t first = reinterpret_cast<uintptr_t>(data) & ~(page_size - 1);
+    uintptr_t last = (reinterpret_cast<uintptr_t>(data) + size - 1) & ~(page_size - 1);
+    lock_guard<mutex> lock(s_page_locks_mutex);
+    for (uintptr_t page = first; page <= last; page += page_size)
+    {
+        s_page_locks[page]++;
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
+void runtime::cpu::unlock_memory(const void* data, size_t size)
+{
+#ifdef __linux__
+    if (size == 0)
+    {
+        return;
+    }
+    uintptr_t page_size = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+    uintptr_t first = reinterpret_cast<uintptr_t>(data) & ~(page_size - 1);
+    uintptr_t last = (reinterpret_cast<uintptr_t>(data) + size - 1) & ~(page_size - 1);
+    lock_guard<mutex> lock(s_page_locks_mutex);
+    for (uintptr_t page = first; page <= last; page += page_size)
+    {
+        auto locks = s_page_locks.find(page);
+        if (locks != s_page_locks.end() && --locks->second == 0)
+        {
+            s_page_locks.erase(locks);
+            munlock(reinterpret_cast<void*>(page), page_size);
+        }
+    }
+#endif
+}
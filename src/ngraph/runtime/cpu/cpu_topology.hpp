@@ -0,0 +1,67 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            struct NumaNode
+            {
+                int id;
+                // One logical CPU per physical core, hyperthread siblings are left out
+                std::vector<int> cpus;
+            };
+
+            /// \brief Reads the NUMA nodes of the host from the Linux sysfs tree under
+            ///        `sysfs_root`. When the kernel exposes no NUMA nodes, every socket is
+            ///        reported as a node. Returns an empty vector when the topology cannot be
+            ///        read.
+            std::vector<NumaNode>
+                get_numa_topology(const std::string& sysfs_root = "/sys/devices/system");
+
+            /// \brief Parses a sysfs CPU or node list such as "0-3,8,10-11".
+            std::vector<int> parse_cpu_list(const std::string& list);
+
+            /// \brief Restricts the calling thread to `cpus`. Returns false when the affinity
+            ///        cannot be set.
+            bool pin_current_thread(const std::vector<int>& cpus);
+
+            /// \brief Places the pages of [data, data + size) on NUMA node `node`, moving the
+            ///        pages that are already mapped. Pages only partially in the range are left
+            ///        alone. Returns false when the pages cannot be placed.
+            bool bind_memory_to_node(void* data, size_t size, int node);
+
+            /// \brief Maps the pages of [data, data + size) in by reading a byte of each.
+            void prefault_memory(const void* data, size_t size);
+
+            /// \brief Locks the pages of [data, data + size) in RAM. Locks nest: a page stays
+            ///        locked until each range locked on it is unlocked, so memory shared by
+            ///        several executables can be locked and unlocked by each. Returns false when
+            ///        the pages cannot be locked, e.g. over RLIMIT_MEMLOCK.
+            bool lock_memory(const void* data, size_t size);
+            /// \brief Releases a lock taken by lock_memory on the same range.
+            void unlock_memory(const void* data, size_t size);
+        }
+    }
+}
@@ -0,0 +1,104 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+
+#include "ngraph/op/constant.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/cpu/cpu_external_function.hpp"
+#include "ngraph/runtime/cpu/cpu_weight_store.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+runtime::cpu::CPUWeightStore& runtime::cpu::CPUWeightStore::get()
+{
+    static CPUWeightStore s_store;
+    return s_store;
+}
+
+shared_ptr<runtime::AlignedBuffer>
+    runtime::cpu::CPUWeightStore::get_converted(const shared_ptr<ngraph::op::Constant>& constant,
+                                                const mkldnn::memory::desc& input_md,
+                                                const mkldnn::memory::desc& result_md)
+{
+    size_t content_hash = constant->get_content_hash();
+    string key(reinterpret_cast<const char*>(&content_hash), sizeof(content_hash));
+    key.append(reinterpret_cast<const char*>(&input_md.data), sizeof(input_md.data));
+    key.append(reinterpret_cast<const char*>(&result_md.data), sizeof(result_md.data));
+
+    {
+        lock_guard<mutex> lock(m_mutex);
+        auto range = m_entries.equal_range(key);
+        for (auto it = range.first; it != range.second;)
+        {
+            auto buffer = it->second.buffer.lock();
+            if (!buffer)
+            {
+                it = m_entries.erase(it);
+                continue;
+            }
+            auto source = it->second.source.lock();
+            if (source && source->get_data_ptr() == constant->get_data_ptr())
+            {
+                return buffer;
+            }
+            ++it;
+        }
+    }
+
+    // Padded blocked layouts leave the padding untouched, zero it so equal conversions compare
+    // equal
+    size_t size =
+        mkldnn::memory::primitive_desc(result_md, executor::global_cpu_engine).get_size();
+    auto converted =
+        make_shared<AlignedBuffer>(size, CPU_ExternalFunction::s_memory_pool_alignment);
+    memset(converted->get_ptr(), 0, size);
+    mkldnn::memory input{{input_md, executor::global_cpu_engine},
+                         const_cast<void*>(constant->get_data_ptr())};
+    mkldnn::memory output{{result_md, executor::global_cpu_engine}, converted->get_ptr()};
+    mkldnn::reorder prim{input, output};
+    mkldnn::stream s(mkldnn::stream::kind::eager);
+    s.submit({prim}).wait();
+
+    lock_guard<mutex> lock(m_mutex);
+    auto range = m_entries.equal_range(key);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        auto buffer = it->second.buffer.lock();
+        if (buffer && it->second.size == size &&
+            memcmp(buffer->get_ptr(), converted->get_ptr(), size) == 0)
+        {
+            it->second.source = constant;
+            return buffer;
+        }
+    }
+    m_entries.emplace(key, Entry{constant, converted, size});
+
+    // Drop the entries freed since the last sweep, at a cost amortized over the insertions
+    if (m_entries.size() >= m_sweep_size)
+    {
+        for (auto it = m_entries.begin(); it != m_entries.end();)
+        {
+            it = it->second.buffer.expired() ? m_entries.erase(it) : next(it);
+        }
+        m_sweep_size = max<size_t>(1024, 2 * m_entries.size());
+    }
+    return converted;
+}
@@ -0,0 +1,76 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <mkldnn.hpp>
+
+namespace ngraph
+{
+    namespace op
+    {
+        class Constant;
+    }
+
+    namespace runtime
+    {
+        class AlignedBuffer;
+
+        namespace cpu
+        {
+            /// \brief Process-wide store of constants converted to the MKLDNN layouts their
+            ///        consumers run in, keyed by the content of the constant and the layouts.
+            ///
+            /// Executables compiled from the same model, e.g. for several batch sizes, share one
+            /// copy of each converted weight rather than reorder it into their own memory pools.
+            /// Converted data is refcounted by the constants built on it and freed with the last
+            /// executable using it. Conversions of equal constants that do not share their data
+            /// are found by the content hash of the constants and compared byte for byte.
+            class CPUWeightStore
+            {
+            public:
+                static CPUWeightStore& get();
+
+                /// \brief Returns the data of `constant` reordered from `input_md` to `result_md`,
+                ///        converting it unless an equal conversion is alive.
+                std::shared_ptr<AlignedBuffer>
+                    get_converted(const std::shared_ptr<ngraph::op::Constant>& constant,
+                                  const mkldnn::memory::desc& input_md,
+                                  const mkldnn::memory::desc& result_md);
+
+            private:
+                struct Entry
+                {
+                    // Constant the data was last converted from, to skip the conversion when
+                    // the same data is converted again
+                    std::weak_ptr<ngraph::op::Constant> source;
+                    std::weak_ptr<AlignedBuffer> buffer;
+                    size_t size;
+                };
+
+                CPUWeightStore() {}
+                std::mutex m_mutex;
+                size_t m_sweep_size{1024};
+                std::unordered_multimap<std::string, Entry> m_entries;
+            };
+        }
+    }
+}
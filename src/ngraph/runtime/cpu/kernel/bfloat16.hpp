@@ -0,0 +1,352 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/cpu/cpu_kernels.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // bfloat16 tensors hold the upper 16 bits of the equivalent floats. The
+                // conversions work on the raw bits so that the loops vectorize.
+                inline void bf16_to_f32(const uint16_t* in, float* out, size_t count)
+                {
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        uint32_t bits = static_cast<uint32_t>(in[i]) << 16;
+                        std::memcpy(out + i, &bits, sizeof(float));
+                    }
+                }
+
+                // Rounds to nearest even, NaNs stay quiet NaNs
+                inline void f32_to_bf16(const float* in, uint16_t* out, size_t count)
+                {
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        uint32_t bits;
+                        std::memcpy(&bits, in + i, sizeof(float));
+                        uint32_t rounded = (bits + 0x7fff + ((bits >> 16) & 1)) >> 16;
+                        uint32_t nan = (bits >> 16) | 0x40;
+                        bool is_nan = (bits & 0x7fffffff) > 0x7f800000;
+                        out[i] = static_cast<uint16_t>(is_nan ? nan : rounded);
+                    }
+                }
+
+                // Splits [0, count) across the threads of the arena in blocks that fit a
+                // float buffer on the stack
+                const Eigen::Index bf16_block_size = 1024;
+
+                template <typename Block>
+                void for_each_bf16_block(size_t count,
+                                         const Eigen::TensorOpCost& cost,
+                                         int arena,
+                                         Block block)
+                {
+                    auto run_range = [&](Eigen::Index first, Eigen::Index last) {
+                        for (Eigen::Index i = first; i < last; i += bf16_block_size)
+                        {
+                            block(i, std::min(bf16_block_size, last - i));
+                        }
+                    };
+                    ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        count, cost, run_range);
+                }
+
+                inline void convert_bf16_to_f32(void* input, void* output, size_t count, int arena)
+                {
+                    Eigen::TensorOpCost cost(2, 4, 1);
+                    for_each_bf16_block(count, cost, arena, [&](Eigen::Index i, Eigen::Index n) {
+                        bf16_to_f32(
+                            static_cast<uint16_t*>(input) + i, static_cast<float*>(output) + i, n);
+                    });
+                }
+
+                inline void convert_f32_to_bf16(void* input, void* output, size_t count, int arena)
+                {
+                    Eigen::TensorOpCost cost(4, 2, 4);
+                    for_each_bf16_block(count, cost, arena, [&](Eigen::Index i, Eigen::Index n) {
+                        f32_to_bf16(
+                            static_cast<float*>(input) + i, static_cast<uint16_t*>(output) + i, n);
+                    });
+                }
+
+                // Elementwise ops on bfloat16 tensors. Each block is widened to float, computed
+                // and rounded back once, so the intermediate result never leaves L1.
+                namespace bf16_ops
+                {
+                    using Array = Eigen::Array<float, Eigen::Dynamic, 1>;
+                    using Map = Eigen::Map<Array>;
+
+                    struct add
+                    {
+                        static void apply(const Map& a, const Map& b, Map& out) { out = a + b; }
+                    };
+                    struct subtract
+                    {
+                        static void apply(const Map& a, const Map& b, Map& out) { out = a - b; }
+                    };
+                    struct multiply
+                    {
+                        static void apply(const Map& a, const Map& b, Map& out) { out = a * b; }
+                    };
+                    struct divide
+                    {
+                        static void apply(const Map& a, const Map& b, Map& out) { out = a / b; }
+                    };
+                    struct maximum
+                    {
+                        static void apply(const Map& a, const Map& b, Map& out)
+                        {
+                            out = a.max(b);
+                        }
+                    };
+                    struct minimum
+                    {
+                        static void apply(const Map& a, const Map& b, Map& out)
+                        {
+                            out = a.min(b);
+                        }
+                    };
+                    struct negative
+                    {
+                        static void apply(const Map& a, Map& out) { out = -a; }
+                    };
+                    struct relu
+                    {
+                        static void apply(const Map& a, Map& out) { out = a.max(0.0f); }
+                    };
+                }
+
+                template <typename Op>
+                void bf16_binary_elementwise(
+                    void* input0, void* input1, void* output, size_t count, int arena)
+                {
+                    Eigen::TensorOpCost cost(4, 2, 8);
+                    for_each_bf16_block(count, cost, arena, [&](Eigen::Index i, Eigen::Index n) {
+                        float a[bf16_block_size], b[bf16_block_size], c[bf16_block_size];
+                        bf16_to_f32(static_cast<uint16_t*>(input0) + i, a, n);
+                        bf16_to_f32(static_cast<uint16_t*>(input1) + i, b, n);
+                        bf16_ops::Map a_map(a, n), b_map(b, n), c_map(c, n);
+                        Op::apply(a_map, b_map, c_map);
+                        f32_to_bf16(c, static_cast<uint16_t*>(output) + i, n);
+                    });
+                }
+
+                template <typename Op>
+                void bf16_unary_elementwise(void* input, void* output, size_t count, int arena)
+                {
+                    Eigen::TensorOpCost cost(2, 2, 6);
+                    for_each_bf16_block(count, cost, arena, [&](Eigen::Index i, Eigen::Index n) {
+                        float a[bf16_block_size], c[bf16_block_size];
+                        bf16_to_f32(static_cast<uint16_t*>(input) + i, a, n);
+                        bf16_ops::Map a_map(a, n), c_map(c, n);
+                        Op::apply(a_map, c_map);
+                        f32_to_bf16(c, static_cast<uint16_t*>(output) + i, n);
+                    });
+                }
+
+                // Float buffers for kernels that compute a bfloat16 op on widened blocks of its
+                // tensors. `slot` tells apart the buffers one kernel uses at the same time.
+                // Buffers of up to bf16_scratch_limit floats are kept per thread for the next
+                // call, larger ones are released when the scratch goes out of scope.
+                const size_t bf16_scratch_limit = 64 * 1024;
+
+                class BF16Scratch
+                {
+                public:
+                    BF16Scratch(size_t slot, size_t count)
+                    {
+                        static thread_local std::vector<float> buffers[3];
+                        auto& buffer = count <= bf16_scratch_limit ? buffers[slot] : m_owned;
+                        if (buffer.size() < count)
+                        {
+                            buffer.resize(count);
+                        }
+                        m_data = buffer.data();
+                    }
+
+                    float* data() { return m_data; }
+
+                private:
+                    std::vector<float> m_owned;
+                    float* m_data;
+                };
+
+                // out[m, n] = arg0[m, k] * arg1[k, n] on bfloat16 matrices, accumulated in float
+                // and rounded once. Like dot_f16_weights, each panel of columns of arg1 and each
+                // block of rows of arg0 is widened right before sgemm reads it, so no operand is
+                // widened as a whole and the float copies stay in cache.
+                inline void dot_bf16(void* arg0,
+                                     void* arg1,
+                                     void* out,
+                                     size_t m,
+                                     size_t k,
+                                     size_t n,
+                                     int arena)
+                {
+                    size_t depth = std::max<size_t>(1, k);
+                    size_t panel_columns =
+                        std::min(n, std::max<size_t>(1, bf16_scratch_limit / depth));
+                    size_t block_rows = std::min(
+                        m,
+                        std::max<size_t>(1,
+                                         std::min(bf16_scratch_limit / depth,
+                                                  bf16_scratch_limit / panel_columns)));
+                    BF16Scratch panel(0, k * panel_columns);
+                    BF16Scratch block(1, block_rows * k);
+                    BF16Scratch result(2, block_rows * panel_columns);
+
+                    uint16_t* a = static_cast<uint16_t*>(arg0);
+                    const uint16_t* b = static_cast<const uint16_t*>(arg1);
+                    uint16_t* c = static_cast<uint16_t*>(out);
+                    auto& device =
+                        ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena);
+                    for (size_t first = 0; first < n; first += panel_columns)
+                    {
+                        size_t columns = std::min(panel_columns, n - first);
+                        float* panel_data = panel.data();
+                        Eigen::TensorOpCost cost(2 * columns, 4 * columns, columns);
+                        device.parallelFor(
+                            k, cost, [&](Eigen::Index first_row, Eigen::Index last_row) {
+                                for (Eigen::Index row = first_row; row < last_row; row++)
+                                {
+                                    bf16_to_f32(b + row * n + first,
+                                                panel_data + row * columns,
+                                                columns);
+                                }
+                            });
+
+                        for (size_t first_row = 0; first_row < m; first_row += block_rows)
+                        {
+                            size_t rows = std::min(block_rows, m - first_row);
+                            convert_bf16_to_f32(a + first_row * k, block.data(), rows * k, arena);
+                            cblas::cblas_sgemm(cblas::Layout::RowMajor,
+                                               cblas::Transpose::None,
+                                               cblas::Transpose::None,
+                                               rows,
+                                               columns,
+                                               k,
+                                               1.0f,
+                                               block.data(),
+                                               k,
+                                               panel_data,
+                                               columns,
+                                               0.0f,
+                                               result.data(),
+                                               columns);
+                            for (size_t row = 0; row < rows; row++)
+                            {
+                                f32_to_bf16(result.data() + row * columns,
+                                            c + (first_row + row) * n + first,
+                                            columns);
+                            }
+                        }
+                    }
+                }
+
+                // Sums a bfloat16 tensor over `reduction_axes` into a float accumulator, one
+                // widened innermost row at a time, and rounds the result once
+                inline void sum_bf16(void* arg,
+                                     void* out,
+                                     const Shape& arg_shape,
+                                     const Shape& out_shape,
+                                     const AxisSet& reduction_axes)
+                {
+                    size_t out_size = shape_size(out_shape);
+                    BF16Scratch accumulator(0, out_size);
+                    float* acc = accumulator.data();
+                    std::fill(acc, acc + out_size, 0.0f);
+
+                    // Stride in the result of each axis of the argument, 0 for reduced axes
+                    Shape shape = arg_shape.empty() ? Shape{1} : arg_shape;
+                    std::vector<size_t> out_strides = row_major_strides(out_shape);
+                    std::vector<size_t> strides(shape.size(), 0);
+                    for (size_t axis = 0, out_axis = 0; axis < arg_shape.size(); axis++)
+                    {
+                        if (reduction_axes.count(axis) == 0)
+                        {
+                            strides[axis] = out_strides[out_axis++];
+                        }
+                    }
+
+                    size_t rank = shape.size();
+                    size_t row_size = shape.back();
+                    size_t row_count = row_size ? shape_size(shape) / row_size : 0;
+                    size_t inner_stride = strides.back();
+                    const uint16_t* in = static_cast<const uint16_t*>(arg);
+                    std::vector<size_t> coordinate(rank - 1, 0);
+                    size_t base = 0;
+                    float row[bf16_block_size];
+                    for (size_t r = 0; r < row_count; r++)
+                    {
+                        for (size_t first = 0; first < row_size; first += bf16_block_size)
+                        {
+                            size_t count = std::min<size_t>(bf16_block_size, row_size - first);
+                            bf16_to_f32(in + r * row_size + first, row, count);
+                            if (inner_stride == 0)
+                            {
+                                float s = acc[base];
+                                for (size_t i = 0; i < count; i++)
+                                {
+                                    s += row[i];
+                                }
+                                acc[base] = s;
+                            }
+                            else
+                            {
+                                float* dst = acc + base + first;
+                                for (size_t i = 0; i < count; i++)
+                                {
+                                    dst[i] += row[i];
+                                }
+                            }
+                        }
+
+                        // Next row: advance the coordinate of the outer axes
+                        for (size_t axis = rank - 1; axis > 0; axis--)
+                        {
+                            base += strides[axis - 1];
+                            if (++coordinate[axis - 1] < shape[axis - 1])
+                            {
+                                break;
+                            }
+                            base -= strides[axis - 1] * shape[axis - 1];
+                            coordinate[axis - 1] = 0;
+                        }
+                    }
+                    f32_to_bf16(acc, static_cast<uint16_t*>(out), out_size);
+                }
+            }
+        }
+    }
+}
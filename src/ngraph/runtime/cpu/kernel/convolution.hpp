@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include "ngraph/runtime/cpu/kernel/bfloat16.hpp"
 #include "ngraph/runtime/reference/convolution.hpp"
 #include "ngraph/shape.hpp"
 
@@ -53,6 +54,45 @@ namespace ngraph
                                                         data_dilation_strides);
                 }
 
+                // Computes a bfloat16 convolution on float copies of its tensors, so the
+                // products are accumulated in float
+                inline void convolution_bf16(void* input0,
+                                             void* input1,
+                                             void* output,
+                                             const Shape& arg0_shape,
+                                             const Shape& arg1_shape,
+                                             const Shape& result_shape,
+                                             const Strides& window_movement_strides,
+                                             const Strides& window_dilation_strides,
+                                             const CoordinateDiff& padding_below,
+                                             const CoordinateDiff& padding_above,
+                                             const Strides& data_dilation_strides)
+                {
+                    size_t arg0_size = shape_size(arg0_shape);
+                    size_t arg1_size = shape_size(arg1_shape);
+                    size_t result_size = shape_size(result_shape);
+                    BF16Scratch in0_scratch(0, arg0_size);
+                    BF16Scratch in1_scratch(1, arg1_size);
+                    BF16Scratch out_scratch(2, result_size);
+                    float* in0 = in0_scratch.data();
+                    float* in1 = in1_scratch.data();
+                    float* out = out_scratch.data();
+                    bf16_to_f32(static_cast<const uint16_t*>(input0), in0, arg0_size);
+                    bf16_to_f32(static_cast<const uint16_t*>(input1), in1, arg1_size);
+                    reference::convolution<float>(in0,
+                                                  in1,
+                                                  out,
+                                                  arg0_shape,
+                                                  arg1_shape,
+                                                  result_shape,
+                                                  window_movement_strides,
+                                                  window_dilation_strides,
+                                                  padding_below,
+                                                  padding_above,
+                                                  data_dilation_strides);
+                    f32_to_bf16(out, static_cast<uint16_t*>(output), result_size);
+                }
+
                 template <typename ElementType>
                 void convolution_backprop_filter(void* input0,
                                                  void* input1,
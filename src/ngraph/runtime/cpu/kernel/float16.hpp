@@ -0,0 +1,182 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#if defined(__F16C__)
+#include <immintrin.h>
+#endif
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/cpu/cpu_kernels.hpp"
+#include "ngraph/runtime/cpu/kernel/bfloat16.hpp"
+#include "ngraph/type/float16.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // Eight lanes at a time with F16C, element by element otherwise
+                inline void f16_to_f32(const uint16_t* in, float* out, size_t count)
+                {
+                    size_t i = 0;
+#if defined(__F16C__)
+                    for (; i + 8 <= count; i += 8)
+                    {
+                        __m128i half = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+                        _mm256_storeu_ps(out + i, _mm256_cvtph_ps(half));
+                    }
+#endif
+                    for (; i < count; i++)
+                    {
+                        out[i] = float16::from_bits(in[i]);
+                    }
+                }
+
+                // Rounds to nearest even
+                inline void f32_to_f16(const float* in, uint16_t* out, size_t count)
+                {
+                    size_t i = 0;
+#if defined(__F16C__)
+                    for (; i + 8 <= count; i += 8)
+                    {
+                        __m128i half =
+                            _mm256_cvtps_ph(_mm256_loadu_ps(in + i), _MM_FROUND_TO_NEAREST_INT);
+                        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), half);
+                    }
+#endif
+                    for (; i < count; i++)
+                    {
+                        out[i] = float16(in[i]).to_bits();
+                    }
+                }
+
+                inline void convert_f16_to_f32(void* input, void* output, size_t count, int arena)
+                {
+                    Eigen::TensorOpCost cost(2, 4, 1);
+                    auto convert_range = [&](Eigen::Index first, Eigen::Index last) {
+                        f16_to_f32(static_cast<uint16_t*>(input) + first,
+                                   static_cast<float*>(output) + first,
+                                   last - first);
+                    };
+                    ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        count, cost, convert_range);
+                }
+
+                inline void convert_f32_to_f16(void* input, void* output, size_t count, int arena)
+                {
+                    Eigen::TensorOpCost cost(4, 2, 1);
+                    auto convert_range = [&](Eigen::Index first, Eigen::Index last) {
+                        f32_to_f16(static_cast<float*>(input) + first,
+                                   static_cast<uint16_t*>(output) + first,
+                                   last - first);
+                    };
+                    ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        count, cost, convert_range);
+                }
+
+                // Floats of float16 weights converted per panel, small enough to stay in L2
+                const size_t f16_weight_panel_size = 64 * 1024;
+
+                // out[m, n] = arg[m, k] * weights[k, n], weights being float16, or bfloat16 if
+                // `bf16_weights`, and stored transposed, [n, k], if `transpose_weights`. The
+                // weights are read once: each panel of columns of the result converts its weights
+                // to float in a per-thread buffer that sgemm then reads from cache.
+                inline void dot_f16_weights(void* arg,
+                                            void* weights,
+                                            void* out,
+                                            size_t m,
+                                            size_t k,
+                                            size_t n,
+                                            bool transpose_weights,
+                                            bool bf16_weights,
+                                            int arena)
+                {
+                    static thread_local std::vector<float> panel;
+                    size_t panel_columns =
+                        std::min(n, std::max<size_t>(1, f16_weight_panel_size / k));
+                    if (panel.size() < panel_columns * k)
+                    {
+                        panel.resize(panel_columns * k);
+                    }
+                    float* panel_data = panel.data();
+
+                    const uint16_t* w = static_cast<const uint16_t*>(weights);
+                    float* c = static_cast<float*>(out);
+                    auto& device =
+                        ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena);
+                    for (size_t first = 0; first < n; first += panel_columns)
+                    {
+                        size_t columns = std::min(panel_columns, n - first);
+                        // Rows of the panel and where they start in the weights
+                        size_t rows = transpose_weights ? columns : k;
+                        size_t row_size = transpose_weights ? k : columns;
+                        size_t row_stride = transpose_weights ? k : n;
+                        const uint16_t* panel_weights =
+                            transpose_weights ? w + first * k : w + first;
+
+                        Eigen::TensorOpCost cost(2 * row_size, 4 * row_size, row_size);
+                        device.parallelFor(
+                            rows, cost, [&](Eigen::Index first_row, Eigen::Index last_row) {
+                                for (Eigen::Index row = first_row; row < last_row; row++)
+                                {
+                                    if (bf16_weights)
+                                    {
+                                        bf16_to_f32(panel_weights + row * row_stride,
+                                                    panel_data + row * row_size,
+                                                    row_size);
+                                    }
+                                    else
+                                    {
+                                        f16_to_f32(panel_weights + row * row_stride,
+                                                   panel_data + row * row_size,
+                                                   row_size);
+                                    }
+                                }
+                            });
+
+                        cblas::cblas_sgemm(cblas::Layout::RowMajor,
+                                           cblas::Transpose::None,
+                                           transpose_weights ? cblas::Transpose::Transpose
+                                                             : cblas::Transpose::None,
+                                           m,
+                                           columns,
+                                           k,
+                                           1.0f,
+                                           static_cast<const float*>(arg),
+                                           k,
+                                           panel_data,
+                                           row_size,
+                                           0.0f,
+                                           c + first,
+                                           n);
+                    }
+                }
+            }
+        }
+    }
+}
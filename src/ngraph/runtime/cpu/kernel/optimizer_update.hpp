@@ -0,0 +1,124 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // Splits [0, count) across the threads of the arena and hands each thread's
+                // range to `block` in pieces small enough to stay in L1 between the statements
+                // of an update, so every tensor is read and written once from memory
+                template <typename Block>
+                void for_each_update_block(size_t count,
+                                           const Eigen::TensorOpCost& cost,
+                                           int arena,
+                                           Block block)
+                {
+                    const Eigen::Index block_size = 1024;
+                    auto run_range = [&](Eigen::Index first, Eigen::Index last) {
+                        for (Eigen::Index i = first; i < last; i += block_size)
+                        {
+                            block(i, std::min(block_size, last - i));
+                        }
+                    };
+                    ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        count, cost, run_range);
+                }
+
+                // Outputs may alias the corresponding inputs, each element is read before
+                // it is written
+                template <typename ElementType>
+                void sgd_momentum_update(void* weights,
+                                         void* velocity,
+                                         void* gradient,
+                                         void* learning_rate,
+                                         void* out_weights,
+                                         void* out_velocity,
+                                         float momentum,
+                                         size_t count,
+                                         int arena)
+                {
+                    using Array = Eigen::Array<ElementType, Eigen::Dynamic, 1>;
+                    ElementType lr = *static_cast<ElementType*>(learning_rate);
+                    ElementType mu = static_cast<ElementType>(momentum);
+
+                    Eigen::TensorOpCost cost(3 * sizeof(ElementType), 2 * sizeof(ElementType), 4);
+                    for_each_update_block(count, cost, arena, [&](Eigen::Index i, Eigen::Index n) {
+                        Eigen::Map<Array> w(static_cast<ElementType*>(weights) + i, n);
+                        Eigen::Map<Array> v(static_cast<ElementType*>(velocity) + i, n);
+                        Eigen::Map<Array> g(static_cast<ElementType*>(gradient) + i, n);
+                        Eigen::Map<Array> out_w(static_cast<ElementType*>(out_weights) + i, n);
+                        Eigen::Map<Array> out_v(static_cast<ElementType*>(out_velocity) + i, n);
+
+                        out_v = mu * v + g;
+                        out_w = w - lr * out_v;
+                    });
+                }
+
+                template <typename ElementType>
+                void adam_update(void* weights,
+                                 void* m,
+                                 void* v,
+                                 void* gradient,
+                                 void* learning_rate,
+                                 void* out_weights,
+                                 void* out_m,
+                                 void* out_v,
+                                 float beta1,
+                                 float beta2,
+                                 float epsilon,
+                                 size_t count,
+                                 int arena)
+                {
+                    using Array = Eigen::Array<ElementType, Eigen::Dynamic, 1>;
+                    ElementType lr = *static_cast<ElementType*>(learning_rate);
+                    ElementType b1 = static_cast<ElementType>(beta1);
+                    ElementType b2 = static_cast<ElementType>(beta2);
+                    ElementType eps = static_cast<ElementType>(epsilon);
+
+                    Eigen::TensorOpCost cost(
+                        4 * sizeof(ElementType), 3 * sizeof(ElementType), 12);
+                    for_each_update_block(count, cost, arena, [&](Eigen::Index i, Eigen::Index n) {
+                        Eigen::Map<Array> w(static_cast<ElementType*>(weights) + i, n);
+                        Eigen::Map<Array> m1(static_cast<ElementType*>(m) + i, n);
+                        Eigen::Map<Array> m2(static_cast<ElementType*>(v) + i, n);
+                        Eigen::Map<Array> g(static_cast<ElementType*>(gradient) + i, n);
+                        Eigen::Map<Array> out_w(static_cast<ElementType*>(out_weights) + i, n);
+                        Eigen::Map<Array> out_m1(static_cast<ElementType*>(out_m) + i, n);
+                        Eigen::Map<Array> out_m2(static_cast<ElementType*>(out_v) + i, n);
+
+                        out_m1 = b1 * m1 + (1 - b1) * g;
+                        out_m2 = b2 * m2 + (1 - b2) * g.square();
+                        out_w = w - lr * out_m1 / (out_m2.sqrt() + eps);
+                    });
+                }
+            }
+        }
+    }
+}
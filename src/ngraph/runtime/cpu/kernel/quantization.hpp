@@ -0,0 +1,210 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/op/quantize.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // The tensor is viewed as [outer, channels, inner] where scale and offset
+                // are indexed by the channel only. Each thread gets a range of the flattened
+                // element stream and walks it in segments of (outer, channel) rows whose
+                // channels have the same scale and offset, so the inner loops see a single
+                // scale/offset pair and vectorize even when inner is 1.
+                template <typename Equal, typename Segment>
+                void for_each_quantization_segment(size_t outer,
+                                                   size_t channels,
+                                                   size_t inner,
+                                                   const Eigen::TensorOpCost& cost,
+                                                   int arena,
+                                                   Equal equal,
+                                                   Segment segment)
+                {
+                    Eigen::Index count = outer * channels * inner;
+                    Eigen::Index row_size = inner;
+                    auto run_range = [&](Eigen::Index first, Eigen::Index last) {
+                        while (first < last)
+                        {
+                            size_t channel = (first / row_size) % channels;
+                            Eigen::Index end =
+                                std::min<Eigen::Index>(last, (first / row_size + 1) * row_size);
+                            while (end < last && equal(channel, (end / row_size) % channels))
+                            {
+                                end = std::min<Eigen::Index>(last, end + row_size);
+                            }
+                            segment(first, end, channel);
+                            first = end;
+                        }
+                    };
+                    ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        count, cost, run_range);
+                }
+
+                // Same results as reference::quantize, which rounds in double, written without
+                // data-dependent branches so the per-mode loops vectorize
+                template <op::Quantize::RoundMode MODE, typename REAL>
+                inline REAL round_quantized(REAL value)
+                {
+                    double v = value;
+                    switch (MODE)
+                    {
+                    case op::Quantize::RoundMode::ROUND_NEAREST_TOWARD_INFINITY:
+                        return static_cast<REAL>(std::copysign(std::floor(std::fabs(v) + 0.5), v));
+                    case op::Quantize::RoundMode::ROUND_NEAREST_TOWARD_ZERO:
+                        return static_cast<REAL>(std::copysign(std::ceil(std::fabs(v) - 0.5), v));
+                    case op::Quantize::RoundMode::ROUND_NEAREST_UPWARD:
+                        return static_cast<REAL>(std::floor(v + 0.5));
+                    case op::Quantize::RoundMode::ROUND_NEAREST_DOWNWARD:
+                        return static_cast<REAL>(std::ceil(v - 0.5));
+                    case op::Quantize::RoundMode::ROUND_NEAREST_TOWARD_EVEN:
+                    {
+                        double up = std::floor(v + 0.5);
+                        double down = std::ceil(v - 0.5);
+                        double half = up * 0.5;
+                        return static_cast<REAL>((half == std::floor(half)) ? up : down);
+                    }
+                    case op::Quantize::RoundMode::ROUND_TOWARD_INFINITY:
+                        return static_cast<REAL>(std::copysign(std::ceil(std::fabs(v)), v));
+                    case op::Quantize::RoundMode::ROUND_TOWARD_ZERO:
+                        return static_cast<REAL>(std::trunc(v));
+                    case op::Quantize::RoundMode::ROUND_UP: return static_cast<REAL>(std::ceil(v));
+                    case op::Quantize::RoundMode::ROUND_DOWN:
+                        return static_cast<REAL>(std::floor(v));
+                    }
+                    return value;
+                }
+
+                template <op::Quantize::RoundMode MODE, typename REAL, typename QUANT>
+                void quantize(const REAL* input,
+                              const REAL* scale,
+                              const QUANT* offset,
+                              QUANT* output,
+                              size_t outer,
+                              size_t channels,
+                              size_t inner,
+                              int arena)
+                {
+                    const REAL lowest = static_cast<REAL>(std::numeric_limits<QUANT>::min());
+                    const REAL highest = static_cast<REAL>(std::numeric_limits<QUANT>::max());
+                    for_each_quantization_segment(
+                        outer,
+                        channels,
+                        inner,
+                        Eigen::TensorOpCost(sizeof(REAL), sizeof(QUANT), 8),
+                        arena,
+                        [&](size_t a, size_t b) {
+                            return scale[a] == scale[b] && offset[a] == offset[b];
+                        },
+                        [&](Eigen::Index first, Eigen::Index last, size_t channel) {
+                            const REAL s = scale[channel];
+                            const REAL o = static_cast<REAL>(offset[channel]);
+                            for (Eigen::Index i = first; i < last; i++)
+                            {
+                                REAL q = round_quantized<MODE>(input[i] / s) + o;
+                                q = std::min(std::max(q, lowest), highest);
+                                output[i] = static_cast<QUANT>(q);
+                            }
+                        });
+                }
+
+                /// \brief Quantizes a tensor viewed as [outer, channels, inner] with one scale and
+                ///        offset per channel.
+                template <typename REAL, typename QUANT>
+                void quantize(void* input,
+                              void* scale,
+                              void* offset,
+                              void* output,
+                              size_t outer,
+                              size_t channels,
+                              size_t inner,
+                              op::Quantize::RoundMode round_mode,
+                              int arena)
+                {
+                    auto in = static_cast<const REAL*>(input);
+                    auto sc = static_cast<const REAL*>(scale);
+                    auto off = static_cast<const QUANT*>(offset);
+                    auto out = static_cast<QUANT*>(output);
+
+#define QUANTIZE_ROUND_MODE(M)                                                                     \
+    case op::Quantize::RoundMode::M:                                                               \
+        quantize<op::Quantize::RoundMode::M>(in, sc, off, out, outer, channels, inner, arena);     \
+        break;
+                    switch (round_mode)
+                    {
+                        QUANTIZE_ROUND_MODE(ROUND_NEAREST_TOWARD_INFINITY)
+                        QUANTIZE_ROUND_MODE(ROUND_NEAREST_TOWARD_ZERO)
+                        QUANTIZE_ROUND_MODE(ROUND_NEAREST_UPWARD)
+                        QUANTIZE_ROUND_MODE(ROUND_NEAREST_DOWNWARD)
+                        QUANTIZE_ROUND_MODE(ROUND_NEAREST_TOWARD_EVEN)
+                        QUANTIZE_ROUND_MODE(ROUND_TOWARD_INFINITY)
+                        QUANTIZE_ROUND_MODE(ROUND_TOWARD_ZERO)
+                        QUANTIZE_ROUND_MODE(ROUND_UP)
+                        QUANTIZE_ROUND_MODE(ROUND_DOWN)
+                    }
+#undef QUANTIZE_ROUND_MODE
+                }
+
+                /// \brief Dequantizes a tensor viewed as [outer, channels, inner] with one scale
+                ///        and offset per channel.
+                template <typename QUANT, typename REAL>
+                void dequantize(void* input,
+                                void* scale,
+                                void* offset,
+                                void* output,
+                                size_t outer,
+                                size_t channels,
+                                size_t inner,
+                                int arena)
+                {
+                    auto in = static_cast<const QUANT*>(input);
+                    auto sc = static_cast<const REAL*>(scale);
+                    auto off = static_cast<const QUANT*>(offset);
+                    auto out = static_cast<REAL*>(output);
+                    for_each_quantization_segment(
+                        outer,
+                        channels,
+                        inner,
+                        Eigen::TensorOpCost(sizeof(QUANT), sizeof(REAL), 2),
+                        arena,
+                        [&](size_t a, size_t b) { return sc[a] == sc[b] && off[a] == off[b]; },
+                        [&](Eigen::Index first, Eigen::Index last, size_t channel) {
+                            const REAL s = sc[channel];
+                            const QUANT o = off[channel];
+                            for (Eigen::Index i = first; i < last; i++)
+                            {
+                                out[i] = static_cast<REAL>(in[i] - o) * s;
+                            }
+                        });
+                }
+            }
+        }
+    }
+}
@@ -35,8 +35,14 @@ using namespace ngraph::runtime::cpu;
 
 MKLDNNEmitter::~MKLDNNEmitter()
 {
-    for (auto p : m_mkldnn_primitives)
-        delete p;
+    for (size_t i = 0; i < m_mkldnn_primitives.size(); i++)
+    {
+        // Cached primitives are deleted with their entries once no executable uses them
+        if (i >= m_primitive_owners.size() || m_primitive_owners[i] == nullptr)
+        {
+            delete m_mkldnn_primitives[i];
+        }
+    }
 #ifndef _WIN32
     //To avoid memory leak in mkldnn, release any buffers that are not free'd yet.
     //https://software.intel.com/en-us/mkl-linux-developer-guide-avoiding-memory-leaks-in-intel-mkl
@@ -55,6 +61,21 @@ const std::vector<char*>& MKLDNNEmitter::get_mkldnn_workspaces()
     return m_workspace_bufs;
 }
 
+const std::vector<MKLDNNPrimitiveCache::Entry*>& MKLDNNEmitter::get_mkldnn_primitive_owners()
+{
+    m_primitive_owners.resize(m_mkldnn_primitives.size(), nullptr);
+    return m_primitive_owners;
+}
+
+void MKLDNNEmitter::set_primitive_owner(size_t index, MKLDNNPrimitiveCache::Entry* entry)
+{
+    if (index >= m_primitive_owners.size())
+    {
+        m_primitive_owners.resize(index + 1, nullptr);
+    }
+    m_primitive_owners[index] = entry;
+}
+
 size_t MKLDNNEmitter::insert_primitive(mkldnn::primitive* primitive)
 {
     m_mkldnn_primitives.emplace_back(primitive);
@@ -73,6 +94,57 @@ const std::vector<size_t>& MKLDNNEmitter::get_primitive_deps(size_t index) const
     return m_primitive_deps.at(index);
 }
 
+bool MKLDNNEmitter::bind_cached_primitive(const std::string& key,
+                                          size_t index,
+                                          const std::vector<size_t>& memory_indices)
+{
+    auto& cache = MKLDNNPrimitiveCache::get();
+    if (!cache.is_enabled())
+    {
+        return false;
+    }
+    auto entry = cache.find(key);
+    if (!entry)
+    {
+        return false;
+    }
+    m_mkldnn_primitives[index] = entry->primitive;
+    set_primitive_owner(index, entry.get());
+    for (size_t i = 0; i < memory_indices.size(); i++)
+    {
+        m_mkldnn_primitives[memory_indices[i]] = entry->memory[i];
+        set_primitive_owner(memory_indices[i], entry.get());
+    }
+    m_cached_primitives[index] = entry;
+    return true;
+}
+
+void MKLDNNEmitter::cache_primitive(const std::string& key,
+                                    size_t index,
+                                    const std::vector<size_t>& memory_indices)
+{
+    auto& cache = MKLDNNPrimitiveCache::get();
+    if (!cache.is_enabled())
+    {
+        return;
+    }
+    std::vector<mkldnn::primitive*> memory;
+    for (auto i : memory_indices)
+    {
+        memory.push_back(m_mkldnn_primitives[i]);
+    }
+    auto entry = cache.insert(key, m_mkldnn_primitives[index], memory);
+    if (entry)
+    {
+        set_primitive_owner(index, entry.get());
+        for (auto i : memory_indices)
+        {
+            set_primitive_owner(i, entry.get());
+        }
+        m_cached_primitives[index] = entry;
+    }
+}
+
 mkldnn::memory::desc MKLDNNEmitter::build_memory_descriptor(const TensorViewWrapper& tvw,
                                                             mkldnn::memory::format fmt) const
 {
@@ -509,6 +581,14 @@ void MKLDNNEmitter::build_convolution_backward_weights_bias(
     const mkldnn::convolution_forward::desc& fwd_desc,
     size_t conv_index)
 {
+    std::string key = "convolution_backward_weights_bias";
+    MKLDNNPrimitiveCache::append_key(key, bwd_desc.data);
+    MKLDNNPrimitiveCache::append_key(key, fwd_desc.data);
+    if (bind_cached_primitive(key, conv_index, m_primitive_deps[conv_index]))
+    {
+        return;
+    }
+
     size_t in_data_index = m_primitive_deps[conv_index][0];
     build_memory_primitive(bwd_desc.data.src_desc, in_data_index);
     size_t in_delta_index = m_primitive_deps[conv_index][1];
@@ -529,6 +609,7 @@ void MKLDNNEmitter::build_convolution_backward_weights_bias(
                                                  *m_mkldnn_primitives[in_delta_index],
                                                  *m_mkldnn_primitives[out_weights_delta_index],
                                                  *m_mkldnn_primitives[out_bias_delta_index]);
+    cache_primitive(key, conv_index, m_primitive_deps[conv_index]);
 }
 
 size_t
@@ -580,6 +661,14 @@ void MKLDNNEmitter::build_convolution_backward_weights(
     const mkldnn::convolution_forward::desc& fwd_desc,
     size_t conv_index)
 {
+    std::string key = "convolution_backward_weights";
+    MKLDNNPrimitiveCache::append_key(key, bwd_desc.data);
+    MKLDNNPrimitiveCache::append_key(key, fwd_desc.data);
+    if (bind_cached_primitive(key, conv_index, m_primitive_deps[conv_index]))
+    {
+        return;
+    }
+
     size_t in_data_index = m_primitive_deps[conv_index][0];
     build_memory_primitive(bwd_desc.data.src_desc, in_data_index);
     size_t in_delta_index = m_primitive_deps[conv_index][1];
@@ -595,6 +684,7 @@ void MKLDNNEmitter::build_convolution_backward_weights(
         *m_mkldnn_primitives[in_data_index],
         *m_mkldnn_primitives[in_delta_index],
         *m_mkldnn_primitives[out_weights_delta_index]);
+    cache_primitive(key, conv_index, m_primitive_deps[conv_index]);
 }
 
 size_t MKLDNNEmitter::build_convolution_backward_data(const mkldnn::memory::desc& weights_desc,
@@ -645,6 +735,14 @@ void MKLDNNEmitter::build_convolution_backward_data(
     const mkldnn::convolution_forward::desc& fwd_desc,
     size_t conv_index)
 {
+    std::string key = "convolution_backward_data";
+    MKLDNNPrimitiveCache::append_key(key, bwd_desc.data);
+    MKLDNNPrimitiveCache::append_key(key, fwd_desc.data);
+    if (bind_cached_primitive(key, conv_index, m_primitive_deps[conv_index]))
+    {
+        return;
+    }
+
     size_t weights_index = m_primitive_deps[conv_index][0];
     build_memory_primitive(bwd_desc.data.weights_desc, weights_index);
     size_t delta_index = m_primitive_deps[conv_index][1];
@@ -660,6 +758,7 @@ void MKLDNNEmitter::build_convolution_backward_data(
         *m_mkldnn_primitives[delta_index],
         *m_mkldnn_primitives[weights_index],
         *m_mkldnn_primitives[result_index]);
+    cache_primitive(key, conv_index, m_primitive_deps[conv_index]);
 }
 
 size_t MKLDNNEmitter::build_pooling_forward(mkldnn::algorithm pooling_algorithm,
@@ -694,6 +793,13 @@ size_t MKLDNNEmitter::build_pooling_forward(mkldnn::algorithm pooling_algorithm,
 void MKLDNNEmitter::build_pooling_forward(const mkldnn::pooling_forward::desc& pool_desc,
                                           size_t pool_index)
 {
+    std::string key = "pooling_forward";
+    MKLDNNPrimitiveCache::append_key(key, pool_desc.data);
+    if (bind_cached_primitive(key, pool_index, m_primitive_deps[pool_index]))
+    {
+        return;
+    }
+
     size_t input_index = m_primitive_deps[pool_index][0];
     build_memory_primitive(pool_desc.data.src_desc, input_index);
     size_t result_index = m_primitive_deps[pool_index][1];
@@ -703,6 +809,7 @@ void MKLDNNEmitter::build_pooling_forward(const mkldnn::pooling_forward::desc& p
         new mkldnn::pooling_forward({pool_desc, executor::global_cpu_engine},
                                     *m_mkldnn_primitives[input_index],
                                     *m_mkldnn_primitives[result_index]);
+    cache_primitive(key, pool_index, m_primitive_deps[pool_index]);
 }
 
 size_t MKLDNNEmitter::build_pooling_backward(mkldnn::algorithm pooling_algorithm,
@@ -1011,6 +1118,14 @@ void MKLDNNEmitter::build_reorder(const mkldnn::memory::desc& input_desc,
                                   const mkldnn::memory::desc& result_desc,
                                   size_t reorder_index)
 {
+    std::string key = "reorder";
+    MKLDNNPrimitiveCache::append_key(key, input_desc.data);
+    MKLDNNPrimitiveCache::append_key(key, result_desc.data);
+    if (bind_cached_primitive(key, reorder_index, m_primitive_deps[reorder_index]))
+    {
+        return;
+    }
+
     size_t input_index = m_primitive_deps[reorder_index][0];
     build_memory_primitive(input_desc, input_index);
     size_t result_index = m_primitive_deps[reorder_index][1];
@@ -1018,6 +1133,7 @@ void MKLDNNEmitter::build_reorder(const mkldnn::memory::desc& input_desc,
 
     m_mkldnn_primitives[reorder_index] =
         new mkldnn::reorder(*m_mkldnn_primitives[input_index], *m_mkldnn_primitives[result_index]);
+    cache_primitive(key, reorder_index, m_primitive_deps[reorder_index]);
 }
 
 size_t MKLDNNEmitter::build_lrn_forward(const mkldnn::memory::desc& input_desc,
@@ -1431,12 +1547,22 @@ void MKLDNNEmitter::build_batchnorm_forward(
     size_t batchnorm_index,
     const mkldnn::post_ops& pops)
 {
-    size_t input_index = m_primitive_deps[batchnorm_index][0];
-    build_memory_primitive(batchnorm_desc.data.data_desc, input_index);
-
     mkldnn::primitive_attr bn_attr;
     bn_attr.set_post_ops(pops);
 
+    std::string key = "batch_normalization_forward";
+    MKLDNNPrimitiveCache::append_key(key, batchnorm_desc.data);
+    MKLDNNPrimitiveCache::append_key(key, weights_desc.data);
+    MKLDNNPrimitiveCache::append_key(key, bn_training_flag);
+    MKLDNNPrimitiveCache::append_key(key, bn_attr);
+    if (bind_cached_primitive(key, batchnorm_index, m_primitive_deps[batchnorm_index]))
+    {
+        return;
+    }
+
+    size_t input_index = m_primitive_deps[batchnorm_index][0];
+    build_memory_primitive(batchnorm_desc.data.data_desc, input_index);
+
     auto use_global_stats = batchnorm_desc.data.flags & 0x1U;
     if (bn_training_flag && !use_global_stats)
     {
@@ -1476,6 +1602,7 @@ void MKLDNNEmitter::build_batchnorm_forward(
             mkldnn::primitive::at(*m_mkldnn_primitives[weights_index]),
             static_cast<mkldnn::memory>(*m_mkldnn_primitives[result_index]));
     }
+    cache_primitive(key, batchnorm_index, m_primitive_deps[batchnorm_index]);
 }
 
 size_t MKLDNNEmitter::build_batchnorm_backward(const mkldnn::memory::desc& weights_desc,
@@ -1549,6 +1676,15 @@ void MKLDNNEmitter::build_batchnorm_backward(
     const mkldnn::memory::desc& dweights_desc,
     size_t batchnorm_index)
 {
+    std::string key = "batch_normalization_backward";
+    MKLDNNPrimitiveCache::append_key(key, batchnorm_desc.data);
+    MKLDNNPrimitiveCache::append_key(key, weights_desc.data);
+    MKLDNNPrimitiveCache::append_key(key, dweights_desc.data);
+    if (bind_cached_primitive(key, batchnorm_index, m_primitive_deps[batchnorm_index]))
+    {
+        return;
+    }
+
     size_t weights_index = m_primitive_deps[batchnorm_index][0];
     build_memory_primitive(weights_desc, weights_index);
     size_t input_index = m_primitive_deps[batchnorm_index][1];
@@ -1579,6 +1715,7 @@ void MKLDNNEmitter::build_batchnorm_backward(
         *m_mkldnn_primitives[weights_index],
         *m_mkldnn_primitives[dinput_index],
         *m_mkldnn_primitives[dweights_index]);
+    cache_primitive(key, batchnorm_index, m_primitive_deps[batchnorm_index]);
 }
 
 size_t MKLDNNEmitter::build_rnn_forward(const mkldnn::memory::desc& src_layer_desc,
@@ -1645,6 +1782,23 @@ size_t MKLDNNEmitter::build_rnn_forward(const mkldnn::memory::desc& src_layer_de
 
 void MKLDNNEmitter::build_rnn_forward(const mkldnn::rnn_forward::desc& rnn_desc, size_t rnn_index)
 {
+    auto rnn_layer_prim_desc =
+        mkldnn::rnn_forward::primitive_desc(rnn_desc, executor::global_cpu_engine);
+    // The workspace buffer stays with the executable, only its memory primitive is cached
+    auto workspace = std::unique_ptr<MKLDNNWorkspace>(
+        new MKLDNNWorkspace(rnn_layer_prim_desc.workspace_primitive_desc().get_size()));
+    auto workspace_buf_index = insert_workspace(workspace);
+    m_primitive_deps[rnn_index][8] = workspace_buf_index;
+
+    auto& deps = m_primitive_deps[rnn_index];
+    std::vector<size_t> memory_indices(deps.begin(), deps.begin() + 8);
+    std::string key = "rnn_forward";
+    MKLDNNPrimitiveCache::append_key(key, rnn_desc.data);
+    if (bind_cached_primitive(key, rnn_index, memory_indices))
+    {
+        return;
+    }
+
     size_t src_layer_index = m_primitive_deps[rnn_index][0];
     build_memory_primitive(rnn_desc.data.src_layer_desc, src_layer_index);
     size_t src_iter_index = m_primitive_deps[rnn_index][1];
@@ -1659,15 +1813,8 @@ void MKLDNNEmitter::build_rnn_forward(const mkldnn::rnn_forward::desc& rnn_desc,
     build_memory_primitive(rnn_desc.data.dst_layer_desc, dst_layer_index);
     size_t dst_iter_index = m_primitive_deps[rnn_index][6];
     build_memory_primitive(rnn_desc.data.dst_iter_desc, dst_iter_index);
-
-    auto rnn_layer_prim_desc =
-        mkldnn::rnn_forward::primitive_desc(rnn_desc, executor::global_cpu_engine);
     size_t workspace_index = m_primitive_deps[rnn_index][7];
     build_memory_primitive(rnn_layer_prim_desc.workspace_primitive_desc().desc(), workspace_index);
-    auto workspace = std::unique_ptr<MKLDNNWorkspace>(
-        new MKLDNNWorkspace(rnn_layer_prim_desc.workspace_primitive_desc().get_size()));
-    auto workspace_buf_index = insert_workspace(workspace);
-    m_primitive_deps[rnn_index][8] = workspace_buf_index;
 
     m_mkldnn_primitives[rnn_index] =
         new mkldnn::rnn_forward(rnn_layer_prim_desc,
@@ -1679,6 +1826,7 @@ void MKLDNNEmitter::build_rnn_forward(const mkldnn::rnn_forward::desc& rnn_desc,
                                 static_cast<mkldnn::memory>(*m_mkldnn_primitives[dst_layer_index]),
                                 static_cast<mkldnn::memory>(*m_mkldnn_primitives[dst_iter_index]),
                                 static_cast<mkldnn::memory>(*m_mkldnn_primitives[workspace_index]));
+    cache_primitive(key, rnn_index, memory_indices);
 }
 
 size_t MKLDNNEmitter::build_concat(const std::vector<mkldnn::memory::desc>& inputs_data_desc,
@@ -21,6 +21,7 @@
 #pragma once
 
 #include <memory>
+#include <string>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -43,6 +44,7 @@
 #include "ngraph/op/softmax.hpp"
 #include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view_wrapper.hpp"
+#include "ngraph/runtime/cpu/mkldnn_primitive_cache.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 #include "ngraph/runtime/cpu/op/bounded_relu.hpp"
 #include "ngraph/runtime/cpu/op/conv_add.hpp"
@@ -88,6 +90,9 @@ namespace ngraph
 
                 const std::vector<mkldnn::primitive*>& get_mkldnn_primitives() const;
                 const std::vector<char*>& get_mkldnn_workspaces();
+                /// \brief The cache entry owning each primitive, nullptr for the primitives
+                ///        private to this executable
+                const std::vector<MKLDNNPrimitiveCache::Entry*>& get_mkldnn_primitive_owners();
 
                 // reserve the space for primitives for each op, different op requires different number of primitives.
                 // some ops require a new workspace.
@@ -96,6 +101,16 @@ namespace ngraph
                 size_t insert_workspace(std::unique_ptr<MKLDNNWorkspace>& workspace);
                 const std::vector<size_t>& get_primitive_deps(size_t index) const;
 
+                // Points `index` and the memory primitives at `memory_indices` to the primitives
+                // another executable built for `key`. Returns false when there are none, in which
+                // case the caller builds them and hands them to cache_primitive.
+                bool bind_cached_primitive(const std::string& key,
+                                           size_t index,
+                                           const std::vector<size_t>& memory_indices);
+                void cache_primitive(const std::string& key,
+                                     size_t index,
+                                     const std::vector<size_t>& memory_indices);
+
                 // TODO(jmenon): Get rid of TensorViewWrappers at some point
                 mkldnn::memory::desc build_memory_descriptor(const TensorViewWrapper& tvw,
                                                              mkldnn::memory::format fmt) const;
@@ -1260,6 +1275,15 @@ namespace ngraph
                     size_t input_idx, weights_idx, results_idx, bias_idx;
                     input_idx = m_primitive_deps[conv_idx][0];
                     weights_idx = m_primitive_deps[conv_idx][1];
+                    std::string key =
+                        with_bias ? "convolution_forward_bias" : "convolution_forward";
+                    MKLDNNPrimitiveCache::append_key(key, desc.data);
+                    MKLDNNPrimitiveCache::append_key(key, attr);
+                    if (bind_cached_primitive(key, conv_idx, m_primitive_deps[conv_idx]))
+                    {
+                        return;
+                    }
+
                     m_mkldnn_primitives[input_idx] =
                         new mkldnn::memory({{desc.data.src_desc}, engine}, nullptr);
                     m_mkldnn_primitives[weights_idx] =
@@ -1296,6 +1320,7 @@ namespace ngraph
                     }
 
                     m_mkldnn_primitives[conv_idx] = prim;
+                    cache_primitive(key, conv_idx, m_primitive_deps[conv_idx]);
                 }
 
                 template <typename OP>
@@ -1467,9 +1492,14 @@ namespace ngraph
                 }
 
             private:
+                void set_primitive_owner(size_t index, MKLDNNPrimitiveCache::Entry* entry);
+
                 std::vector<mkldnn::primitive*> m_mkldnn_primitives;
                 std::vector<mkldnn::stream> m_mkldnn_streams;
                 std::unordered_map<size_t, std::vector<size_t>> m_primitive_deps;
+                std::unordered_map<size_t, std::shared_ptr<MKLDNNPrimitiveCache::Entry>>
+                    m_cached_primitives;
+                std::vector<MKLDNNPrimitiveCache::Entry*> m_primitive_owners;
                 std::vector<std::unique_ptr<MKLDNNWorkspace>> m_workspaces;
                 std::vector<char*> m_workspace_bufs;
             };
@@ -14,6 +14,7 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <mutex>
 #include <string>
 
 #include <mkldnn.hpp>
@@ -21,19 +22,34 @@
 #include "mkldnn_invoke.hpp"
 #include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/runtime/cpu/cpu_runtime_context.hpp"
+#include "ngraph/runtime/cpu/mkldnn_primitive_cache.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 
 extern "C" void ngraph::runtime::cpu::mkldnn_utils::set_memory_ptr(CPURuntimeContext* ctx,
                                                                    size_t primitive_index,
                                                                    void* ptr)
 {
-    auto primitive = static_cast<mkldnn::memory*>(ctx->mkldnn_primitives[primitive_index]);
-    primitive->set_data_handle(ptr);
+    auto primitive = ctx->mkldnn_primitives[primitive_index];
+    // Memory of cached primitives is shared with other executables, bind it when invoking
+    if (ctx->mkldnn_primitive_owners[primitive_index])
+    {
+        MKLDNNPrimitiveCache::get().defer_data_handle(primitive, ptr);
+    }
+    else
+    {
+        static_cast<mkldnn::memory*>(primitive)->set_data_handle(ptr);
+    }
 }
 
 extern "C" void ngraph::runtime::cpu::mkldnn_utils::mkldnn_invoke_primitive(CPURuntimeContext* ctx,
                                                                             size_t primitive_index)
 {
+    std::unique_lock<std::mutex> lock;
+    if (auto entry = ctx->mkldnn_primitive_owners[primitive_index])
+    {
+        lock = std::unique_lock<std::mutex>(entry->mutex);
+        MKLDNNPrimitiveCache::get().apply_data_handles(*entry);
+    }
     mkldnn::stream s(mkldnn::stream::kind::eager);
     try
     {
@@ -0,0 +1,148 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstdlib>
+
+#include "ngraph/runtime/cpu/mkldnn_primitive_cache.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Data handles set on cached memory primitives, waiting for the next invocation on this thread
+static thread_local unordered_map<const mkldnn::primitive*, void*> s_deferred_handles;
+
+runtime::cpu::MKLDNNPrimitiveCacheEntry::~MKLDNNPrimitiveCacheEntry()
+{
+    MKLDNNPrimitiveCache::get().erase(this);
+    delete primitive;
+    for (auto p : memory)
+    {
+        delete p;
+    }
+}
+
+runtime::cpu::MKLDNNPrimitiveCache& runtime::cpu::MKLDNNPrimitiveCache::get()
+{
+    // Never destroyed, executables held in static storage may release entries at exit
+    static MKLDNNPrimitiveCache* s_cache = new MKLDNNPrimitiveCache();
+    return *s_cache;
+}
+
+runtime::cpu::MKLDNNPrimitiveCache::MKLDNNPrimitiveCache()
+    : m_enabled(true)
+    , m_hits(0)
+{
+    const char* env = getenv("NGRAPH_MKLDNN_PRIMITIVE_CACHE");
+    if (env != nullptr && atoi(env) == 0)
+    {
+        m_enabled = false;
+    }
+}
+
+shared_ptr<runtime::cpu::MKLDNNPrimitiveCache::Entry>
+    runtime::cpu::MKLDNNPrimitiveCache::find(const string& key)
+{
+    lock_guard<mutex> lock(m_mutex);
+    auto it = m_entries.find(key);
+    if (it == m_entries.end())
+    {
+        return nullptr;
+    }
+    auto entry = it->second.lock();
+    if (entry)
+    {
+        m_hits++;
+    }
+    return entry;
+}
+
+shared_ptr<runtime::cpu::MKLDNNPrimitiveCache::Entry> runtime::cpu::MKLDNNPrimitiveCache::insert(
+    const string& key, mkldnn::primitive* primitive, const vector<mkldnn::primitive*>& memory)
+{
+    lock_guard<mutex> lock(m_mutex);
+    auto it = m_entries.find(key);
+    if (it != m_entries.end() && !it->second.expired())
+    {
+        return nullptr;
+    }
+    auto entry = make_shared<Entry>();
+    entry->key = key;
+    entry->primitive = primitive;
+    entry->memory = memory;
+    m_entries[key] = entry;
+    return entry;
+}
+
+void runtime::cpu::MKLDNNPrimitiveCache::erase(Entry* entry)
+{
+    lock_guard<mutex> lock(m_mutex);
+    auto it = m_entries.find(entry->key);
+    // The key may already belong to an entry inserted after this one expired
+    if (it != m_entries.end() && it->second.expired())
+    {
+        m_entries.erase(it);
+    }
+}
+
+void runtime::cpu::MKLDNNPrimitiveCache::defer_data_handle(mkldnn::primitive* memory, void* ptr)
+{
+    s_deferred_handles[memory] = ptr;
+}
+
+void runtime::cpu::MKLDNNPrimitiveCache::apply_data_handles(Entry& entry)
+{
+    for (auto p : entry.memory)
+    {
+        auto it = s_deferred_handles.find(p);
+        if (it != s_deferred_handles.end())
+        {
+            static_cast<mkldnn::memory*>(p)->set_data_handle(it->second);
+            s_deferred_handles.erase(it);
+        }
+    }
+}
+
+void runtime::cpu::MKLDNNPrimitiveCache::append_key(string& key,
+                                                    const mkldnn::primitive_attr& attr)
+{
+    append_key(key, attr.get_int_output_round_mode());
+    int mask;
+    vector<float> scales;
+    attr.get_output_scales(mask, scales);
+    append_key(key, mask);
+    key.append(reinterpret_cast<const char*>(scales.data()), scales.size() * sizeof(float));
+
+    auto ops = attr.get_post_ops();
+    for (int i = 0; i < ops.len(); i++)
+    {
+        float scale = 0.f, alpha = 0.f, beta = 0.f;
+        auto alg = mkldnn::algorithm::eltwise_relu;
+        auto kind = ops.kind(i);
+        if (kind == mkldnn::primitive::kind::sum)
+        {
+            ops.get_params_sum(i, scale);
+        }
+        else
+        {
+            ops.get_params_eltwise(i, scale, alg, alpha, beta);
+        }
+        append_key(key, kind);
+        append_key(key, scale);
+        append_key(key, alg);
+        append_key(key, alpha);
+        append_key(key, beta);
+    }
+}
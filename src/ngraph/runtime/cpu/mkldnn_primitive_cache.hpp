@@ -0,0 +1,107 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <mkldnn.hpp>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            /// \brief A primitive shared by executables and the memory primitives it was created
+            ///        with
+            struct MKLDNNPrimitiveCacheEntry
+            {
+                ~MKLDNNPrimitiveCacheEntry();
+
+                std::string key;
+                mkldnn::primitive* primitive;
+                std::vector<mkldnn::primitive*> memory;
+                std::mutex mutex;
+            };
+
+            /// \brief Process-wide cache of the MKLDNN primitives built by the executables of
+            ///        the DEX backend, keyed by their full descriptors.
+            ///
+            /// Building a primitive JITs its kernel, so executables with identical convolutions,
+            /// e.g. batch-size specializations of one model or models sharing a backbone, share
+            /// one primitive rather than JIT the same kernel again. An entry lives as long as an
+            /// executable uses it.
+            ///
+            /// MKLDNN 0.x primitives are bound to the memory primitives they are created with,
+            /// so an entry owns those too. Executables record the entry owning each of their
+            /// primitives when they build them. The data handles an executable sets on them are
+            /// deferred to the calling thread and applied under the entry lock right before the
+            /// primitive runs, so executables running concurrently never see each other's
+            /// buffers. Setting NGRAPH_MKLDNN_PRIMITIVE_CACHE=0 keeps every primitive private.
+            class MKLDNNPrimitiveCache
+            {
+            public:
+                typedef MKLDNNPrimitiveCacheEntry Entry;
+
+                static MKLDNNPrimitiveCache& get();
+
+                bool is_enabled() const { return m_enabled; }
+                /// \brief Returns the live entry of `key`, or nullptr.
+                std::shared_ptr<Entry> find(const std::string& key);
+                /// \brief Makes `primitive` and the memory primitives it was created with an
+                ///        entry of `key`, which then owns them. Returns nullptr, leaving the
+                ///        primitives to the caller, when another executable inserted `key` first.
+                std::shared_ptr<Entry> insert(const std::string& key,
+                                              mkldnn::primitive* primitive,
+                                              const std::vector<mkldnn::primitive*>& memory);
+
+                /// \brief Number of times find returned a live entry, over the life of the
+                ///        process.
+                size_t get_hit_count() const { return m_hits; }
+                /// \brief Defers setting the data handle of a cached memory primitive to the next
+                ///        invocation of its entry on this thread.
+                void defer_data_handle(mkldnn::primitive* memory, void* ptr);
+                /// \brief Applies the data handles deferred on this thread to the memory of
+                ///        `entry`. The caller holds the entry lock.
+                void apply_data_handles(Entry& entry);
+
+                template <typename T>
+                static void append_key(std::string& key, const T& desc)
+                {
+                    key.append(reinterpret_cast<const char*>(&desc), sizeof(desc));
+                }
+                static void append_key(std::string& key, const mkldnn::primitive_attr& attr);
+
+            private:
+                friend struct MKLDNNPrimitiveCacheEntry;
+
+                MKLDNNPrimitiveCache();
+                void erase(Entry* entry);
+
+                bool m_enabled;
+                std::mutex m_mutex;
+                std::unordered_map<std::string, std::weak_ptr<Entry>> m_entries;
+                std::atomic<size_t> m_hits;
+            };
+        }
+    }
+}
@@ -33,6 +33,8 @@
 #include "ngraph/runtime/cpu/cpu_op_annotations.hpp"
 #include "ngraph/runtime/cpu/op/conv_bias.hpp"
 #include "ngraph/runtime/cpu/op/conv_relu.hpp"
+#include "ngraph/runtime/cpu/op/group_conv.hpp"
+#include "ngraph/runtime/cpu/op/group_conv_bias.hpp"
 #include "ngraph/type/element_type.hpp"
 
 #include "mkldnn_utils.hpp"
@@ -47,6 +49,8 @@ std::map<element::Type, const mkldnn::memory::data_type>&
     // Mapping from POD types to MKLDNN data types
     static std::map<element::Type, const mkldnn::memory::data_type> s_mkldnn_data_type_map = {
         {element::boolean, mkldnn::memory::data_type::s8},
+        {element::bf16, mkldnn::memory::data_type::data_undef},
+        {element::f16, mkldnn::memory::data_type::data_undef},
         {element::f32, mkldnn::memory::data_type::f32},
         {element::f64, mkldnn::memory::data_type::data_undef},
         {element::i8, mkldnn::memory::data_type::s8},
@@ -66,6 +70,8 @@ std::map<element::Type, const std::string>&
 {
     static std::map<element::Type, const std::string> s_mkldnn_data_type_string_map{
         {element::boolean, "mkldnn::memory::data_type::s8"},
+        {element::bf16, "mkldnn::memory::data_type::data_undef"},
+        {element::f16, "mkldnn::memory::data_type::data_undef"},
         {element::f32, "mkldnn::memory::data_type::f32"},
         {element::f64, "mkldnn::memory::data_type::data_undef"},
         {element::i8, "mkldnn::memory::data_type::s8"},
@@ -261,6 +267,47 @@ const mkldnn::memory::desc& runtime::cpu::mkldnn_utils::get_output_mkldnn_md(con
     return dynamic_cast<runtime::cpu::LayoutDescriptor&>(*tvl).get_mkldnn_md();
 }
 
+mkldnn::memory::desc runtime::cpu::mkldnn_utils::get_convert_layout_input_md(const Node* node)
+{
+    auto input_desc = get_input_mkldnn_md(node, 0);
+    const auto& result_desc = get_output_mkldnn_md(node, 0);
+
+    if (input_desc.data.format == mkldnn_nchw && result_desc.data.format == mkldnn_goihw)
+    {
+        //becomes a copy
+        input_desc = result_desc;
+    }
+    else if ((input_desc.data.format == mkldnn_nchw || input_desc.data.format == mkldnn_nhwc) &&
+             result_desc.data.format == mkldnn_OIhw4i16o4i_s8s8)
+    {
+        input_desc.data.format = mkldnn_oihw;
+    }
+    else if (input_desc.data.format == mkldnn_nchw && input_desc.data.ndims == 4 &&
+             result_desc.data.ndims == 5 && node->get_users().size() == 1)
+    {
+        Shape weights_shape_groups;
+        if (auto gconv = std::dynamic_pointer_cast<ngraph::op::GroupConvolution>(
+                node->get_users()[0]))
+        {
+            weights_shape_groups = gconv->get_weights_dimensions();
+        }
+        else if (auto gconvb = std::dynamic_pointer_cast<ngraph::op::GroupConvolutionBias>(
+                     node->get_users()[0]))
+        {
+            weights_shape_groups = gconvb->get_weights_dimensions();
+        }
+        else
+        {
+            throw ngraph_error("Incompatible input/output shape in ConvertLayout op");
+        }
+        input_desc = mkldnn::memory::desc(
+            mkldnn::memory::dims(weights_shape_groups.begin(), weights_shape_groups.end()),
+            get_mkldnn_data_type(node->get_input_element_type(0)),
+            mkldnn::memory::format::goihw);
+    }
+    return input_desc;
+}
+
 mkldnn::memory::desc runtime::cpu::mkldnn_utils::create_default_mkldnn_md(
     const Node* node,
     size_t index,
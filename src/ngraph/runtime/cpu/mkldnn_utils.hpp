@@ -46,6 +46,9 @@ namespace ngraph
 
                 const mkldnn::memory::desc& get_input_mkldnn_md(const Node* node, size_t index);
                 const mkldnn::memory::desc& get_output_mkldnn_md(const Node* node, size_t index);
+                /// \brief Layout a ConvertLayout reads its input in. It differs from the layout
+                ///        of the input tensor for weights reordered into grouped or s8s8 formats.
+                mkldnn::memory::desc get_convert_layout_input_md(const Node* node);
 
                 mkldnn::memory::desc create_default_mkldnn_md(const Node* node,
                                                               size_t index,
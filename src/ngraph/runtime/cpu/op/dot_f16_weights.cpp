@@ -0,0 +1,70 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/op/dot_f16_weights.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+op::DotF16Weights::DotF16Weights(const shared_ptr<Node>& arg,
+                                 const shared_ptr<Node>& weights,
+                                 bool transpose_weights)
+    : Op("DotF16Weights", check_single_output_args({arg, weights}))
+    , m_transpose_weights(transpose_weights)
+{
+    constructor_validate_and_infer_types();
+}
+
+void op::DotF16Weights::validate_and_infer_types()
+{
+    const Shape& arg_shape = get_input_shape(0);
+    const Shape& weights_shape = get_input_shape(1);
+    NODE_VALIDATION_CHECK(this,
+                          get_input_element_type(0) == element::f32 &&
+                              (get_input_element_type(1) == element::f16 ||
+                               get_input_element_type(1) == element::bf16),
+                          "Expected f32 data and f16 or bf16 weights (data element type: ",
+                          get_input_element_type(0),
+                          ", weights element type: ",
+                          get_input_element_type(1),
+                          ").");
+    NODE_VALIDATION_CHECK(this,
+                          arg_shape.size() == 2 && weights_shape.size() == 2,
+                          "Data and weights must be matrices (data shape: ",
+                          arg_shape,
+                          ", weights shape: ",
+                          weights_shape,
+                          ").");
+
+    size_t reduction_axis = m_transpose_weights ? 1 : 0;
+    NODE_VALIDATION_CHECK(this,
+                          arg_shape[1] == weights_shape[reduction_axis],
+                          "Reduction axes do not match (data shape: ",
+                          arg_shape,
+                          ", weights shape: ",
+                          weights_shape,
+                          ", transpose weights: ",
+                          m_transpose_weights,
+                          ").");
+
+    set_output_type(0, element::f32, Shape{arg_shape[0], weights_shape[1 - reduction_axis]});
+}
+
+shared_ptr<Node> op::DotF16Weights::copy_with_new_args(const NodeVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    return make_shared<DotF16Weights>(new_args.at(0), new_args.at(1), m_transpose_weights);
+}
@@ -0,0 +1,52 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+
+#include "ngraph/node.hpp"
+#include "ngraph/op/op.hpp"
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief 2D f32 Dot whose weights are stored in f16 or bf16. The weights are converted
+        ///        to f32 as they are read, so only their 16-bit values come from memory.
+        class DotF16Weights : public Op
+        {
+        public:
+            /// \param arg The f32 data, of shape [m, k].
+            /// \param weights The f16 or bf16 weights, of shape [k, n], or [n, k] if
+            ///        `transpose_weights`.
+            /// \param transpose_weights Whether the weights are used transposed.
+            CPU_BACKEND_API DotF16Weights(const std::shared_ptr<Node>& arg,
+                                          const std::shared_ptr<Node>& weights,
+                                          bool transpose_weights);
+
+            bool get_transpose_weights() const { return m_transpose_weights; }
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+        protected:
+            void validate_and_infer_types() override;
+
+            bool m_transpose_weights;
+        };
+    }
+}
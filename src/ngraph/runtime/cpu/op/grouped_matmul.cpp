@@ -0,0 +1,95 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/op/grouped_matmul.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+op::GroupedMatmul::GroupedMatmul(const NodeVector& args,
+                                 const vector<Shape>& a_shapes,
+                                 const vector<Shape>& b_shapes,
+                                 const vector<bool>& transpose_a,
+                                 const vector<bool>& transpose_b)
+    : Op("GroupedMatmul", check_single_output_args(args))
+    , m_a_shapes(a_shapes)
+    , m_b_shapes(b_shapes)
+    , m_transpose_a(transpose_a)
+    , m_transpose_b(transpose_b)
+{
+    constructor_validate_and_infer_types();
+}
+
+void op::GroupedMatmul::validate_and_infer_types()
+{
+    size_t count = m_a_shapes.size();
+    NODE_VALIDATION_CHECK(this,
+                          count > 0 && get_input_size() == 2 * count &&
+                              m_b_shapes.size() == count && m_transpose_a.size() == count &&
+                              m_transpose_b.size() == count,
+                          "Expected two arguments, two shapes and two transpose flags per product "
+                          "(arguments: ",
+                          get_input_size(),
+                          ", products: ",
+                          count,
+                          ").");
+
+    set_output_size(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        const Shape& a_shape = m_a_shapes[i];
+        const Shape& b_shape = m_b_shapes[i];
+        NODE_VALIDATION_CHECK(this,
+                              get_input_element_type(2 * i) == element::f32 &&
+                                  get_input_element_type(2 * i + 1) == element::f32,
+                              "Expected f32 operands (product: ",
+                              i,
+                              ").");
+        NODE_VALIDATION_CHECK(this,
+                              a_shape.size() == 2 && b_shape.size() == 2 &&
+                                  shape_size(get_input_shape(2 * i)) == shape_size(a_shape) &&
+                                  shape_size(get_input_shape(2 * i + 1)) == shape_size(b_shape),
+                              "Operands must be read as matrices of their size (product: ",
+                              i,
+                              ", a shape: ",
+                              a_shape,
+                              ", b shape: ",
+                              b_shape,
+                              ").");
+
+        size_t a_reduction_axis = m_transpose_a[i] ? 0 : 1;
+        size_t b_reduction_axis = m_transpose_b[i] ? 1 : 0;
+        NODE_VALIDATION_CHECK(this,
+                              a_shape[a_reduction_axis] == b_shape[b_reduction_axis],
+                              "Reduction axes do not match (product: ",
+                              i,
+                              ", a shape: ",
+                              a_shape,
+                              ", b shape: ",
+                              b_shape,
+                              ").");
+
+        set_output_type(
+            i, element::f32, Shape{a_shape[1 - a_reduction_axis], b_shape[1 - b_reduction_axis]});
+    }
+}
+
+shared_ptr<Node> op::GroupedMatmul::copy_with_new_args(const NodeVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    return make_shared<GroupedMatmul>(
+        new_args, m_a_shapes, m_b_shapes, m_transpose_a, m_transpose_b);
+}
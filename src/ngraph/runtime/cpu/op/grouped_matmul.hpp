@@ -0,0 +1,62 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "ngraph/op/op.hpp"
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief Independent f32 matrix products computed by one batched GEMM. Output i is
+        ///        the product of arguments 2i and 2i + 1.
+        class GroupedMatmul : public Op
+        {
+        public:
+            /// \param args The operands of each product, a_0, b_0, a_1, b_1, ...
+            /// \param a_shapes The matrix shape each a_i is read as, before its transpose.
+            /// \param b_shapes The matrix shape each b_i is read as, before its transpose.
+            /// \param transpose_a Whether each a_i is used transposed.
+            /// \param transpose_b Whether each b_i is used transposed.
+            CPU_BACKEND_API GroupedMatmul(const NodeVector& args,
+                                          const std::vector<Shape>& a_shapes,
+                                          const std::vector<Shape>& b_shapes,
+                                          const std::vector<bool>& transpose_a,
+                                          const std::vector<bool>& transpose_b);
+
+            size_t get_matmul_count() const { return m_a_shapes.size(); }
+            const Shape& get_a_shape(size_t i) const { return m_a_shapes.at(i); }
+            const Shape& get_b_shape(size_t i) const { return m_b_shapes.at(i); }
+            bool get_is_a_transposed(size_t i) const { return m_transpose_a.at(i); }
+            bool get_is_b_transposed(size_t i) const { return m_transpose_b.at(i); }
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+        protected:
+            void validate_and_infer_types() override;
+
+            std::vector<Shape> m_a_shapes;
+            std::vector<Shape> m_b_shapes;
+            std::vector<bool> m_transpose_a;
+            std::vector<bool> m_transpose_b;
+        };
+    }
+}
@@ -0,0 +1,126 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/op/optimizer_update.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Checks that the inputs before the learning rate are real tensors of one element type and
+// shape, and that the learning rate is a scalar of that element type
+static void validate_update_inputs(const Node* node, size_t learning_rate)
+{
+    const element::Type& et = node->get_input_element_type(0);
+    const Shape& shape = node->get_input_shape(0);
+    NODE_VALIDATION_CHECK(node,
+                          et.is_real(),
+                          "Weights must have a floating point element type (weights element type: ",
+                          et,
+                          ").");
+    for (size_t i = 1; i < learning_rate; i++)
+    {
+        NODE_VALIDATION_CHECK(node,
+                              node->get_input_element_type(i) == et &&
+                                  node->get_input_shape(i) == shape,
+                              "Input ",
+                              i,
+                              " does not match the weights (weights: ",
+                              et,
+                              " ",
+                              shape,
+                              ", input: ",
+                              node->get_input_element_type(i),
+                              " ",
+                              node->get_input_shape(i),
+                              ").");
+    }
+    NODE_VALIDATION_CHECK(node,
+                          node->get_input_element_type(learning_rate) == et &&
+                              node->get_input_shape(learning_rate) == Shape{},
+                          "Learning rate must be a scalar of the weights element type (learning "
+                          "rate: ",
+                          node->get_input_element_type(learning_rate),
+                          " ",
+                          node->get_input_shape(learning_rate),
+                          ").");
+}
+
+op::SGDMomentumUpdate::SGDMomentumUpdate(const shared_ptr<Node>& weights,
+                                         const shared_ptr<Node>& velocity,
+                                         const shared_ptr<Node>& gradient,
+                                         const shared_ptr<Node>& learning_rate,
+                                         float momentum)
+    : Op("SGDMomentumUpdate",
+         check_single_output_args({weights, velocity, gradient, learning_rate}))
+    , m_momentum(momentum)
+{
+    constructor_validate_and_infer_types();
+}
+
+void op::SGDMomentumUpdate::validate_and_infer_types()
+{
+    validate_update_inputs(this, 3);
+
+    set_output_size(2);
+    set_output_type(0, get_input_element_type(0), get_input_shape(0));
+    set_output_type(1, get_input_element_type(1), get_input_shape(1));
+}
+
+shared_ptr<Node> op::SGDMomentumUpdate::copy_with_new_args(const NodeVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    return make_shared<SGDMomentumUpdate>(
+        new_args.at(0), new_args.at(1), new_args.at(2), new_args.at(3), m_momentum);
+}
+
+op::AdamUpdate::AdamUpdate(const shared_ptr<Node>& weights,
+                           const shared_ptr<Node>& m,
+                           const shared_ptr<Node>& v,
+                           const shared_ptr<Node>& gradient,
+                           const shared_ptr<Node>& learning_rate,
+                           float beta1,
+                           float beta2,
+                           float epsilon)
+    : Op("AdamUpdate", check_single_output_args({weights, m, v, gradient, learning_rate}))
+    , m_beta1(beta1)
+    , m_beta2(beta2)
+    , m_epsilon(epsilon)
+{
+    constructor_validate_and_infer_types();
+}
+
+void op::AdamUpdate::validate_and_infer_types()
+{
+    validate_update_inputs(this, 4);
+
+    set_output_size(3);
+    set_output_type(0, get_input_element_type(0), get_input_shape(0));
+    set_output_type(1, get_input_element_type(1), get_input_shape(1));
+    set_output_type(2, get_input_element_type(2), get_input_shape(2));
+}
+
+shared_ptr<Node> op::AdamUpdate::copy_with_new_args(const NodeVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    return make_shared<AdamUpdate>(new_args.at(0),
+                                   new_args.at(1),
+                                   new_args.at(2),
+                                   new_args.at(3),
+                                   new_args.at(4),
+                                   m_beta1,
+                                   m_beta2,
+                                   m_epsilon);
+}
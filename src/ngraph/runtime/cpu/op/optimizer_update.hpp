@@ -0,0 +1,104 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+
+#include "ngraph/node.hpp"
+#include "ngraph/op/op.hpp"
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief SGD with momentum update of a weight tensor, in one elementwise pass.
+        ///
+        ///     velocity' = momentum * velocity + gradient
+        ///     weights'  = weights - learning_rate * velocity'
+        ///
+        /// Output 0 is weights' and output 1 is velocity'. Each output may share the buffer of the
+        /// corresponding input: the memory planner reuses intermediate inputs in place, and
+        /// callers may bind the same tensors as the weights and velocity inputs and outputs.
+        class SGDMomentumUpdate : public Op
+        {
+        public:
+            /// \param weights The weights to update.
+            /// \param velocity The accumulated velocity, same shape and element type as `weights`.
+            /// \param gradient The gradient of the weights, same shape and element type.
+            /// \param learning_rate A scalar of the element type of the weights.
+            /// \param momentum The decay of the velocity.
+            CPU_BACKEND_API SGDMomentumUpdate(const std::shared_ptr<Node>& weights,
+                                              const std::shared_ptr<Node>& velocity,
+                                              const std::shared_ptr<Node>& gradient,
+                                              const std::shared_ptr<Node>& learning_rate,
+                                              float momentum);
+
+            float get_momentum() const { return m_momentum; }
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+        protected:
+            void validate_and_infer_types() override;
+
+            float m_momentum;
+        };
+
+        /// \brief Adam update of a weight tensor, in one elementwise pass.
+        ///
+        ///     m'       = beta1 * m + (1 - beta1) * gradient
+        ///     v'       = beta2 * v + (1 - beta2) * gradient * gradient
+        ///     weights' = weights - learning_rate * m' / (sqrt(v') + epsilon)
+        ///
+        /// Output 0 is weights', output 1 is m' and output 2 is v'. The bias correction of the
+        /// step is left to the caller, which folds it into `learning_rate`. Outputs may share the
+        /// buffers of the corresponding inputs, as with SGDMomentumUpdate.
+        class AdamUpdate : public Op
+        {
+        public:
+            /// \param weights The weights to update.
+            /// \param m The first moment estimate, same shape and element type as `weights`.
+            /// \param v The second moment estimate, same shape and element type.
+            /// \param gradient The gradient of the weights, same shape and element type.
+            /// \param learning_rate A scalar of the element type of the weights.
+            /// \param beta1 The decay of the first moment estimate.
+            /// \param beta2 The decay of the second moment estimate.
+            /// \param epsilon Added to the root of the second moment for stability.
+            CPU_BACKEND_API AdamUpdate(const std::shared_ptr<Node>& weights,
+                                       const std::shared_ptr<Node>& m,
+                                       const std::shared_ptr<Node>& v,
+                                       const std::shared_ptr<Node>& gradient,
+                                       const std::shared_ptr<Node>& learning_rate,
+                                       float beta1,
+                                       float beta2,
+                                       float epsilon);
+
+            float get_beta1() const { return m_beta1; }
+            float get_beta2() const { return m_beta2; }
+            float get_epsilon() const { return m_epsilon; }
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+        protected:
+            void validate_and_infer_types() override;
+
+            float m_beta1;
+            float m_beta2;
+            float m_epsilon;
+        };
+    }
+}
@@ -34,6 +34,10 @@ namespace ngraph
         // [2] - initializer for the input weights matrix, used for the linear transformation of the inputs.
         // [3] - initializer for the recurrent weights matrix, used for the linear transformation of the recurrent state.
         // [4] - Initializer for the bias vector w.r.to inputs + hidden state (ibh_bias + hbh_bias)
+        // [5] - optional integer tensor of Shape{batch_size} with the number of valid timesteps of
+        //       each sample. Timesteps past the end of a sample are skipped, their outputs are zero
+        //       and the output state of the sample is its state at its last valid timestep. The
+        //       right to left direction reads the valid timesteps of each sample in reverse.
         // number_of_timesteps - number of unrolled cells up to timestep t.
         // num_gates_per_cell - number of gates per RNN cell, LSTM = 4, GRU = 3, vanilla RNN = 1
         // src_sequence_length - this will be same as number_of_timesteps
@@ -60,6 +64,19 @@ namespace ngraph
                                 size_t direction,
                                 size_t num_fused_layers,
                                 ngraph::runtime::cpu::rnn_utils::rnntype rnn_type);
+            CPU_BACKEND_API Rnn(std::shared_ptr<Node> src_layer,
+                                std::shared_ptr<Node> src_iter,
+                                std::shared_ptr<Node> weights_layer,
+                                std::shared_ptr<Node> weights_iter,
+                                std::shared_ptr<Node> bias,
+                                std::shared_ptr<Node> sequence_lengths,
+                                size_t num_timesteps,
+                                size_t num_gates_per_cell,
+                                size_t src_sequence_length,
+                                size_t num_cell_states,
+                                size_t direction,
+                                size_t num_fused_layers,
+                                ngraph::runtime::cpu::rnn_utils::rnntype rnn_type);
             virtual std::shared_ptr<Node>
                 copy_with_new_args(const NodeVector& new_args) const override;
 
@@ -75,7 +92,10 @@ namespace ngraph
             size_t get_num_cell_states() const { return m_num_cell_states; }
             size_t get_direction() const { return m_direction; }
             size_t get_num_fused_layers() const { return m_num_fused_layers; }
+            bool has_sequence_lengths() const { return get_input_size() == 6; }
         private:
+            void validate_and_set_outputs();
+
             size_t m_num_timesteps;
             size_t m_num_gates_per_cell;
             size_t m_src_sequence_length;
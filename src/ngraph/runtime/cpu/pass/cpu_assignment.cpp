@@ -59,6 +59,7 @@
 #include "ngraph/runtime/cpu/op/leaky_relu.hpp"
 #include "ngraph/runtime/cpu/op/lstm.hpp"
 #include "ngraph/runtime/cpu/op/max_pool_with_indices.hpp"
+#include "ngraph/runtime/cpu/op/optimizer_update.hpp"
 #include "ngraph/runtime/cpu/op/rnn.hpp"
 #include "ngraph/runtime/cpu/op/sigmoid.hpp"
 #include "ngraph/runtime/cpu/op/update_slice.hpp"
@@ -66,6 +67,26 @@
 using namespace std;
 using namespace ngraph;
 
+// Lets output i of an optimizer update overwrite input i, unless the tensor of input i is also
+// read through another input of the update
+static void add_update_in_place_oi_pairs(Node* node,
+                                         const shared_ptr<op::util::OpAnnotations>& annotations)
+{
+    auto& inputs = node->get_inputs();
+    for (size_t i = 0; i < node->get_output_size(); i++)
+    {
+        bool shared = false;
+        for (size_t j = 0; j < inputs.size(); j++)
+        {
+            shared |= j != i && &inputs.at(j).get_output() == &inputs.at(i).get_output();
+        }
+        if (!shared)
+        {
+            annotations->add_in_place_oi_pair({i, i, true});
+        }
+    }
+}
+
 namespace ngraph
 {
     namespace runtime
@@ -490,6 +511,30 @@ namespace ngraph
                     update_slice->set_op_annotations(op_annotations);
                 }
 
+                template <>
+                void CPUAssignment::ASSIGN_DECL(ngraph::op::SGDMomentumUpdate)
+                {
+                    auto update = static_cast<op::SGDMomentumUpdate*>(node);
+
+                    // The kernel reads each element before writing it, so the weights and
+                    // velocity can be updated in their input buffers
+                    auto op_annotations =
+                        std::make_shared<ngraph::runtime::cpu::CPUOpAnnotations>();
+                    add_update_in_place_oi_pairs(node, op_annotations);
+                    update->set_op_annotations(op_annotations);
+                }
+
+                template <>
+                void CPUAssignment::ASSIGN_DECL(ngraph::op::AdamUpdate)
+                {
+                    auto update = static_cast<op::AdamUpdate*>(node);
+
+                    auto op_annotations =
+                        std::make_shared<ngraph::runtime::cpu::CPUOpAnnotations>();
+                    add_update_in_place_oi_pairs(node, op_annotations);
+                    update->set_op_annotations(op_annotations);
+                }
+
                 template <>
                 void CPUAssignment::ASSIGN_DECL(ngraph::op::LRN)
                 {
@@ -914,6 +959,10 @@ static const runtime::cpu::pass::AssignOpMap s_dispatcher{
      &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::ReplaceSlice>},
     {TI(ngraph::op::UpdateSlice),
      &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::UpdateSlice>},
+    {TI(ngraph::op::SGDMomentumUpdate),
+     &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::SGDMomentumUpdate>},
+    {TI(ngraph::op::AdamUpdate),
+     &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::AdamUpdate>},
     {TI(ngraph::op::ConvolutionAdd),
      &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::ConvolutionAdd>},
     {TI(ngraph::op::QuantizedConvolutionRelu),
@@ -0,0 +1,164 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <unordered_set>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/convert.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/runtime/cpu/op/dot_f16_weights.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_f16_lowering.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Converts inserted by the lowering. Values go through them only when they leave f32.
+using Converts = unordered_set<shared_ptr<Node>>;
+
+static shared_ptr<Node> to_f16(const shared_ptr<Node>& node, Converts& converts)
+{
+    auto convert = make_shared<op::Convert>(node, element::f16);
+    converts.insert(convert);
+    return convert;
+}
+
+static shared_ptr<Node> to_f32(const shared_ptr<Node>& node, const Converts& converts)
+{
+    if (node->get_element_type() != element::f16)
+    {
+        return node;
+    }
+    if (converts.count(node))
+    {
+        return node->get_argument(0);
+    }
+    return make_shared<op::Convert>(node, element::f32);
+}
+
+static bool uses_f16(const shared_ptr<Node>& node)
+{
+    for (auto& input : node->get_inputs())
+    {
+        if (input.get_element_type() == element::f16)
+        {
+            return true;
+        }
+    }
+    for (auto& output : node->get_outputs())
+    {
+        if (output.get_element_type() == element::f16)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Only f16 <-> f32 Converts have kernels, others go through f32
+static bool lower_convert(const shared_ptr<op::Convert>& convert, const Converts& converts)
+{
+    auto arg = convert->get_argument(0);
+    const element::Type& from = arg->get_element_type();
+    const element::Type& to = convert->get_element_type();
+    if (from == element::f16 && to != element::f32)
+    {
+        replace_node(convert, make_shared<op::Convert>(to_f32(arg, converts), to));
+        return true;
+    }
+    if (to == element::f16 && from != element::f32)
+    {
+        auto f32_arg = make_shared<op::Convert>(arg, element::f32);
+        replace_node(convert, make_shared<op::Convert>(f32_arg, element::f16));
+        return true;
+    }
+    return false;
+}
+
+// Dot(arg, Convert(weights)) or Dot(arg, Reshape{1, 0}(Convert(weights))) with f16 weights
+static bool fuse_f16_weights(const shared_ptr<op::Dot>& dot)
+{
+    if (dot->get_element_type() != element::f32 || dot->get_input_shape(0).size() != 2 ||
+        dot->get_input_shape(1).size() != 2 || dot->get_reduction_axes_count() != 1)
+    {
+        return false;
+    }
+
+    auto weights = dot->get_argument(1);
+    bool transpose_weights = false;
+    auto reshape = dynamic_pointer_cast<op::Reshape>(weights);
+    if (reshape && reshape->get_input_order() == AxisVector{1, 0})
+    {
+        weights = reshape->get_argument(0);
+        transpose_weights = true;
+    }
+    if (!dynamic_pointer_cast<op::Convert>(weights) ||
+        weights->get_input_element_type(0) != element::f16)
+    {
+        return false;
+    }
+
+    NGRAPH_DEBUG << "Reading the weights of " << dot->get_name() << " in f16";
+    replace_node(dot,
+                 make_shared<op::DotF16Weights>(
+                     dot->get_argument(0), weights->get_argument(0), transpose_weights));
+    return true;
+}
+
+bool runtime::cpu::pass::CPUF16Lowering::run_on_function(shared_ptr<ngraph::Function> function)
+{
+    bool replaced = false;
+    Converts converts;
+    for (auto n : function->get_ordered_ops())
+    {
+        if (n->is_parameter() || n->is_constant() || n->is_output() || !uses_f16(n))
+        {
+            continue;
+        }
+        if (auto convert = dynamic_pointer_cast<op::Convert>(n))
+        {
+            replaced = lower_convert(convert, converts) || replaced;
+            continue;
+        }
+        if (n->get_output_size() != 1)
+        {
+            NGRAPH_DEBUG << "No f32 lowering for multi-output " << n->get_name();
+            continue;
+        }
+
+        NodeVector new_args;
+        for (auto& arg : n->get_arguments())
+        {
+            new_args.push_back(to_f32(arg, converts));
+        }
+        auto f32_node = n->copy_with_new_args(new_args);
+        NGRAPH_DEBUG << "Computing " << n->get_name() << " in f32";
+        replace_node(n,
+                     n->get_element_type() == element::f16 ? to_f16(f32_node, converts)
+                                                           : f32_node);
+        replaced = true;
+    }
+
+    for (auto n : function->get_ordered_ops())
+    {
+        if (auto dot = dynamic_pointer_cast<op::Dot>(n))
+        {
+            replaced = fuse_f16_weights(dot) || replaced;
+        }
+    }
+    return replaced;
+}
@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <numeric>
 #include <string>
@@ -75,6 +76,7 @@
 #include "ngraph/runtime/cpu/op/leaky_relu.hpp"
 #include "ngraph/runtime/cpu/op/lstm.hpp"
 #include "ngraph/runtime/cpu/op/matmul_bias.hpp"
+#include "ngraph/runtime/cpu/op/optimizer_update.hpp"
 #include "ngraph/runtime/cpu/op/rnn_utils.hpp"
 #include "ngraph/runtime/cpu/op/sigmoid_mul.hpp"
 #include "ngraph/runtime/cpu/op/update_slice.hpp"
@@ -1875,6 +1877,198 @@ void ngraph::runtime::cpu::pass::CPUFusion::construct_update_slice()
     this->add_matcher(m);
 }
 
+// Returns true and the value of `node` when it is a float constant with all elements equal
+static bool get_uniform_constant(const std::shared_ptr<ngraph::Node>& node, float& value)
+{
+    auto constant = std::dynamic_pointer_cast<ngraph::op::Constant>(node);
+    if (!constant || constant->get_element_type() != ngraph::element::f32)
+    {
+        return false;
+    }
+    auto values = constant->get_vector<float>();
+    if (values.empty() ||
+        std::any_of(values.begin(), values.end(), [&](float v) { return v != values[0]; }))
+    {
+        return false;
+    }
+    value = values[0];
+    return true;
+}
+
+// velocity' = momentum * velocity + gradient, weights' = weights - learning_rate * velocity'
+void ngraph::runtime::cpu::pass::CPUFusion::construct_sgd_momentum_update()
+{
+    Shape shape{2, 2};
+    auto broadcast_pred = [](std::shared_ptr<Node> n) {
+        return (std::dynamic_pointer_cast<op::Broadcast>(n) != nullptr);
+    };
+    auto constant_pred = [](std::shared_ptr<Node> n) {
+        return (std::dynamic_pointer_cast<op::Constant>(n) != nullptr);
+    };
+
+    auto weights = std::make_shared<pattern::op::Label>(element::f32, shape);
+    auto velocity = std::make_shared<pattern::op::Label>(element::f32, shape);
+    auto gradient = std::make_shared<pattern::op::Label>(element::f32, shape);
+    auto momentum = std::make_shared<pattern::op::Label>(element::f32, shape, constant_pred);
+    auto learning_rate = std::make_shared<pattern::op::Label>(element::f32, shape);
+
+    auto skip_momentum = std::make_shared<pattern::op::Skip>(momentum, broadcast_pred);
+    auto velocity_update = std::make_shared<op::Add>(
+        std::make_shared<op::Multiply>(skip_momentum, velocity), gradient);
+    auto velocity_label = std::make_shared<pattern::op::Label>(
+        velocity_update, nullptr, NodeVector{velocity_update});
+    auto skip_learning_rate = std::make_shared<pattern::op::Skip>(learning_rate, broadcast_pred);
+    auto weights_update = std::make_shared<op::Subtract>(
+        weights, std::make_shared<op::Multiply>(skip_learning_rate, velocity_label));
+
+    pattern::graph_rewrite_callback callback =
+        [weights, velocity, gradient, momentum, learning_rate, velocity_label](
+            pattern::Matcher& m) {
+            NGRAPH_DEBUG << "In callback for construct_sgd_momentum_update against "
+                         << m.get_match_root()->get_name();
+            auto pattern_map = m.get_pattern_map();
+
+            float momentum_value;
+            if (!get_uniform_constant(pattern_map[momentum], momentum_value))
+            {
+                NGRAPH_DEBUG << "momentum must be a uniform f32 constant";
+                return false;
+            }
+            if (pattern_map[learning_rate]->get_shape() != Shape{} ||
+                pattern_map[learning_rate]->get_element_type() != element::f32)
+            {
+                NGRAPH_DEBUG << "learning rate must be a broadcast f32 scalar";
+                return false;
+            }
+
+            auto update = std::make_shared<op::SGDMomentumUpdate>(pattern_map[weights],
+                                                                  pattern_map[velocity],
+                                                                  pattern_map[gradient],
+                                                                  pattern_map[learning_rate],
+                                                                  momentum_value);
+            ngraph::replace_node(m.get_match_root(),
+                                 std::make_shared<op::GetOutputElement>(update, 0));
+            ngraph::replace_node(pattern_map[velocity_label],
+                                 std::make_shared<op::GetOutputElement>(update, 1));
+            return true;
+        };
+
+    auto m = std::make_shared<pattern::Matcher>(
+        weights_update, callback, "CPUFusion.SGDMomentumUpdate");
+    this->add_matcher(m);
+}
+
+// m' = beta1 * m + (1 - beta1) * gradient, v' = beta2 * v + (1 - beta2) * gradient * gradient,
+// weights' = weights - learning_rate * m' / (sqrt(v') + epsilon)
+void ngraph::runtime::cpu::pass::CPUFusion::construct_adam_update()
+{
+    Shape shape{2, 2};
+    auto broadcast_pred = [](std::shared_ptr<Node> n) {
+        return (std::dynamic_pointer_cast<op::Broadcast>(n) != nullptr);
+    };
+    auto constant_pred = [](std::shared_ptr<Node> n) {
+        return (std::dynamic_pointer_cast<op::Constant>(n) != nullptr);
+    };
+    auto make_constant_label = [&]() {
+        auto label = std::make_shared<pattern::op::Label>(element::f32, shape, constant_pred);
+        return std::make_pair(label, std::make_shared<pattern::op::Skip>(label, broadcast_pred));
+    };
+
+    auto weights = std::make_shared<pattern::op::Label>(element::f32, shape);
+    auto m1 = std::make_shared<pattern::op::Label>(element::f32, shape);
+    auto m2 = std::make_shared<pattern::op::Label>(element::f32, shape);
+    auto gradient = std::make_shared<pattern::op::Label>(element::f32, shape);
+    auto learning_rate = std::make_shared<pattern::op::Label>(element::f32, shape);
+    auto beta1 = make_constant_label();
+    auto beta1_complement = make_constant_label();
+    auto beta2 = make_constant_label();
+    auto beta2_complement = make_constant_label();
+    auto epsilon = make_constant_label();
+
+    auto m1_update = std::make_shared<op::Add>(
+        std::make_shared<op::Multiply>(beta1.second, m1),
+        std::make_shared<op::Multiply>(beta1_complement.second, gradient));
+    auto m1_label =
+        std::make_shared<pattern::op::Label>(m1_update, nullptr, NodeVector{m1_update});
+    auto gradient_square = std::make_shared<op::Multiply>(gradient, gradient);
+    auto m2_update = std::make_shared<op::Add>(
+        std::make_shared<op::Multiply>(beta2.second, m2),
+        std::make_shared<op::Multiply>(beta2_complement.second, gradient_square));
+    auto m2_label =
+        std::make_shared<pattern::op::Label>(m2_update, nullptr, NodeVector{m2_update});
+    auto skip_learning_rate = std::make_shared<pattern::op::Skip>(learning_rate, broadcast_pred);
+    auto step = std::make_shared<op::Divide>(
+        std::make_shared<op::Multiply>(skip_learning_rate, m1_label),
+        std::make_shared<op::Add>(std::make_shared<op::Sqrt>(m2_label), epsilon.second));
+    auto weights_update = std::make_shared<op::Subtract>(weights, step);
+
+    auto beta1_label = beta1.first;
+    auto beta1_complement_label = beta1_complement.first;
+    auto beta2_label = beta2.first;
+    auto beta2_complement_label = beta2_complement.first;
+    auto epsilon_label = epsilon.first;
+    pattern::graph_rewrite_callback callback = [weights,
+                                                m1,
+                                                m2,
+                                                gradient,
+                                                learning_rate,
+                                                beta1_label,
+                                                beta1_complement_label,
+                                                beta2_label,
+                                                beta2_complement_label,
+                                                epsilon_label,
+                                                m1_label,
+                                                m2_label](pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In callback for construct_adam_update against "
+                     << m.get_match_root()->get_name();
+        auto pattern_map = m.get_pattern_map();
+
+        float beta1_value, beta1_complement_value, beta2_value, beta2_complement_value,
+            epsilon_value;
+        if (!get_uniform_constant(pattern_map[beta1_label], beta1_value) ||
+            !get_uniform_constant(pattern_map[beta1_complement_label], beta1_complement_value) ||
+            !get_uniform_constant(pattern_map[beta2_label], beta2_value) ||
+            !get_uniform_constant(pattern_map[beta2_complement_label], beta2_complement_value) ||
+            !get_uniform_constant(pattern_map[epsilon_label], epsilon_value))
+        {
+            NGRAPH_DEBUG << "Adam hyperparameters must be uniform f32 constants";
+            return false;
+        }
+        // AdamUpdate derives the complements from beta1 and beta2
+        const float tolerance = 1e-6f;
+        if (std::abs(1 - beta1_value - beta1_complement_value) > tolerance ||
+            std::abs(1 - beta2_value - beta2_complement_value) > tolerance)
+        {
+            NGRAPH_DEBUG << "gradient scales are not the complements of beta1 and beta2";
+            return false;
+        }
+        if (pattern_map[learning_rate]->get_shape() != Shape{} ||
+            pattern_map[learning_rate]->get_element_type() != element::f32)
+        {
+            NGRAPH_DEBUG << "learning rate must be a broadcast f32 scalar";
+            return false;
+        }
+
+        auto update = std::make_shared<op::AdamUpdate>(pattern_map[weights],
+                                                       pattern_map[m1],
+                                                       pattern_map[m2],
+                                                       pattern_map[gradient],
+                                                       pattern_map[learning_rate],
+                                                       beta1_value,
+                                                       beta2_value,
+                                                       epsilon_value);
+        ngraph::replace_node(m.get_match_root(), std::make_shared<op::GetOutputElement>(update, 0));
+        ngraph::replace_node(pattern_map[m1_label],
+                             std::make_shared<op::GetOutputElement>(update, 1));
+        ngraph::replace_node(pattern_map[m2_label],
+                             std::make_shared<op::GetOutputElement>(update, 2));
+        return true;
+    };
+
+    auto m = std::make_shared<pattern::Matcher>(weights_update, callback, "CPUFusion.AdamUpdate");
+    this->add_matcher(m);
+}
+
 // QuantizedConvolution + Dequantize + Relu -> QuantizedConvolutionRelu + Dequantize
 void ngraph::runtime::cpu::pass::CPUQuantFusion::construct_qconv_relu(bool with_bias)
 {
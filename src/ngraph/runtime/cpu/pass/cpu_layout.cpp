@@ -15,10 +15,13 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <limits>
+#include <map>
 #include <memory>
 #include <string>
 #include <typeindex>
 #include <typeinfo>
+#include <unordered_map>
 
 #include <mkldnn.hpp>
 
@@ -73,6 +76,10 @@ using namespace mkldnn;
 using namespace ngraph;
 using namespace ngraph::runtime::cpu;
 
+// Estimated bytes reordered downstream of a tensor for each format it could be produced in.
+// Blocked layouts without a name all map to mkldnn_blocked.
+using LayoutDemand = map<mkldnn_memory_format_t, size_t>;
+
 // Check if the input layout matches the layout requested in `required_mds`
 // If not, insert a layout conversion node between the input tensor and
 // the `node`. For now, only MKLDNN nodes/kernels can request specific layouts
@@ -290,8 +297,40 @@ static void set_layouts_unaryeltwise(ngraph::runtime::cpu::CPU_ExternalFunction*
     }
 }
 
+// Picks the argument whose layout the op and its output should take: the one minimizing the
+// bytes reordered in front of this op plus the bytes reordered downstream of it
+static int select_binaryeltwise_layout(const shared_ptr<Node>& node,
+                                       const vector<memory::desc>& arg_mds,
+                                       const LayoutDemand& demand)
+{
+    int selected = 0;
+    size_t selected_cost = numeric_limits<size_t>::max();
+    for (int select = 0; select < 2; select++)
+    {
+        size_t cost = 0;
+        if (!mkldnn_utils::compare_mkldnn_mds(arg_mds[0], arg_mds[1]))
+        {
+            cost += node->get_inputs().at(1 - select).get_tensor().size();
+        }
+        for (auto& format_bytes : demand)
+        {
+            if (format_bytes.first != arg_mds[select].data.format)
+            {
+                cost += format_bytes.second;
+            }
+        }
+        if (cost < selected_cost)
+        {
+            selected = select;
+            selected_cost = cost;
+        }
+    }
+    return selected;
+}
+
 void set_layouts_binaryeltwise(ngraph::runtime::cpu::CPU_ExternalFunction* external_function,
-                               std::shared_ptr<ngraph::Node> node)
+                               std::shared_ptr<ngraph::Node> node,
+                               const LayoutDemand& demand)
 {
     std::vector<mkldnn::memory::desc> arg_mds{mkldnn_utils::get_input_mkldnn_md(node.get(), 0),
                                               mkldnn_utils::get_input_mkldnn_md(node.get(), 1)};
@@ -305,7 +344,7 @@ void set_layouts_binaryeltwise(ngraph::runtime::cpu::CPU_ExternalFunction* exter
     {
         vector<memory::desc> i_mds;
         vector<memory::desc> o_mds;
-        int select = 0;
+        int select = select_binaryeltwise_layout(node, arg_mds, demand);
         char* ngraph_pass_cpu_layout_eltwise = std::getenv("NGRAPH_PASS_CPU_LAYOUT_ELTWISE");
         if (ngraph_pass_cpu_layout_eltwise != nullptr)
         {
@@ -2168,8 +2207,127 @@ static const runtime::cpu::pass::LayoutOpMap s_dispatcher{
      &runtime::cpu::pass::CPULayout::layout<ngraph::op::QuantizedConcat>},
 };
 
+// Ops whose output layout follows the layout of their inputs
+static bool is_layout_transparent(const Node* node)
+{
+    if (dynamic_cast<const ngraph::op::util::UnaryElementwiseArithmetic*>(node) ||
+        dynamic_cast<const ngraph::op::util::BinaryElementwiseArithmetic*>(node))
+    {
+        return true;
+    }
+    return (dynamic_cast<const ngraph::op::MaxPool*>(node) ||
+            dynamic_cast<const ngraph::op::AvgPool*>(node)) &&
+           mkldnn_utils::use_mkldnn_kernel(node);
+}
+
+// Format an MKLDNN convolution asks for on its data input, mkldnn_format_undef for other ops
+static mkldnn_memory_format_t get_conv_data_format(const shared_ptr<Node>& node)
+{
+    if (!mkldnn_utils::use_mkldnn_kernel(node.get()))
+    {
+        return mkldnn_format_undef;
+    }
+    vector<memory::desc> i_mds;
+    vector<memory::desc> o_mds;
+    auto& n = *node;
+    try
+    {
+        if (TI(n) == TI(ngraph::op::Convolution))
+        {
+            runtime::cpu::pass::ConvolutionLayout<ngraph::op::Convolution, false>(
+                node, i_mds, o_mds);
+        }
+        else if (TI(n) == TI(ngraph::op::ConvolutionRelu))
+        {
+            runtime::cpu::pass::ConvolutionLayout<ngraph::op::ConvolutionRelu, false>(
+                node, i_mds, o_mds);
+        }
+        else if (TI(n) == TI(ngraph::op::ConvolutionAdd))
+        {
+            runtime::cpu::pass::ConvolutionLayout<ngraph::op::ConvolutionAdd, false>(
+                node, i_mds, o_mds);
+        }
+        else if (TI(n) == TI(ngraph::op::ConvolutionBias))
+        {
+            runtime::cpu::pass::ConvolutionLayout<ngraph::op::ConvolutionBias, true>(
+                node, i_mds, o_mds);
+        }
+        else if (TI(n) == TI(ngraph::op::ConvolutionBiasAdd))
+        {
+            runtime::cpu::pass::ConvolutionLayout<ngraph::op::ConvolutionBiasAdd, true>(
+                node, i_mds, o_mds);
+        }
+    }
+    catch (const ngraph_error& e)
+    {
+        NGRAPH_DEBUG << "No layout estimate for " << node->get_name() << ": " << e.what();
+    }
+    return i_mds.empty() ? mkldnn_format_undef
+                         : static_cast<mkldnn_memory_format_t>(i_mds[0].data.format);
+}
+
+// Walks the graph backwards and accumulates, for every single-output op, how many bytes each of
+// its consumers would have to reorder per candidate output format. Convolutions ask for the
+// format MKLDNN picks for them, layout-transparent ops forward the demand of their own
+// consumers, and everything else asks for the native row-major layout.
+//
+// This is a one-pass estimate, not a layout solver: only binary elementwise ops consult it,
+// every other op keeps its own local choice, and the cost is reordered bytes rather than
+// kernel time.
+static unordered_map<const Node*, LayoutDemand>
+    estimate_layout_demand(const std::list<std::shared_ptr<Node>>& nodes)
+{
+    unordered_map<const Node*, LayoutDemand> demand;
+    for (auto it = nodes.rbegin(); it != nodes.rend(); ++it)
+    {
+        const auto& node = *it;
+        if (node->get_output_size() != 1)
+        {
+            continue;
+        }
+        const descriptor::Output& output = node->get_outputs().at(0);
+        auto shape = output.get_shape();
+        auto et = output.get_element_type();
+        Strides strides = row_major_strides(shape);
+        size_t bytes = output.get_tensor().size();
+
+        LayoutDemand& node_demand = demand[node.get()];
+        for (const descriptor::Input* input : output.get_inputs())
+        {
+            auto user = input->get_node();
+            if (is_layout_transparent(user.get()))
+            {
+                auto user_demand = demand.find(user.get());
+                if (user_demand != demand.end())
+                {
+                    for (auto& format_bytes : user_demand->second)
+                    {
+                        node_demand[format_bytes.first] += format_bytes.second;
+                    }
+                }
+                continue;
+            }
+
+            mkldnn_memory_format_t format =
+                input->get_index() == 0 ? get_conv_data_format(user) : mkldnn_format_undef;
+            if (format == mkldnn_format_undef &&
+                mkldnn_utils::can_create_mkldnn_md(shape, strides, et))
+            {
+                format = static_cast<mkldnn_memory_format_t>(
+                    mkldnn_utils::create_blocked_mkldnn_md(shape, strides, et).data.format);
+            }
+            if (format != mkldnn_format_undef)
+            {
+                node_demand[format] += bytes;
+            }
+        }
+    }
+    return demand;
+}
+
 bool runtime::cpu::pass::CPULayout::run_on_call_graph(const std::list<std::shared_ptr<Node>>& nodes)
 {
+    auto demand = estimate_layout_demand(nodes);
     for (const auto& node : nodes)
     {
         auto& n = *node;
@@ -2186,7 +2344,7 @@ bool runtime::cpu::pass::CPULayout::run_on_call_graph(const std::list<std::share
         else if (dynamic_pointer_cast<ngraph::op::util::BinaryElementwiseArithmetic>(node) !=
                  nullptr)
         {
-            set_layouts_binaryeltwise(m_external_function, node);
+            set_layouts_binaryeltwise(m_external_function, node, demand[node.get()]);
         }
         else
         {
@@ -0,0 +1,149 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <map>
+#include <unordered_map>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/op/get_output_element.hpp"
+#include "ngraph/runtime/cpu/op/grouped_matmul.hpp"
+#include "ngraph/runtime/cpu/op/matmul_bias.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_matmul_horizontal_fusion.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    struct Matmul
+    {
+        shared_ptr<Node> node;
+        Shape a_shape;
+        Shape b_shape;
+        bool transpose_a;
+        bool transpose_b;
+
+        size_t get_mnk() const
+        {
+            size_t m = a_shape[transpose_a ? 1 : 0];
+            size_t k = a_shape[transpose_a ? 0 : 1];
+            size_t n = b_shape[transpose_b ? 0 : 1];
+            return m * n * k;
+        }
+    };
+}
+
+static bool get_matmul(const shared_ptr<Node>& node, Matmul& matmul)
+{
+    if (node->get_output_size() != 1 || node->get_element_type() != element::f32 ||
+        shape_size(node->get_shape()) == 0 || !node->get_control_dependencies().empty())
+    {
+        return false;
+    }
+
+    if (auto dot = dynamic_pointer_cast<op::Dot>(node))
+    {
+        if (dot->get_reduction_axes_count() != 1 || dot->get_input_shape(0).size() != 2 ||
+            dot->get_input_shape(1).size() != 2)
+        {
+            return false;
+        }
+        matmul = {node, dot->get_input_shape(0), dot->get_input_shape(1), false, false};
+    }
+    else if (auto matmul_bias = dynamic_pointer_cast<op::MatmulBias>(node))
+    {
+        if (matmul_bias->get_input_size() != 2)
+        {
+            return false;
+        }
+        matmul = {node,
+                  matmul_bias->get_a_shape(),
+                  matmul_bias->get_b_shape(),
+                  matmul_bias->get_is_a_transposed(),
+                  matmul_bias->get_is_b_transposed()};
+    }
+    else
+    {
+        return false;
+    }
+
+    // Empty operands are left to the builders of the single products, which skip the GEMM
+    return shape_size(matmul.a_shape) != 0 && shape_size(matmul.b_shape) != 0;
+}
+
+bool runtime::cpu::pass::CPUMatmulHorizontalFusion::run_on_function(shared_ptr<Function> function)
+{
+    unordered_map<Node*, size_t> levels;
+    map<size_t, vector<Matmul>> matmuls;
+    for (auto& node : function->get_ordered_ops())
+    {
+        size_t level = 0;
+        for (auto& arg : node->get_arguments())
+        {
+            level = max(level, levels[arg.get()]);
+        }
+        for (auto& dependency : node->get_control_dependencies())
+        {
+            level = max(level, levels[dependency.get()]);
+        }
+
+        Matmul matmul;
+        if (get_matmul(node, matmul) && matmul.get_mnk() <= m_max_mnk)
+        {
+            level++;
+            matmuls[level].push_back(matmul);
+        }
+        levels[node.get()] = level;
+    }
+
+    bool replaced = false;
+    for (auto& level : matmuls)
+    {
+        auto& group = level.second;
+        if (group.size() < 2)
+        {
+            continue;
+        }
+
+        NodeVector args;
+        vector<Shape> a_shapes;
+        vector<Shape> b_shapes;
+        vector<bool> transpose_a;
+        vector<bool> transpose_b;
+        for (auto& matmul : group)
+        {
+            args.push_back(matmul.node->get_argument(0));
+            args.push_back(matmul.node->get_argument(1));
+            a_shapes.push_back(matmul.a_shape);
+            b_shapes.push_back(matmul.b_shape);
+            transpose_a.push_back(matmul.transpose_a);
+            transpose_b.push_back(matmul.transpose_b);
+        }
+        NGRAPH_DEBUG << "Fusing " << group.size() << " independent matrix products";
+
+        auto grouped_matmul =
+            make_shared<op::GroupedMatmul>(args, a_shapes, b_shapes, transpose_a, transpose_b);
+        for (size_t i = 0; i < group.size(); i++)
+        {
+            replace_node(group[i].node, make_shared<op::GetOutputElement>(grouped_matmul, i));
+        }
+        replaced = true;
+    }
+    return replaced;
+}
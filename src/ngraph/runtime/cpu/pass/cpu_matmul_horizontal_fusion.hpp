@@ -0,0 +1,56 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace pass
+            {
+                /// \brief Computes independent 2D f32 matrix products, Dots and MatmulBias
+                ///        without a bias, with one batched GEMM, whether or not they share an
+                ///        input. Products are independent when they are at the same level, the
+                ///        length of the longest chain of products they depend on, which also
+                ///        keeps the fused graph acyclic.
+                ///
+                ///        Only products of at most max_mnk multiply-adds (m * n * k) are
+                ///        batched: a small GEMM cannot keep every core busy on its own, while
+                ///        a large one already does and only loses its own blocking when run
+                ///        as part of a batch.
+                class CPUMatmulHorizontalFusion : public ngraph::pass::FunctionPass
+                {
+                public:
+                    CPUMatmulHorizontalFusion(size_t max_mnk = 64 * 64 * 64)
+                        : FunctionPass()
+                        , m_max_mnk(max_mnk)
+                    {
+                    }
+
+                    bool run_on_function(std::shared_ptr<ngraph::Function> function) override;
+
+                private:
+                    size_t m_max_mnk;
+                };
+            }
+        }
+    }
+}
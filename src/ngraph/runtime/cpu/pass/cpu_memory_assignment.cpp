@@ -357,7 +357,8 @@ void runtime::cpu::pass::CPUMemoryAssignment::propagate_in_place_slice(
 // CPUTensorRole is INPUT, CONSTANT, OUTPUT, or INTERMEDIATE,
 // which tells from where the memory buffer comes.
 // tensor_to_bufferID maps tensor to the ID of the buffer set it belongs to.
-void runtime::cpu::pass::CPUMemoryAssignment::build_buffer_sets_maps(list<shared_ptr<Node>>& ops)
+void runtime::cpu::pass::CPUMemoryAssignment::build_buffer_sets_maps(
+    const list<shared_ptr<Node>>& ops)
 {
     unordered_set<descriptor::Tensor*> in_place_slice_chain;
     size_t count = 0;
@@ -564,7 +565,7 @@ void runtime::cpu::pass::CPUMemoryAssignment::build_buffer_sets_maps(list<shared
 }
 
 void runtime::cpu::pass::CPUMemoryAssignment::liveness_analysis(
-    std::list<std::shared_ptr<Node>>& ops)
+    const std::list<std::shared_ptr<Node>>& ops)
 {
     auto find_role = [](CPUTensorRole tensor_role) -> string {
         switch (tensor_role)
@@ -638,7 +639,8 @@ void runtime::cpu::pass::CPUMemoryAssignment::liveness_analysis(
 
 bool runtime::cpu::pass::CPUMemoryAssignment::run_on_function(shared_ptr<ngraph::Function> function)
 {
-    list<shared_ptr<Node>> ops = function->get_ordered_ops();
+    auto ordered_ops = function->get_ordered_ops_shared();
+    const list<shared_ptr<Node>>& ops = *ordered_ops;
 
     build_buffer_sets_maps(ops);
     liveness_analysis(ops);
@@ -654,7 +656,7 @@ bool runtime::cpu::pass::CPUMemoryAssignment::run_on_function(shared_ptr<ngraph:
     if (!m_disable_memory_sharing)
     {
         // build caching map from cacheability
-        for (shared_ptr<Node> node : function->get_ordered_ops())
+        for (const shared_ptr<Node>& node : ops)
         {
             if (node->is_op())
             {
@@ -676,7 +678,7 @@ bool runtime::cpu::pass::CPUMemoryAssignment::run_on_function(shared_ptr<ngraph:
         }
     }
 
-    for (shared_ptr<Node> node : function->get_ordered_ops())
+    for (const shared_ptr<Node>& node : ops)
     {
         if (node->is_parameter() || node->is_constant() || node->is_output())
         {
@@ -63,10 +63,10 @@ private:
     void propagate_in_place_slice(ngraph::descriptor::Input* input, size_t input_index);
 
     // build buffer sets maps
-    void build_buffer_sets_maps(std::list<std::shared_ptr<Node>>& ops);
+    void build_buffer_sets_maps(const std::list<std::shared_ptr<Node>>& ops);
 
     // liveness analysis to build new and free list for each node
-    void liveness_analysis(std::list<std::shared_ptr<Node>>& ops);
+    void liveness_analysis(const std::list<std::shared_ptr<Node>>& ops);
 
     size_t get_bufferID(descriptor::Tensor* tensor);
 
@@ -0,0 +1,175 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_set>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/convert.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/op/maximum.hpp"
+#include "ngraph/op/minimum.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/negative.hpp"
+#include "ngraph/op/relu.hpp"
+#include "ngraph/op/subtract.hpp"
+#include "ngraph/op/sum.hpp"
+#include "ngraph/runtime/cpu/op/dot_f16_weights.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_mixed_precision.hpp"
+#include "ngraph/type/bfloat16.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+#define TI(x) type_index(typeid(x))
+
+// Ops that follow their inputs into bfloat16. Their bfloat16 kernels widen each block to f32,
+// so none of them loses precision beyond the rounding of its result.
+static const unordered_set<type_index> s_follower_ops{TI(op::Add),
+                                                      TI(op::Subtract),
+                                                      TI(op::Multiply),
+                                                      TI(op::Maximum),
+                                                      TI(op::Minimum),
+                                                      TI(op::Negative),
+                                                      TI(op::Relu),
+                                                      TI(op::Sum)};
+
+// The bfloat16 value a Convert to f32 inserted by this pass was made from, or nullptr
+static shared_ptr<Node> get_bf16_source(const shared_ptr<Node>& node)
+{
+    if (dynamic_pointer_cast<op::Convert>(node) &&
+        node->get_input_element_type(0) == element::bf16)
+    {
+        return node->get_argument(0);
+    }
+    return nullptr;
+}
+
+// Only values that already exist in bfloat16 and constants, rounded once ahead of time, are
+// read in bfloat16. Converting an f32 activation would write and read it once more.
+static bool is_bf16_available(const shared_ptr<Node>& node)
+{
+    return get_bf16_source(node) || dynamic_pointer_cast<op::Constant>(node);
+}
+
+static shared_ptr<Node> to_bf16(const shared_ptr<Node>& node)
+{
+    if (auto source = get_bf16_source(node))
+    {
+        return source;
+    }
+    auto constant = static_pointer_cast<op::Constant>(node);
+    vector<bfloat16> values;
+    for (float value : constant->get_vector<float>())
+    {
+        values.push_back(bfloat16(value, true));
+    }
+    return make_shared<op::Constant>(element::bf16, constant->get_shape(), values);
+}
+
+static bool is_f32_single_output(const shared_ptr<Node>& node)
+{
+    if (node->get_output_size() != 1 || node->get_element_type() != element::f32)
+    {
+        return false;
+    }
+    for (auto& input : node->get_inputs())
+    {
+        if (input.get_element_type() != element::f32)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool is_bf16_candidate(const shared_ptr<Node>& node)
+{
+    if (!is_f32_single_output(node))
+    {
+        return false;
+    }
+    if (auto dot = dynamic_pointer_cast<op::Dot>(node))
+    {
+        // Other Dots have no faster kernel than the reference one
+        if (dot->get_input_shape(0).size() != 2 || dot->get_input_shape(1).size() != 2 ||
+            dot->get_reduction_axes_count() != 1)
+        {
+            return false;
+        }
+    }
+    else if (s_follower_ops.count(TI(*node)) == 0)
+    {
+        return false;
+    }
+
+    // Converting a follower on its own, or any op on f32 activations, only adds conversions
+    bool has_bf16_source = false;
+    for (auto& arg : node->get_arguments())
+    {
+        if (!is_bf16_available(arg))
+        {
+            return false;
+        }
+        has_bf16_source = has_bf16_source || get_bf16_source(arg);
+    }
+    return has_bf16_source || dynamic_pointer_cast<op::Dot>(node);
+}
+
+// A 2D Dot of f32 data by bfloat16 weights reads the weights in bfloat16 and the data as it is
+static bool is_bf16_weights_dot(const shared_ptr<Node>& node)
+{
+    auto dot = dynamic_pointer_cast<op::Dot>(node);
+    return dot && is_f32_single_output(node) && dot->get_input_shape(0).size() == 2 &&
+           dot->get_input_shape(1).size() == 2 && dot->get_reduction_axes_count() == 1 &&
+           !is_bf16_available(dot->get_argument(0)) && is_bf16_available(dot->get_argument(1));
+}
+
+bool runtime::cpu::pass::CPUMixedPrecision::run_on_function(shared_ptr<ngraph::Function> function)
+{
+    bool replaced = false;
+    for (auto n : function->get_ordered_ops())
+    {
+        if (is_bf16_weights_dot(n))
+        {
+            NGRAPH_DEBUG << "Reading the weights of " << n->get_name() << " in bfloat16";
+            replace_node(n,
+                         make_shared<op::DotF16Weights>(
+                             n->get_argument(0), to_bf16(n->get_argument(1)), false));
+            replaced = true;
+            continue;
+        }
+        if (!is_bf16_candidate(n))
+        {
+            continue;
+        }
+
+        NodeVector new_args;
+        for (auto& arg : n->get_arguments())
+        {
+            new_args.push_back(to_bf16(arg));
+        }
+        auto bf16_node = n->copy_with_new_args(new_args);
+        NGRAPH_DEBUG << "Computing " << n->get_name() << " in bfloat16";
+        replace_node(n, make_shared<op::Convert>(bf16_node, element::f32));
+        replaced = true;
+    }
+    return replaced;
+}
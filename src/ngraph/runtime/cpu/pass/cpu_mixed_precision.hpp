@@ -0,0 +1,44 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace pass
+            {
+                /// \brief Automatic mixed precision. Computes 2D f32 Dots in bfloat16 with f32
+                ///        accumulation, and the elementwise ops and Sums that consume them while
+                ///        their inputs are still available in bfloat16. Converts back to f32 where
+                ///        a value leaves the bfloat16 region. Constants are converted ahead of
+                ///        time, rounded to nearest even. f32 activations are never converted: a
+                ///        Dot of f32 data by constant weights becomes DotF16Weights on bfloat16
+                ///        weights, and other ops on f32 activations stay in f32.
+                class CPUMixedPrecision : public ngraph::pass::FunctionPass
+                {
+                public:
+                    bool run_on_function(std::shared_ptr<ngraph::Function> function) override;
+                };
+            }
+        }
+    }
+}
@@ -0,0 +1,65 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/pass/cpu_weight_sharing.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
+#include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
+#include "ngraph/runtime/cpu/cpu_weight_store.hpp"
+#include "ngraph/runtime/cpu/mkldnn_utils.hpp"
+#include "ngraph/runtime/cpu/op/convert_layout.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+bool runtime::cpu::pass::CPUWeightSharing::run_on_function(shared_ptr<ngraph::Function> function)
+{
+    bool replaced = false;
+    for (auto n : function->get_ordered_ops())
+    {
+        auto cvt = dynamic_pointer_cast<runtime::cpu::op::ConvertLayout>(n);
+        if (!cvt)
+        {
+            continue;
+        }
+        auto constant = dynamic_pointer_cast<ngraph::op::Constant>(cvt->get_argument(0));
+        if (!constant)
+        {
+            continue;
+        }
+
+        auto input_md = mkldnn_utils::get_convert_layout_input_md(cvt.get());
+        auto result_md = mkldnn_utils::get_output_mkldnn_md(cvt.get(), 0);
+        auto buffer = CPUWeightStore::get().get_converted(constant, input_md, result_md);
+
+        // The converted constant keeps the shared data alive
+        shared_ptr<void> owner(buffer, buffer->get_ptr());
+        auto converted = make_shared<ngraph::op::Constant>(
+            cvt->get_element_type(), cvt->get_shape(), buffer->get_ptr(), owner);
+        auto tv = converted->get_output_tensor_ptr();
+        auto layout = make_shared<runtime::cpu::LayoutDescriptor>(*tv);
+        layout->set_mkldnn_md(result_md);
+        tv->set_tensor_layout(layout);
+
+        NGRAPH_DEBUG << "Sharing the converted data of " << constant->get_name() << " in "
+                     << result_md.data.format;
+        replace_node(cvt, converted);
+        replaced = true;
+    }
+    return replaced;
+}
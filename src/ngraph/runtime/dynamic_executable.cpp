@@ -0,0 +1,537 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstring>
+#include <sstream>
+#include <unordered_map>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/convert.hpp"
+#include "ngraph/op/divide.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/op/lrn.hpp"
+#include "ngraph/op/not.hpp"
+#include "ngraph/op/parameter.hpp"
+#include "ngraph/op/select.hpp"
+#include "ngraph/op/softmax.hpp"
+#include "ngraph/op/util/arithmetic_reduction.hpp"
+#include "ngraph/op/util/binary_elementwise_arithmetic.hpp"
+#include "ngraph/op/util/binary_elementwise_comparison.hpp"
+#include "ngraph/op/util/binary_elementwise_logical.hpp"
+#include "ngraph/op/util/index_reduction.hpp"
+#include "ngraph/op/util/logical_reduction.hpp"
+#include "ngraph/op/util/unary_elementwise_arithmetic.hpp"
+#include "ngraph/runtime/dynamic_executable.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Copies the leading block two tensors have in common from src into dst and zeroes the rest
+// of dst. Trailing axes of equal extent are contiguous in both tensors, so one row spans them
+// and the innermost axis where the shapes differ; rows go through a single row-sized buffer.
+static void copy_tensor_region(const runtime::Tensor& src, runtime::Tensor& dst)
+{
+    const Shape& src_shape = src.get_shape();
+    const Shape& dst_shape = dst.get_shape();
+    size_t row_axis = src_shape.size();
+    size_t inner_size = 1;
+    while (row_axis > 0 && src_shape[row_axis - 1] == dst_shape[row_axis - 1])
+    {
+        row_axis--;
+        inner_size *= src_shape[row_axis];
+    }
+    if (row_axis == 0)
+    {
+        dst.copy_from(src);
+        return;
+    }
+    if (shape_size(dst_shape) == 0)
+    {
+        return;
+    }
+
+    size_t outer_rank = row_axis - 1;
+    size_t element_size = src.get_element_type().size();
+    size_t src_row_bytes = src_shape[outer_rank] * inner_size * element_size;
+    size_t dst_row_bytes = dst_shape[outer_rank] * inner_size * element_size;
+    size_t copy_bytes = min(src_row_bytes, dst_row_bytes);
+    vector<char> row(dst_row_bytes, 0);
+    bool row_is_zero = true;
+
+    vector<size_t> coordinate(outer_rank, 0);
+    while (true)
+    {
+        bool in_src = true;
+        size_t src_row = 0;
+        size_t dst_row = 0;
+        for (size_t i = 0; i < outer_rank; i++)
+        {
+            in_src = in_src && coordinate[i] < src_shape[i];
+            src_row = src_row * src_shape[i] + coordinate[i];
+            dst_row = dst_row * dst_shape[i] + coordinate[i];
+        }
+        if (in_src)
+        {
+            src.read(row.data(), src_row * src_row_bytes, copy_bytes);
+            memset(row.data() + copy_bytes, 0, dst_row_bytes - copy_bytes);
+            row_is_zero = (copy_bytes == 0);
+        }
+        else if (!row_is_zero)
+        {
+            memset(row.data(), 0, dst_row_bytes);
+            row_is_zero = true;
+        }
+        dst.write(row.data(), dst_row * dst_row_bytes, dst_row_bytes);
+
+        size_t axis = outer_rank;
+        while (axis > 0 && ++coordinate[axis - 1] == dst_shape[axis - 1])
+        {
+            coordinate[axis - 1] = 0;
+            axis--;
+        }
+        if (axis == 0)
+        {
+            break;
+        }
+    }
+}
+
+// Renumbers the axes of a tensor for a tensor with the given axes removed
+static AxisSet remove_axes(const AxisSet& axes, const AxisSet& removed)
+{
+    AxisSet result;
+    for (size_t axis : axes)
+    {
+        size_t removed_before = 0;
+        for (size_t r : removed)
+        {
+            removed_before += (r < axis) ? 1 : 0;
+        }
+        result.insert(axis - removed_before);
+    }
+    return result;
+}
+
+static bool intersects(const AxisSet& a, const AxisSet& b)
+{
+    for (size_t axis : a)
+    {
+        if (b.count(axis) != 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Computes the padded axes of the output of `node` from the padded axes of its arguments.
+// Returns false if padded elements may reach elements of the output that are not padding.
+static bool
+    propagate_padding(const Node& node, const vector<AxisSet>& arg_padding, AxisSet& padding)
+{
+    if (node.get_output_size() != 1)
+    {
+        return false;
+    }
+
+    if (auto softmax = dynamic_cast<const op::Softmax*>(&node))
+    {
+        padding = arg_padding.at(0);
+        return !intersects(padding, softmax->get_axes());
+    }
+    if (dynamic_cast<const op::LRN*>(&node))
+    {
+        return false;
+    }
+    if (auto reduction = dynamic_cast<const op::util::ArithmeticReduction*>(&node))
+    {
+        padding = remove_axes(arg_padding.at(0), reduction->get_reduction_axes());
+        return !intersects(arg_padding.at(0), reduction->get_reduction_axes());
+    }
+    if (auto reduction = dynamic_cast<const op::util::LogicalReduction*>(&node))
+    {
+        padding = remove_axes(arg_padding.at(0), reduction->get_reduction_axes());
+        return !intersects(arg_padding.at(0), reduction->get_reduction_axes());
+    }
+    if (auto reduction = dynamic_cast<const op::util::IndexReduction*>(&node))
+    {
+        AxisSet axis{reduction->get_reduction_axis()};
+        padding = remove_axes(arg_padding.at(0), axis);
+        return !intersects(arg_padding.at(0), axis);
+    }
+    if (auto dot = dynamic_cast<const op::Dot*>(&node))
+    {
+        size_t reduction_count = dot->get_reduction_axes_count();
+        size_t arg0_free = node.get_input_shape(0).size() - reduction_count;
+        for (size_t axis : arg_padding.at(0))
+        {
+            if (axis >= arg0_free)
+            {
+                return false;
+            }
+            padding.insert(axis);
+        }
+        for (size_t axis : arg_padding.at(1))
+        {
+            if (axis < reduction_count)
+            {
+                return false;
+            }
+            padding.insert(arg0_free + axis - reduction_count);
+        }
+        return true;
+    }
+    if (dynamic_cast<const op::Divide*>(&node) && !arg_padding.at(1).empty() &&
+        !node.get_element_type().is_real())
+    {
+        // Integer division by the zero padding traps
+        return false;
+    }
+    if (dynamic_cast<const op::util::UnaryElementwiseArithmetic*>(&node) ||
+        dynamic_cast<const op::util::BinaryElementwiseArithmetic*>(&node) ||
+        dynamic_cast<const op::util::BinaryElementwiseComparison*>(&node) ||
+        dynamic_cast<const op::util::BinaryElementwiseLogical*>(&node) ||
+        dynamic_cast<const op::Convert*>(&node) || dynamic_cast<const op::Not*>(&node) ||
+        dynamic_cast<const op::Select*>(&node) || node.is_output())
+    {
+        for (const AxisSet& axes : arg_padding)
+        {
+            padding.insert(axes.begin(), axes.end());
+        }
+        return true;
+    }
+    return false;
+}
+
+// Whether zero padding along `axis` of `parameter` only reaches padding in the results
+static bool padding_stays_in_bounds(const Function& function, const Node* parameter, size_t axis)
+{
+    unordered_map<const Node*, AxisSet> padding{{parameter, AxisSet{axis}}};
+    for (Node* node : function.get_ordered_ops_raw())
+    {
+        vector<AxisSet> arg_padding;
+        bool padded = false;
+        for (const descriptor::Input& input : node->get_inputs())
+        {
+            auto it = padding.find(input.get_output().get_node().get());
+            arg_padding.push_back(it == padding.end() ? AxisSet{} : it->second);
+            padded = padded || (it != padding.end() && !it->second.empty());
+        }
+        if (!padded)
+        {
+            continue;
+        }
+        AxisSet node_padding;
+        if (!propagate_padding(*node, arg_padding, node_padding))
+        {
+            return false;
+        }
+        padding[node] = node_padding;
+    }
+    return true;
+}
+
+runtime::DynamicExecutable::DynamicExecutable(const shared_ptr<Backend>& backend,
+                                              const shared_ptr<Function>& function,
+                                              size_t cache_capacity,
+                                              const BucketFunction& bucket)
+    : m_backend(backend)
+    , m_function(function)
+    , m_cache_capacity(cache_capacity)
+    , m_bucket(bucket)
+{
+    if (m_cache_capacity == 0)
+    {
+        throw ngraph_error("Dynamic executable needs room for at least one specialization");
+    }
+    set_parameters_and_results(*m_function);
+
+    if (m_bucket)
+    {
+        for (auto& parameter : m_function->get_parameters())
+        {
+            m_bucket_axes.emplace_back();
+            const PartialShape& partial_shape = parameter->get_output_partial_shape(0);
+            if (partial_shape.rank().is_dynamic())
+            {
+                continue;
+            }
+            for (size_t d = 0; d < static_cast<size_t>(partial_shape.rank()); d++)
+            {
+                if (partial_shape[d].is_dynamic() &&
+                    padding_stays_in_bounds(*m_function, parameter.get(), d))
+                {
+                    m_bucket_axes.back().insert(d);
+                }
+            }
+        }
+    }
+}
+
+runtime::DynamicExecutable::~DynamicExecutable()
+{
+    for (Specialization& spec : m_cache)
+    {
+        m_backend->remove_compiled_function(spec.executable);
+    }
+}
+
+size_t runtime::DynamicExecutable::get_compile_count() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_compile_count;
+}
+
+size_t runtime::DynamicExecutable::get_cache_size() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_cache.size();
+}
+
+size_t runtime::DynamicExecutable::round_up_to_power_of_two(size_t dim)
+{
+    size_t bucket = 1;
+    while (bucket < dim)
+    {
+        bucket <<= 1;
+    }
+    return bucket;
+}
+
+shared_ptr<Function>
+    runtime::DynamicExecutable::specialize(const vector<Shape>& input_shapes) const
+{
+    const ParameterVector& parameters = m_function->get_parameters();
+    if (input_shapes.size() != parameters.size())
+    {
+        throw ngraph_error("Specialization needs one shape per parameter");
+    }
+
+    NodeMap node_map;
+    for (size_t i = 0; i < parameters.size(); i++)
+    {
+        auto& parameter = parameters[i];
+        if (!parameter->get_output_partial_shape(0).compatible(input_shapes[i]))
+        {
+            stringstream ss;
+            ss << "Input " << i << " shape {" << join(input_shapes[i])
+               << "} is not compatible with Parameter shape "
+               << parameter->get_output_partial_shape(0);
+            throw ngraph_error(ss.str());
+        }
+        node_map.add(parameter,
+                     make_shared<op::Parameter>(parameter->get_element_type(),
+                                                input_shapes[i],
+                                                parameter->get_cacheable()));
+    }
+    return clone_function(*m_function, node_map);
+}
+
+vector<Shape> runtime::DynamicExecutable::get_output_shapes(const vector<Shape>& input_shapes) const
+{
+    auto specialized = specialize(input_shapes);
+    vector<Shape> output_shapes;
+    for (auto& result : specialized->get_results())
+    {
+        output_shapes.push_back(result->get_shape());
+    }
+    return output_shapes;
+}
+
+vector<Shape> runtime::DynamicExecutable::get_bucket_shapes(const vector<Shape>& input_shapes) const
+{
+    vector<Shape> bucket_shapes = input_shapes;
+    if (!m_bucket)
+    {
+        return bucket_shapes;
+    }
+
+    for (size_t i = 0; i < bucket_shapes.size() && i < m_bucket_axes.size(); i++)
+    {
+        for (size_t d : m_bucket_axes[i])
+        {
+            if (d >= bucket_shapes[i].size())
+            {
+                continue;
+            }
+            size_t bucket = m_bucket(bucket_shapes[i][d]);
+            if (bucket < bucket_shapes[i][d])
+            {
+                throw ngraph_error("Bucket function must not shrink a dimension");
+            }
+            bucket_shapes[i][d] = bucket;
+        }
+    }
+    return bucket_shapes;
+}
+
+runtime::DynamicExecutable::Specialization&
+    runtime::DynamicExecutable::get_specialization(const vector<Shape>& input_shapes)
+{
+    auto bucket_shapes = get_bucket_shapes(input_shapes);
+    auto it = m_cache_index.find(bucket_shapes);
+    if (it != m_cache_index.end())
+    {
+        m_cache.splice(m_cache.begin(), m_cache, it->second);
+        return m_cache.front();
+    }
+
+    Specialization spec;
+    spec.input_shapes = bucket_shapes;
+    spec.executable = m_backend->compile(specialize(bucket_shapes));
+    spec.inputs.resize(bucket_shapes.size());
+    spec.outputs.resize(m_function->get_output_size());
+    for (auto& result : spec.executable->get_results())
+    {
+        spec.output_shapes[bucket_shapes].push_back(result->get_shape());
+    }
+    m_compile_count++;
+    NGRAPH_DEBUG << "Compiled specialization " << m_compile_count << " of "
+                 << m_function->get_name();
+
+    m_cache.push_front(move(spec));
+    m_cache_index[bucket_shapes] = m_cache.begin();
+    if (m_cache.size() > m_cache_capacity)
+    {
+        Specialization& evicted = m_cache.back();
+        m_backend->remove_compiled_function(evicted.executable);
+        m_cache_index.erase(evicted.input_shapes);
+        m_cache.pop_back();
+    }
+    return m_cache.front();
+}
+
+bool runtime::DynamicExecutable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
+                                      const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    vector<Shape> input_shapes;
+    for (auto& input : inputs)
+    {
+        input_shapes.push_back(input->get_shape());
+    }
+    lock_guard<mutex> lock(m_mutex);
+    Specialization& spec = get_specialization(input_shapes);
+
+    // Tensors whose shape differs from the bucket go through bucket-shaped staging tensors
+    vector<shared_ptr<Tensor>> call_inputs;
+    for (size_t i = 0; i < inputs.size(); i++)
+    {
+        if (input_shapes[i] == spec.input_shapes[i])
+        {
+            call_inputs.push_back(inputs[i]);
+            continue;
+        }
+        if (!spec.inputs[i])
+        {
+            spec.inputs[i] =
+                m_backend->create_tensor(inputs[i]->get_element_type(), spec.input_shapes[i]);
+        }
+        copy_tensor_region(*inputs[i], *spec.inputs[i]);
+        call_inputs.push_back(spec.inputs[i]);
+    }
+
+    const ResultVector& results = spec.executable->get_results();
+    vector<shared_ptr<Tensor>> call_outputs;
+    for (size_t i = 0; i < outputs.size(); i++)
+    {
+        if (outputs[i]->get_shape() == results.at(i)->get_shape())
+        {
+            call_outputs.push_back(outputs[i]);
+            continue;
+        }
+        if (!spec.outputs[i])
+        {
+            spec.outputs[i] = m_backend->create_tensor(results[i]->get_element_type(),
+                                                       results[i]->get_shape());
+        }
+        call_outputs.push_back(spec.outputs[i]);
+    }
+
+    bool rc = spec.executable->call(call_outputs, call_inputs);
+
+    for (size_t i = 0; i < outputs.size(); i++)
+    {
+        if (call_outputs[i] != outputs[i])
+        {
+            copy_tensor_region(*call_outputs[i], *outputs[i]);
+        }
+    }
+    return rc;
+}
+
+void runtime::DynamicExecutable::validate(const vector<shared_ptr<runtime::Tensor>>& outputs,
+                                          const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    const ParameterVector& parameters = get_parameters();
+    const ResultVector& results = get_results();
+    if (parameters.size() != inputs.size())
+    {
+        stringstream ss;
+        ss << "Call input count " << inputs.size() << " does not match Function's Parameter count "
+           << parameters.size();
+        throw runtime_error(ss.str());
+    }
+    if (results.size() != outputs.size())
+    {
+        stringstream ss;
+        ss << "Call output count " << outputs.size() << " does not match Function's Result count "
+           << results.size();
+        throw runtime_error(ss.str());
+    }
+
+    vector<Shape> input_shapes;
+    for (size_t i = 0; i < parameters.size(); i++)
+    {
+        if (parameters[i]->get_element_type() != inputs[i]->get_element_type())
+        {
+            stringstream ss;
+            ss << "Input " << i << " type '" << inputs[i]->get_element_type()
+               << "' does not match Parameter type '" << parameters[i]->get_element_type() << "'";
+            throw runtime_error(ss.str());
+        }
+        input_shapes.push_back(inputs[i]->get_shape());
+    }
+
+    // Also rejects input shapes the parameters cannot take. The specialization is compiled
+    // here rather than in the call, and keeps the output shapes so they are inferred once.
+    lock_guard<mutex> lock(m_mutex);
+    Specialization& spec = get_specialization(input_shapes);
+    auto it = spec.output_shapes.find(input_shapes);
+    if (it == spec.output_shapes.end())
+    {
+        it = spec.output_shapes.insert({input_shapes, get_output_shapes(input_shapes)}).first;
+    }
+    const vector<Shape>& output_shapes = it->second;
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        if (results[i]->get_element_type() != outputs[i]->get_element_type())
+        {
+            stringstream ss;
+            ss << "Output " << i << " type '" << outputs[i]->get_element_type()
+               << "' does not match Result type '" << results[i]->get_element_type() << "'";
+            throw runtime_error(ss.str());
+        }
+        if (output_shapes[i] != outputs[i]->get_shape())
+        {
+            stringstream ss;
+            ss << "Output " << i << " shape {" << join(outputs[i]->get_shape())
+               << "} does not match inferred Result shape {" << join(output_shapes[i]) << "}";
+            throw runtime_error(ss.str());
+        }
+    }
+}
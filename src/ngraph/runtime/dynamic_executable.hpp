@@ -0,0 +1,120 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/function.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/executable.hpp"
+#include "ngraph/runtime/tensor.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class DynamicExecutable;
+    }
+}
+
+/// \brief Runs a Function whose parameters have dynamic dimensions on a backend that only
+///        compiles static shapes.
+///
+/// Every call specializes the Function to the shapes of its inputs and compiles the
+/// specialization on the wrapped backend. Compiled specializations are kept in a
+/// least-recently-used cache keyed by input shapes.
+///
+/// With a bucket function, dynamic dimensions are first rounded up to their bucket. Inputs
+/// are zero-padded to the bucket shape and outputs are cut back to the shape of the output
+/// tensors, so one specialization serves all shapes of a bucket. A dynamic dimension is only
+/// bucketed when the padding provably stays out of the valid output elements, i.e. when the
+/// axis only flows through elementwise ops, Dot free axes and reductions or normalizations
+/// over other axes. Dimensions that reach a reduction, Softmax, LRN, integer division or
+/// any other op are compiled exactly, as are all dimensions of parameters of dynamic rank.
+///
+/// Calls are serialized, since specializations share their staging tensors.
+class ngraph::runtime::DynamicExecutable : public Executable
+{
+public:
+    /// Maps a concrete dimension to the (not smaller) dimension to compile for
+    using BucketFunction = std::function<size_t(size_t)>;
+
+    /// \param backend Backend the specializations are compiled on.
+    /// \param function Function with dynamic parameter shapes. It is not modified.
+    /// \param cache_capacity Number of compiled specializations kept alive.
+    /// \param bucket Optional bucketing of dynamic dimensions, see round_up_to_power_of_two.
+    DynamicExecutable(const std::shared_ptr<Backend>& backend,
+                      const std::shared_ptr<Function>& function,
+                      size_t cache_capacity = 16,
+                      const BucketFunction& bucket = nullptr);
+    ~DynamicExecutable() override;
+
+    bool call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+              const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) override;
+
+    void validate(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                  const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) override;
+
+    /// \brief Infers the output shapes for the given input shapes without compiling.
+    std::vector<Shape> get_output_shapes(const std::vector<Shape>& input_shapes) const;
+
+    /// \brief Number of specializations compiled so far, including evicted ones.
+    size_t get_compile_count() const;
+    /// \brief Number of compiled specializations currently cached.
+    size_t get_cache_size() const;
+
+    /// \brief Bucket function giving one specialization per power of two.
+    static size_t round_up_to_power_of_two(size_t dim);
+
+private:
+    struct Specialization
+    {
+        std::vector<Shape> input_shapes;
+        std::shared_ptr<Executable> executable;
+        // Bucket-shaped staging tensors, only used when the call shapes differ
+        std::vector<std::shared_ptr<Tensor>> inputs;
+        std::vector<std::shared_ptr<Tensor>> outputs;
+        // Output shapes inferred for the input shapes of the bucket that were validated
+        std::map<std::vector<Shape>, std::vector<Shape>> output_shapes;
+    };
+
+    std::shared_ptr<Function> specialize(const std::vector<Shape>& input_shapes) const;
+    std::vector<Shape> get_bucket_shapes(const std::vector<Shape>& input_shapes) const;
+    Specialization& get_specialization(const std::vector<Shape>& input_shapes);
+
+    std::shared_ptr<Backend> m_backend;
+    std::shared_ptr<Function> m_function;
+    size_t m_cache_capacity;
+    BucketFunction m_bucket;
+    // Per parameter, the dynamic axes that may be padded to their bucket
+    std::vector<AxisSet> m_bucket_axes;
+    size_t m_compile_count = 0;
+
+    // Guards the cache and the staging tensors of the specializations
+    mutable std::mutex m_mutex;
+
+    // Most recently used first
+    std::list<Specialization> m_cache;
+    std::map<std::vector<Shape>, std::list<Specialization>::iterator> m_cache_index;
+};
@@ -112,6 +112,10 @@ void runtime::Executable::set_parameters_and_results(const Function& func)
     m_results = func.get_results();
 }
 
+void runtime::Executable::warmup(bool lock_memory)
+{
+}
+
 vector<runtime::PerformanceCounter> runtime::Executable::get_performance_data() const
 {
     return vector<PerformanceCounter>();
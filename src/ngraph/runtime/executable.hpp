@@ -51,6 +51,13 @@ public:
     bool call_with_validate(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
                             const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
 
+    /// \brief Does the one-off work of the first call ahead of time, e.g. kernel generation
+    ///     and the first touch of scratch memory, by running the function once on inputs
+    ///     filled with ones. The next call then runs at steady-state latency. Backends without such
+    ///     work do nothing.
+    /// \param lock_memory Also lock the scratch and constant memory of the executable in RAM
+    virtual void warmup(bool lock_memory = false);
+
     /// \brief Collect performance information gathered on a Function.
     /// \returns Vector of PerformanceCounter information.
     virtual std::vector<PerformanceCounter> get_performance_data() const;
@@ -58,8 +65,8 @@ public:
     /// \brief Validates a Function.
     /// \param outputs vector of runtime::Tensor used as outputs
     /// \param inputs vector of runtime::Tensor used as inputs
-    void validate(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
-                  const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
+    virtual void validate(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                          const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
 
     /// \brief Query the input Parameters
     /// \returns an ngraph::op::ParameterVector of all input parameters
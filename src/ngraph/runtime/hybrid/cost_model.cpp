@@ -0,0 +1,148 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <fstream>
+#include <sstream>
+#include <unordered_map>
+
+#include "ngraph/except.hpp"
+#include "ngraph/runtime/hybrid/cost_model.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static size_t get_output_element_count(const Node& node)
+{
+    size_t count = 0;
+    for (size_t i = 0; i < node.get_output_size(); i++)
+    {
+        count += shape_size(node.get_output_shape(i));
+    }
+    return count;
+}
+
+runtime::hybrid::CostModel::CostModel(double default_cost_per_element,
+                                      double transfer_cost_per_byte,
+                                      double call_overhead)
+    : m_default_cost_per_element(default_cost_per_element)
+    , m_transfer_cost_per_byte(transfer_cost_per_byte)
+    , m_call_overhead(call_overhead)
+{
+}
+
+void runtime::hybrid::CostModel::set_op_cost(size_t backend_index,
+                                             const string& op_type,
+                                             double cost_per_element)
+{
+    m_op_costs[make_pair(backend_index, op_type)] = cost_per_element;
+}
+
+void runtime::hybrid::CostModel::record_performance(size_t backend_index,
+                                                    const Function& function,
+                                                    const vector<PerformanceCounter>& counters)
+{
+    unordered_map<string, shared_ptr<Node>> nodes;
+    for (auto& node : function.get_ops())
+    {
+        nodes[node->get_name()] = node;
+    }
+
+    map<string, pair<double, size_t>> totals;
+    for (const PerformanceCounter& counter : counters)
+    {
+        auto it = nodes.find(counter.name());
+        if (it == nodes.end() || counter.call_count() == 0)
+        {
+            continue;
+        }
+        size_t element_count = get_output_element_count(*it->second);
+        if (element_count == 0)
+        {
+            continue;
+        }
+        auto& total = totals[it->second->description()];
+        total.first += static_cast<double>(counter.microseconds()) / element_count;
+        total.second++;
+    }
+    for (auto& total : totals)
+    {
+        set_op_cost(backend_index, total.first, total.second.first / total.second.second);
+    }
+}
+
+void runtime::hybrid::CostModel::load(const string& path)
+{
+    ifstream in(path);
+    if (!in)
+    {
+        throw ngraph_error("Cannot open hybrid cost profile " + path);
+    }
+    string line;
+    size_t line_number = 0;
+    while (getline(in, line))
+    {
+        line_number++;
+        istringstream fields(line);
+        string first;
+        if (!(fields >> first) || first[0] == '#')
+        {
+            continue;
+        }
+
+        bool parsed = false;
+        double value;
+        if (first == "transfer")
+        {
+            parsed = static_cast<bool>(fields >> value);
+            m_transfer_cost_per_byte = value;
+        }
+        else if (first == "overhead")
+        {
+            parsed = static_cast<bool>(fields >> value);
+            m_call_overhead = value;
+        }
+        else
+        {
+            string op_type;
+            parsed = first.find_first_not_of("0123456789") == string::npos &&
+                     static_cast<bool>(fields >> op_type >> value);
+            if (parsed)
+            {
+                set_op_cost(stoul(first), op_type, value);
+            }
+        }
+        if (!parsed)
+        {
+            throw ngraph_error("Malformed hybrid cost profile entry at " + path + ":" +
+                               to_string(line_number));
+        }
+    }
+}
+
+double runtime::hybrid::CostModel::get_op_cost(const Node& node, size_t backend_index) const
+{
+    if (node.is_parameter() || node.is_constant())
+    {
+        return 0;
+    }
+    double cost_per_element = m_default_cost_per_element;
+    auto it = m_op_costs.find(make_pair(backend_index, node.description()));
+    if (it != m_op_costs.end())
+    {
+        cost_per_element = it->second;
+    }
+    return cost_per_element * get_output_element_count(node);
+}
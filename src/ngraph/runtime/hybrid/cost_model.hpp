@@ -0,0 +1,79 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ngraph/function.hpp"
+#include "ngraph/node.hpp"
+#include "ngraph/runtime/performance_counter.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace hybrid
+        {
+            class CostModel;
+        }
+    }
+}
+
+/// \brief Cost estimates the hybrid backend partitions a function with.
+///
+/// Op costs are kept per backend index and op type, in arbitrary units per output element.
+/// They can be set directly, recorded from the performance counters of a profiling run or
+/// loaded from a profile file. Ops without an entry cost the default per element.
+class ngraph::runtime::hybrid::CostModel
+{
+public:
+    CostModel(double default_cost_per_element = 1.0,
+              double transfer_cost_per_byte = 0.0,
+              double call_overhead = 0.0);
+
+    void set_op_cost(size_t backend_index, const std::string& op_type, double cost_per_element);
+
+    /// \brief Cost of moving one byte between two backends.
+    void set_transfer_cost(double cost_per_byte) { m_transfer_cost_per_byte = cost_per_byte; }
+    /// \brief Fixed cost of each subgraph handed to a non-default backend.
+    void set_call_overhead(double cost) { m_call_overhead = cost; }
+
+    /// \brief Averages per-element op costs out of a profiling run of `function` on a backend.
+    /// \param counters Performance data of the executable compiled from `function`, keyed by
+    ///        node name.
+    void record_performance(size_t backend_index,
+                            const Function& function,
+                            const std::vector<PerformanceCounter>& counters);
+
+    /// \brief Reads a profile with one entry per line: `transfer <cost per byte>`,
+    ///        `overhead <cost per call>` or `<backend index> <op type> <cost per element>`.
+    ///        Empty lines and lines starting with '#' are skipped.
+    void load(const std::string& path);
+
+    double get_op_cost(const Node& node, size_t backend_index) const;
+    double get_transfer_cost(size_t bytes) const { return bytes * m_transfer_cost_per_byte; }
+    double get_call_overhead() const { return m_call_overhead; }
+
+private:
+    double m_default_cost_per_element;
+    double m_transfer_cost_per_byte;
+    double m_call_overhead;
+    std::map<std::pair<size_t, std::string>, double> m_op_costs;
+};
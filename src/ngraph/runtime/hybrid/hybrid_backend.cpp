@@ -59,7 +59,7 @@ shared_ptr<runtime::Executable>
                                             bool enable_performance_collection)
 {
     return make_shared<HybridExecutable>(
-        m_backend_list, func, enable_performance_collection, m_debug_enabled);
+        m_backend_list, func, enable_performance_collection, m_debug_enabled, m_cost_model);
 }
 
 bool runtime::hybrid::HybridBackend::is_supported(const Node& node) const
@@ -22,6 +22,7 @@
 #include <vector>
 
 #include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/hybrid/cost_model.hpp"
 
 namespace ngraph
 {
@@ -54,7 +55,11 @@ public:
     bool is_supported(const ngraph::Node& node) const override;
 
     void set_debug_enabled(bool flag) { m_debug_enabled = flag; }
+    /// \brief Partition compiled functions by estimated cost instead of placing every node
+    ///        on the first backend that supports it.
+    void set_cost_model(const std::shared_ptr<CostModel>& cost_model) { m_cost_model = cost_model; }
 private:
     std::vector<std::shared_ptr<runtime::Backend>> m_backend_list;
     bool m_debug_enabled = false;
+    std::shared_ptr<CostModel> m_cost_model;
 };
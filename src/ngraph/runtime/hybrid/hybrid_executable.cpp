@@ -21,6 +21,7 @@
 #include "ngraph/runtime/host_tensor.hpp"
 #include "ngraph/runtime/hybrid/hybrid_backend.hpp"
 #include "ngraph/runtime/hybrid/hybrid_util.hpp"
+#include "ngraph/runtime/hybrid/pass/cost_based_placement.hpp"
 #include "ngraph/runtime/hybrid/pass/default_placement.hpp"
 #include "ngraph/runtime/hybrid/pass/dump.hpp"
 #include "ngraph/runtime/hybrid/pass/fix_get_output_element.hpp"
@@ -35,14 +36,23 @@ runtime::hybrid::HybridExecutable::HybridExecutable(
     const std::vector<std::shared_ptr<runtime::Backend>>& backend_list,
     const shared_ptr<Function>& func,
     bool enable_performance_collection,
-    bool debug_enabled)
+    bool debug_enabled,
+    const shared_ptr<CostModel>& cost_model)
     : m_function{func}
     , m_backend_list{backend_list}
     , m_debug_enabled{debug_enabled}
 {
     // Run placement pass
     ngraph::pass::Manager pass_manager;
-    pass_manager.register_pass<runtime::hybrid::pass::DefaultPlacement>(m_backend_list);
+    if (cost_model)
+    {
+        pass_manager.register_pass<runtime::hybrid::pass::CostBasedPlacement>(m_backend_list,
+                                                                              cost_model);
+    }
+    else
+    {
+        pass_manager.register_pass<runtime::hybrid::pass::DefaultPlacement>(m_backend_list);
+    }
     pass_manager.register_pass<runtime::hybrid::pass::FixGetOutputElement>();
     pass_manager.register_pass<runtime::hybrid::pass::Liveness>();
     pass_manager.register_pass<runtime::hybrid::pass::Dump>("graph.dump");
@@ -56,99 +66,91 @@ runtime::hybrid::HybridExecutable::HybridExecutable(
     runtime::hybrid::rewrite_function(m_function, m_backend_list);
     m_executable = backend_list[0]->compile(m_function);
 
+    // The transfer plan for the function's boundary is fixed from here on
+    m_backend = m_backend_list.at(m_function->get_placement());
+    m_memory_attach = m_backend->is_supported_property(runtime::Backend::Property::memory_attach);
+    m_parameter_transfers.resize(m_function->get_parameters().size());
+    m_result_transfers.resize(m_function->get_results().size());
+
     set_parameters_and_results(*func);
 }
 
-bool runtime::hybrid::HybridExecutable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
-                                             const vector<shared_ptr<runtime::Tensor>>& inputs)
+shared_ptr<runtime::Tensor>
+    runtime::hybrid::HybridExecutable::get_transfer_tensor(Transfer& transfer,
+                                                           const shared_ptr<runtime::Tensor>& t,
+                                                           const Node& node,
+                                                           bool& needs_copy)
 {
-    bool rc = true;
-
-    using node_map_t = unordered_map<shared_ptr<Node>, shared_ptr<runtime::Tensor>>;
+    needs_copy = false;
+    if (t->get_parent() == m_backend.get())
+    {
+        return t;
+    }
 
-    // Parameter and result node in m_function maps to one Tensor
-    node_map_t map_node_to_tensor;
-    for (size_t i = 0; i < inputs.size(); ++i)
+    // Host memory from another backend is used in place when the placement backend can
+    // attach it; anything else goes through a staging tensor
+    auto host_tensor = dynamic_pointer_cast<runtime::HostTensor>(t);
+    if (m_memory_attach && host_tensor)
     {
-        map_node_to_tensor[m_function->get_parameters()[i]] = inputs[i];
+        if (!transfer.attached || transfer.attached_to.lock() != t)
+        {
+            transfer.tensor = m_backend->create_tensor(
+                node.get_element_type(), node.get_shape(), host_tensor->get_data_ptr());
+            transfer.attached = true;
+            transfer.attached_to = t;
+        }
+        return transfer.tensor;
     }
-    for (size_t i = 0; i < outputs.size(); ++i)
+    // An attached tensor may point at memory its caller tensor already freed
+    if (!transfer.tensor || transfer.attached)
     {
-        map_node_to_tensor[m_function->get_results()[i]] = outputs[i];
+        transfer.tensor = m_backend->create_tensor(node.get_element_type(), node.get_shape());
+        transfer.attached = false;
+        transfer.attached_to.reset();
     }
+    needs_copy = true;
+    return transfer.tensor;
+}
 
-    // Init backend
-    size_t placement = m_function->get_placement();
-    auto backend = m_backend_list[placement];
+bool runtime::hybrid::HybridExecutable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
+                                             const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    bool rc = true;
 
-    // Prepare parameter Tensors
+    const ParameterVector& parameter_nodes = m_function->get_parameters();
     vector<shared_ptr<runtime::Tensor>> parameters;
-    for (const shared_ptr<op::Parameter>& parameter_node : m_function->get_parameters())
+    for (size_t i = 0; i < inputs.size(); ++i)
     {
-        auto it = map_node_to_tensor.find(parameter_node);
-        if (it != map_node_to_tensor.end())
-        {
-            if (it->second->get_parent() == backend.get())
-            {
-                parameters.push_back(it->second);
-            }
-            else
-            {
-                auto parameter = backend->create_tensor(parameter_node->get_element_type(),
-                                                        parameter_node->get_shape());
-                parameter->copy_from(*(it->second));
-                parameters.push_back(parameter);
-            }
-        }
-        else
+        bool needs_copy;
+        auto parameter = get_transfer_tensor(
+            m_parameter_transfers.at(i), inputs[i], *parameter_nodes.at(i), needs_copy);
+        if (needs_copy)
         {
-            // Handle temporary tensors that go between subgraphs
-            auto result_node = m_map_parameter_to_result.at(parameter_node);
-            auto result = map_node_to_tensor.at(result_node);
-            auto parameter = backend->create_tensor(parameter_node->get_element_type(),
-                                                    parameter_node->get_shape());
-            parameter->copy_from(*result);
-            map_node_to_tensor[parameter_node] = parameter;
-            parameters.push_back(parameter);
+            parameter->copy_from(*inputs[i]);
         }
+        parameters.push_back(parameter);
     }
 
-    // Prepare result Tensors
+    const ResultVector& result_nodes = m_function->get_results();
     vector<shared_ptr<runtime::Tensor>> results;
-    map<runtime::Tensor*, runtime::Tensor*> copy_back;
-    for (const shared_ptr<op::Result>& result_node : m_function->get_results())
+    vector<size_t> copy_back;
+    for (size_t i = 0; i < outputs.size(); ++i)
     {
-        auto it = map_node_to_tensor.find(result_node);
-        if (it != map_node_to_tensor.end())
-        {
-            if (it->second->get_parent() == backend.get())
-            {
-                results.push_back(it->second);
-            }
-            else
-            {
-                auto result = backend->create_tensor(result_node->get_element_type(),
-                                                     result_node->get_shape());
-                results.push_back(result);
-                copy_back.insert({result.get(), it->second.get()});
-            }
-        }
-        else
+        bool needs_copy;
+        results.push_back(get_transfer_tensor(
+            m_result_transfers.at(i), outputs[i], *result_nodes.at(i), needs_copy));
+        if (needs_copy)
         {
-            // Handle temporary tensors that go between subgraphs
-            auto result =
-                backend->create_tensor(result_node->get_element_type(), result_node->get_shape());
-            map_node_to_tensor[result_node] = result;
-            results.push_back(result);
+            copy_back.push_back(i);
         }
     }
 
     m_executable->call(results, parameters);
 
     // Need to copy any results to the correct device
-    for (const auto& p : copy_back)
+    for (size_t i : copy_back)
     {
-        p.second->copy_from(*p.first);
+        outputs[i]->copy_from(*results[i]);
     }
 
     return rc;
@@ -22,6 +22,7 @@
 #include <vector>
 
 #include "ngraph/runtime/executable.hpp"
+#include "ngraph/runtime/hybrid/cost_model.hpp"
 
 namespace ngraph
 {
@@ -40,19 +41,38 @@ public:
     HybridExecutable(const std::vector<std::shared_ptr<runtime::Backend>>& backend_list,
                      const std::shared_ptr<Function>& func,
                      bool enable_performance_collection = false,
-                     bool debug_enabled = false);
+                     bool debug_enabled = false,
+                     const std::shared_ptr<CostModel>& cost_model = nullptr);
 
     bool call(const std::vector<std::shared_ptr<ngraph::runtime::Tensor>>& outputs,
               const std::vector<std::shared_ptr<ngraph::runtime::Tensor>>& inputs) override;
 
 private:
+    // How a caller tensor of one Parameter or Result reaches the placement backend. Built on
+    // the first call that needs it and reused while the caller passes the same tensor.
+    struct Transfer
+    {
+        // Whether `tensor` is attached to the memory of `attached_to` rather than staging
+        bool attached = false;
+        std::weak_ptr<runtime::Tensor> attached_to;
+        std::shared_ptr<runtime::Tensor> tensor;
+    };
+
+    std::shared_ptr<runtime::Tensor> get_transfer_tensor(Transfer& transfer,
+                                                         const std::shared_ptr<runtime::Tensor>& t,
+                                                         const Node& node,
+                                                         bool& needs_copy);
+
     std::shared_ptr<ngraph::Function> m_function;
     std::shared_ptr<Executable> m_executable;
-    std::unordered_map<std::shared_ptr<ngraph::op::Parameter>, std::shared_ptr<ngraph::op::Result>>
-        m_map_parameter_to_result;
 
     std::vector<std::shared_ptr<runtime::Backend>> m_backend_list;
+    std::shared_ptr<runtime::Backend> m_backend;
+    bool m_memory_attach = false;
     bool m_debug_enabled = false;
 
+    std::vector<Transfer> m_parameter_transfers;
+    std::vector<Transfer> m_result_transfers;
+
     size_t get_placement(const runtime::Tensor* t);
 };
@@ -49,8 +49,8 @@ static Node* take_independent_node_with_placement_priority(
     return selected_node;
 }
 
-static vector<unordered_set<shared_ptr<Node>>>
-    group_function_nodes_to_clusters(const shared_ptr<Function>& f)
+vector<unordered_set<shared_ptr<Node>>>
+    runtime::hybrid::group_function_nodes_to_clusters(const shared_ptr<Function>& f)
 {
     // Topologically sort nodes by picking independent node with the same placement as the
     // previously picked node greedily
@@ -152,7 +152,7 @@ void runtime::hybrid::rewrite_function(const shared_ptr<Function>& f,
                                        const vector<shared_ptr<runtime::Backend>>& backend_list)
 {
     // Split functions to clusters of nodes that can be computed together
-    vector<unordered_set<shared_ptr<Node>>> clusters = ::group_function_nodes_to_clusters(f);
+    vector<unordered_set<shared_ptr<Node>>> clusters = group_function_nodes_to_clusters(f);
 
     // unordered_map<shared_ptr<op::Parameter>, shared_ptr<op::Result>> map_parameter_to_result;
     unordered_map<shared_ptr<Node>, unordered_set<shared_ptr<Node>>*> map_node_to_cluster;
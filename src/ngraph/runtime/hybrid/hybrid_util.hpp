@@ -18,6 +18,7 @@
 
 #include <memory>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "ngraph/function.hpp"
@@ -30,6 +31,12 @@ namespace ngraph
     {
         namespace hybrid
         {
+            /// \brief Splits a placed function into the node clusters rewrite_function turns
+            ///        into FunctionCalls. Cluster 0 holds every node placed on backend 0, the
+            ///        others are runs of nodes with the same placement in topological order.
+            std::vector<std::unordered_set<std::shared_ptr<Node>>>
+                group_function_nodes_to_clusters(const std::shared_ptr<Function>& f);
+
             void rewrite_function(
                 const std::shared_ptr<Function>& f,
                 const std::vector<std::shared_ptr<runtime::Backend>>& backend_list);
@@ -29,6 +29,9 @@ runtime::hybrid::op::FunctionCall::FunctionCall(const NodeVector& outputs,
     , m_function{function}
     , m_backend{backend}
     , m_executable{backend->compile(function)}
+    , m_memory_attach{backend->is_supported_property(Backend::Property::memory_attach)}
+    , m_input_tensors(inputs.size())
+    , m_output_tensors(outputs.size())
 {
     set_output_size(outputs.size());
     for (size_t i = 0; i < outputs.size(); i++)
@@ -57,3 +60,50 @@ shared_ptr<Function> runtime::hybrid::op::FunctionCall::get_function() const
 {
     return m_function;
 }
+
+const shared_ptr<runtime::Tensor>&
+    runtime::hybrid::op::FunctionCall::get_boundary_tensor(BoundaryTensor& boundary,
+                                                           HostTensor& host) const
+{
+    void* host_ptr = m_memory_attach ? host.get_data_ptr() : nullptr;
+    if (!boundary.tensor || boundary.host_ptr != host_ptr)
+    {
+        boundary.tensor =
+            m_memory_attach
+                ? m_backend->create_tensor(host.get_element_type(), host.get_shape(), host_ptr)
+                : m_backend->create_tensor(host.get_element_type(), host.get_shape());
+        boundary.host_ptr = host_ptr;
+    }
+    return boundary.tensor;
+}
+
+void runtime::hybrid::op::FunctionCall::call(const vector<shared_ptr<HostTensor>>& outputs,
+                                             const vector<shared_ptr<HostTensor>>& inputs) const
+{
+    vector<shared_ptr<Tensor>> backend_outputs;
+    vector<shared_ptr<Tensor>> backend_inputs;
+    for (size_t i = 0; i < inputs.size(); i++)
+    {
+        auto& tensor = get_boundary_tensor(m_input_tensors.at(i), *inputs[i]);
+        if (!m_memory_attach)
+        {
+            tensor->write(inputs[i]->get_data_ptr(), 0, inputs[i]->get_size_in_bytes());
+        }
+        backend_inputs.push_back(tensor);
+    }
+    for (size_t i = 0; i < outputs.size(); i++)
+    {
+        backend_outputs.push_back(get_boundary_tensor(m_output_tensors.at(i), *outputs[i]));
+    }
+
+    m_executable->call(backend_outputs, backend_inputs);
+
+    if (!m_memory_attach)
+    {
+        for (size_t i = 0; i < outputs.size(); i++)
+        {
+            backend_outputs[i]->read(
+                outputs[i]->get_data_ptr(), 0, outputs[i]->get_size_in_bytes());
+        }
+    }
+}
@@ -16,8 +16,12 @@
 
 #pragma once
 
+#include <memory>
+#include <vector>
+
 #include "ngraph/op/op.hpp"
 #include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/host_tensor.hpp"
 
 namespace ngraph
 {
@@ -45,11 +49,30 @@ public:
     std::shared_ptr<Executable> get_executable() const;
     std::shared_ptr<Function> get_function() const;
 
+    /// \brief Runs the function on its backend with host-resident arguments and results.
+    ///
+    /// Backends that can attach memory work on the host buffers directly. Other backends get
+    /// the data copied through tensors allocated on the first call and reused afterwards.
+    void call(const std::vector<std::shared_ptr<HostTensor>>& outputs,
+              const std::vector<std::shared_ptr<HostTensor>>& inputs) const;
+
 private:
     std::shared_ptr<Node> copy_with_new_args(const NodeVector& new_args) const override;
 
+    struct BoundaryTensor
+    {
+        // Host buffer `tensor` is attached to, null for a staging tensor
+        void* host_ptr = nullptr;
+        std::shared_ptr<Tensor> tensor;
+    };
+    const std::shared_ptr<Tensor>& get_boundary_tensor(BoundaryTensor& boundary,
+                                                       HostTensor& host) const;
+
     const NodeVector m_function_outputs;
     std::shared_ptr<Function> m_function;
     std::shared_ptr<Backend> m_backend;
     std::shared_ptr<Executable> m_executable;
+    bool m_memory_attach;
+    mutable std::vector<BoundaryTensor> m_input_tensors;
+    mutable std::vector<BoundaryTensor> m_output_tensors;
 };
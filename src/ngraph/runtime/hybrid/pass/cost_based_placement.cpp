@@ -0,0 +1,351 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <limits>
+#include <sstream>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "ngraph/except.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/node.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/hybrid/hybrid_util.hpp"
+#include "ngraph/runtime/hybrid/pass/cost_based_placement.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+namespace
+{
+    // A tensor exchanged with another node
+    struct Edge
+    {
+        Node* neighbour;
+        size_t bytes;
+    };
+}
+
+// GetOutputElements are not placed on their own, they follow their multi-output argument
+static bool is_follower(const Node* node)
+{
+    return node->description() == "GetOutputElement";
+}
+
+static Node* get_leader(Node* node)
+{
+    while (is_follower(node))
+    {
+        node = node->get_arguments().at(0).get();
+    }
+    return node;
+}
+
+static void set_placement(Node* node, size_t placement)
+{
+    node->set_placement_index(placement);
+    for (auto& user : node->get_users())
+    {
+        if (is_follower(user.get()))
+        {
+            set_placement(user.get(), placement);
+        }
+    }
+}
+
+static void add_output_edges(Node* node, vector<Edge>& edges)
+{
+    for (descriptor::Output& output : node->get_outputs())
+    {
+        for (descriptor::Input* input : output.get_inputs())
+        {
+            Node* user = input->get_raw_pointer_node();
+            if (is_follower(user))
+            {
+                add_output_edges(user, edges);
+            }
+            else
+            {
+                edges.push_back(Edge{user, output.get_tensor().size()});
+            }
+        }
+    }
+}
+
+// Every edge is listed on both of its nodes
+static vector<Edge> get_edges(Node* node)
+{
+    vector<Edge> edges;
+    for (descriptor::Input& input : node->get_inputs())
+    {
+        edges.push_back(
+            Edge{get_leader(input.get_output().get_node().get()), input.get_tensor().size()});
+    }
+    add_output_edges(node, edges);
+    return edges;
+}
+
+runtime::hybrid::pass::CostBasedPlacement::CostBasedPlacement(
+    const vector<shared_ptr<runtime::Backend>>& placement_backends,
+    const shared_ptr<CostModel>& cost_model)
+    : m_placement_backends(placement_backends)
+    , m_cost_model(cost_model)
+{
+}
+
+bool runtime::hybrid::pass::CostBasedPlacement::run_on_function(shared_ptr<Function> function)
+{
+    const CostModel& costs = *m_cost_model;
+
+    vector<Node*> nodes;
+    unordered_map<Node*, vector<size_t>> candidates;
+    unordered_map<Node*, vector<Edge>> edges;
+    for (auto& node : function->get_ordered_ops())
+    {
+        node->set_placement_index(Node::placement_invalid);
+        if (is_follower(node.get()))
+        {
+            continue;
+        }
+        nodes.push_back(node.get());
+        edges[node.get()] = get_edges(node.get());
+
+        vector<size_t>& node_candidates = candidates[node.get()];
+        if (node->is_parameter() || node->is_output())
+        {
+            // The function boundary stays on backend 0
+            node_candidates.push_back(0);
+            continue;
+        }
+        for (size_t i = 0; i < m_placement_backends.size(); i++)
+        {
+            if (m_placement_backends[i]->is_supported(*node))
+            {
+                node_candidates.push_back(i);
+            }
+        }
+        if (node_candidates.empty())
+        {
+            throw ngraph_error("Node " + node->get_name() + " not supported by any backend");
+        }
+    }
+
+    // Op cost on `placement` plus the transfers to neighbours already placed elsewhere
+    auto local_cost = [&](Node* node, size_t placement) {
+        double cost = costs.get_op_cost(*node, placement);
+        for (const Edge& edge : edges.at(node))
+        {
+            size_t other = edge.neighbour->get_placement_index();
+            if (other != Node::placement_invalid && other != placement)
+            {
+                cost += costs.get_transfer_cost(edge.bytes);
+            }
+        }
+        return cost;
+    };
+
+    // rewrite_function only cuts edges between backend 0 and one other backend
+    auto is_legal = [&](Node* node, size_t placement) {
+        if (placement == 0)
+        {
+            return true;
+        }
+        for (const Edge& edge : edges.at(node))
+        {
+            size_t other = edge.neighbour->get_placement_index();
+            if (other != Node::placement_invalid && other != 0 && other != placement)
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    // Initial placement on the cheapest backend given the arguments' placements
+    for (Node* node : nodes)
+    {
+        const vector<size_t>& node_candidates = candidates.at(node);
+        size_t best_placement = node_candidates.front();
+        double best_cost = numeric_limits<double>::max();
+        for (size_t placement : node_candidates)
+        {
+            double cost = local_cost(node, placement);
+            if (is_legal(node, placement) && cost < best_cost)
+            {
+                best_placement = placement;
+                best_cost = cost;
+            }
+        }
+        set_placement(node, best_placement);
+    }
+
+    // Move single nodes while that lowers the estimate. Every move lowers the total cost, so
+    // this terminates.
+    bool changed = true;
+    while (changed)
+    {
+        changed = false;
+        for (Node* node : nodes)
+        {
+            size_t best_placement = node->get_placement_index();
+            double best_cost = local_cost(node, best_placement);
+            for (size_t placement : candidates.at(node))
+            {
+                if (placement != best_placement && is_legal(node, placement))
+                {
+                    double cost = local_cost(node, placement);
+                    if (cost < best_cost)
+                    {
+                        best_placement = placement;
+                        best_cost = cost;
+                    }
+                }
+            }
+            if (best_placement != node->get_placement_index())
+            {
+                set_placement(node, best_placement);
+                changed = true;
+            }
+        }
+    }
+
+    // Single moves do not see the call overhead, so move connected subgraphs back to
+    // backend 0 when their savings do not pay for it
+    unordered_set<Node*> visited;
+    for (Node* node : nodes)
+    {
+        size_t placement = node->get_placement_index();
+        if (placement == 0 || !visited.insert(node).second)
+        {
+            continue;
+        }
+        vector<Node*> component{node};
+        for (size_t i = 0; i < component.size(); i++)
+        {
+            for (const Edge& edge : edges.at(component[i]))
+            {
+                if (edge.neighbour->get_placement_index() == placement &&
+                    visited.insert(edge.neighbour).second)
+                {
+                    component.push_back(edge.neighbour);
+                }
+            }
+        }
+
+        unordered_set<Node*> members(component.begin(), component.end());
+        bool supported = true;
+        double cost = costs.get_call_overhead();
+        double cost_on_default = 0;
+        for (Node* member : component)
+        {
+            supported = supported && candidates.at(member).front() == 0;
+            cost += costs.get_op_cost(*member, placement);
+            cost_on_default += costs.get_op_cost(*member, 0);
+            for (const Edge& edge : edges.at(member))
+            {
+                if (members.count(edge.neighbour) == 0)
+                {
+                    size_t other = edge.neighbour->get_placement_index();
+                    cost += other != placement ? costs.get_transfer_cost(edge.bytes) : 0;
+                    cost_on_default += other != 0 ? costs.get_transfer_cost(edge.bytes) : 0;
+                }
+            }
+        }
+        if (supported && cost_on_default <= cost)
+        {
+            for (Node* member : component)
+            {
+                set_placement(member, 0);
+            }
+        }
+    }
+
+    // A subgraph may still be split into clusters that exchange data with each other, e.g.
+    // when a path through backend 0 leaves and re-enters it. Such clusters fall back to
+    // backend 0 until every cluster only exchanges data with backend 0.
+    vector<unordered_set<shared_ptr<Node>>> clusters;
+    bool legal = false;
+    while (!legal)
+    {
+        legal = true;
+        clusters = group_function_nodes_to_clusters(function);
+        unordered_map<Node*, size_t> cluster_index;
+        for (size_t i = 0; i < clusters.size(); i++)
+        {
+            for (auto& node : clusters[i])
+            {
+                cluster_index[node.get()] = i;
+            }
+        }
+        for (size_t i = 1; i < clusters.size() && legal; i++)
+        {
+            for (auto& node : clusters[i])
+            {
+                NodeVector neighbours = node->get_arguments();
+                for (auto& user : node->get_users())
+                {
+                    neighbours.push_back(user);
+                }
+                for (auto& neighbour : neighbours)
+                {
+                    if (neighbour->get_placement_index() != 0 &&
+                        cluster_index.at(neighbour.get()) != i)
+                    {
+                        legal = false;
+                    }
+                }
+            }
+            if (!legal)
+            {
+                for (auto& node : clusters[i])
+                {
+                    Node* leader = get_leader(node.get());
+                    if (candidates.at(leader).front() != 0)
+                    {
+                        throw ngraph_error("Node " + leader->get_name() +
+                                           " needs backend 0 to keep its subgraph convex");
+                    }
+                    set_placement(leader, 0);
+                }
+            }
+        }
+    }
+
+    vector<size_t> node_counts(m_placement_backends.size(), 0);
+    double total_cost = costs.get_call_overhead() * (clusters.size() - 1);
+    for (Node* node : nodes)
+    {
+        size_t placement = node->get_placement_index();
+        node_counts.at(placement)++;
+        total_cost += costs.get_op_cost(*node, placement);
+        for (const Edge& edge : edges.at(node))
+        {
+            if (edge.neighbour->get_placement_index() != placement)
+            {
+                total_cost += costs.get_transfer_cost(edge.bytes) / 2;
+            }
+        }
+    }
+    stringstream ss;
+    for (size_t i = 0; i < node_counts.size(); i++)
+    {
+        ss << (i == 0 ? "" : ", ") << node_counts[i] << " on backend " << i;
+    }
+    NGRAPH_DEBUG << "Placed " << function->get_name() << ": " << ss.str() << ", "
+                 << clusters.size() - 1 << " subgraphs, estimated cost " << total_cost;
+
+    return false;
+}
@@ -0,0 +1,57 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "ngraph/pass/pass.hpp"
+#include "ngraph/runtime/hybrid/cost_model.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace hybrid
+        {
+            namespace pass
+            {
+                class CostBasedPlacement;
+            }
+        }
+    }
+}
+
+/// \brief Places every node on the backend that minimizes the estimated cost of the function.
+///
+/// The estimate adds the op costs on their backends, one transfer per tensor edge crossing
+/// backends and the call overhead of every subgraph leaving backend 0. Nodes start on their
+/// cheapest backend in topological order, then single nodes and whole subgraphs move while
+/// that lowers the estimate. Backend 0 must support every node that cannot run elsewhere.
+class ngraph::runtime::hybrid::pass::CostBasedPlacement : public ngraph::pass::FunctionPass
+{
+public:
+    CostBasedPlacement(
+        const std::vector<std::shared_ptr<ngraph::runtime::Backend>>& placement_backends,
+        const std::shared_ptr<CostModel>& cost_model);
+
+    bool run_on_function(std::shared_ptr<Function> function) override;
+
+private:
+    std::vector<std::shared_ptr<ngraph::runtime::Backend>> m_placement_backends;
+    std::shared_ptr<CostModel> m_cost_model;
+};
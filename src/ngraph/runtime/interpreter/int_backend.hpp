@@ -58,6 +58,7 @@ public:
                                         bool enable_performance_data = false) override;
 
     bool is_supported(const Node& node) const override;
+    bool is_supported_property(const Property prop) const override;
 
 private:
     std::set<std::string> m_unsupported_op_name_list;
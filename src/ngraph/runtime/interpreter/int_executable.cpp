@@ -14,9 +14,12 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <cstring>
+
 #include "ngraph/runtime/interpreter/int_executable.hpp"
 #include "ngraph/descriptor/layout/dense_tensor_layout.hpp"
 #include "ngraph/except.hpp"
+#include "ngraph/op/constant.hpp"
 #include "ngraph/op/convert.hpp"
 #include "ngraph/op/select.hpp"
 #include "ngraph/op/util/binary_elementwise_comparison.hpp"
@@ -168,7 +171,14 @@ bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::
         {
             m_timer_map[op].start();
         }
-        generate_calls(type, wrapped, op_outputs, op_inputs);
+        if (type == element::f16 || has_f16_tensor(op_inputs) || has_f16_tensor(op_outputs))
+        {
+            generate_f16_calls(type, wrapped, op_outputs, op_inputs);
+        }
+        else
+        {
+            generate_calls(type, wrapped, op_outputs, op_inputs);
+        }
         if (m_performance_counters_enabled)
         {
             m_timer_map[op].stop();
@@ -204,11 +214,84 @@ void runtime::interpreter::INTExecutable::generate_calls(const element::Type& ty
     case element::Type_t::undefined:
     case element::Type_t::dynamic:
     case element::Type_t::bf16:
+    case element::Type_t::f16:
         ss << "unsupported element type " << type << " op " << op.get_node().get_name();
         throw ngraph_error(ss.str());
     }
 }
 
+bool runtime::interpreter::INTExecutable::has_f16_tensor(
+    const vector<shared_ptr<HostTensor>>& tensors)
+{
+    for (const shared_ptr<HostTensor>& tensor : tensors)
+    {
+        if (tensor->get_element_type() == element::f16)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void runtime::interpreter::INTExecutable::generate_f16_calls(
+    const element::Type& type,
+    const NodeWrapper& op,
+    const vector<shared_ptr<HostTensor>>& out,
+    const vector<shared_ptr<HostTensor>>& in)
+{
+    // The data of a float16 constant is already what its output holds
+    if (op.get_typeid() == OP_TYPEID::Constant)
+    {
+        const op::Constant* c = static_cast<const op::Constant*>(&op.get_node());
+        memcpy(out[0]->get_data_ptr(),
+               c->get_data_ptr(),
+               shape_size(c->get_shape()) * c->get_element_type().size());
+        return;
+    }
+
+    vector<shared_ptr<HostTensor>> f32_in;
+    for (const shared_ptr<HostTensor>& tensor : in)
+    {
+        if (tensor->get_element_type() != element::f16)
+        {
+            f32_in.push_back(tensor);
+            continue;
+        }
+        auto f32_tensor = make_shared<HostTensor>(element::f32, tensor->get_shape());
+        const float16* source = tensor->get_data_ptr<float16>();
+        float* target = f32_tensor->get_data_ptr<float>();
+        for (size_t i = 0; i < tensor->get_element_count(); i++)
+        {
+            target[i] = source[i];
+        }
+        f32_in.push_back(f32_tensor);
+    }
+
+    vector<shared_ptr<HostTensor>> f32_out;
+    for (const shared_ptr<HostTensor>& tensor : out)
+    {
+        f32_out.push_back(tensor->get_element_type() == element::f16
+                              ? make_shared<HostTensor>(element::f32, tensor->get_shape())
+                              : tensor);
+    }
+
+    generate_calls(type == element::f16 ? element::f32 : type, op, f32_out, f32_in);
+
+    for (size_t i = 0; i < out.size(); i++)
+    {
+        if (out[i] == f32_out[i])
+        {
+            continue;
+        }
+        const float* source = f32_out[i]->get_data_ptr<float>();
+        float16* target = out[i]->get_data_ptr<float16>();
+        for (size_t j = 0; j < out[i]->get_element_count(); j++)
+        {
+            target[j] = float16(source[j]);
+        }
+    }
+}
+
 void runtime::interpreter::INTExecutable::set_nan_check(bool enable)
 {
     m_nan_check_enabled = enable;
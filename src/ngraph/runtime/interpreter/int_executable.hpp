@@ -181,6 +181,15 @@ private:
                         const std::vector<std::shared_ptr<HostTensor>>& outputs,
                         const std::vector<std::shared_ptr<HostTensor>>& inputs);
 
+    static bool has_f16_tensor(const std::vector<std::shared_ptr<HostTensor>>& tensors);
+
+    // float16 is a storage type, the op runs on float copies of its float16 tensors and its
+    // float16 results are rounded once
+    void generate_f16_calls(const element::Type& type,
+                            const NodeWrapper& op,
+                            const std::vector<std::shared_ptr<HostTensor>>& outputs,
+                            const std::vector<std::shared_ptr<HostTensor>>& inputs);
+
     template <typename T>
     void op_engine(const NodeWrapper& node_wrapper,
                    const std::vector<std::shared_ptr<HostTensor>>& out,
@@ -472,7 +481,8 @@ private:
         case OP_TYPEID::Convert:
         {
             // const op::Convert* c = static_cast<const op::Convert*>(&node);
-            element::Type type = node.get_element_type();
+            // Of the output tensor, which is float when the node produces float16
+            element::Type type = out[0]->get_element_type();
             std::stringstream ss;
             size_t element_count = shape_size(node.get_output_shape(0));
             switch (type.get_type_enum())
@@ -533,6 +543,7 @@ private:
             case element::Type_t::undefined:
             case element::Type_t::dynamic:
             case element::Type_t::bf16:
+            case element::Type_t::f16:
                 ss << "unsupported element type " << type << " op Convert";
                 throw std::runtime_error(ss.str());
             }
@@ -725,24 +736,7 @@ private:
         case OP_TYPEID::FunctionCall:
         {
             auto f = static_cast<const runtime::hybrid::op::FunctionCall*>(&node);
-            auto backend = f->get_backend();
-            auto executable = f->get_executable();
-
-            std::vector<std::shared_ptr<Tensor>> outputs;
-            std::vector<std::shared_ptr<Tensor>> inputs;
-            for (const std::shared_ptr<HostTensor>& t : out)
-            {
-                auto backend_tensor = backend->create_tensor(
-                    t->get_element_type(), t->get_shape(), t->get_data_ptr());
-                outputs.push_back(backend_tensor);
-            }
-            for (const std::shared_ptr<HostTensor>& t : args)
-            {
-                auto backend_tensor = backend->create_tensor(
-                    t->get_element_type(), t->get_shape(), t->get_data_ptr());
-                inputs.push_back(backend_tensor);
-            }
-            executable->call(outputs, inputs);
+            f->call(out, args);
             break;
         }
         case OP_TYPEID::Floor:
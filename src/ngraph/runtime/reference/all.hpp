@@ -16,10 +16,11 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 
-#include "ngraph/coordinate_transform.hpp"
 #include "ngraph/shape_util.hpp"
+#include "ngraph/strided_walk.hpp"
 
 namespace ngraph
 {
@@ -33,22 +34,14 @@ namespace ngraph
                                    const Shape& out_shape,
                                    const AxisSet& reduction_axes)
             {
-                CoordinateTransform output_transform(out_shape);
+                std::fill(out, out + shape_size(out_shape), 1);
 
-                for (const Coordinate& output_coord : output_transform)
-                {
-                    out[output_transform.index(output_coord)] = 1;
-                }
-
-                CoordinateTransform input_transform(in_shape);
-
-                for (const Coordinate& input_coord : input_transform)
-                {
-                    Coordinate output_coord = reduce(input_coord, reduction_axes);
-                    out[output_transform.index(output_coord)] =
-                        out[output_transform.index(output_coord)] &&
-                        arg[input_transform.index(input_coord)];
-                }
+                StridedWalk<2> walk(in_shape,
+                                    {{row_major_strides(in_shape),
+                                      projected_strides(in_shape, reduction_axes)}});
+                walk([&](const std::array<size_t, 2>& offsets) {
+                    out[offsets[1]] = out[offsets[1]] && arg[offsets[0]];
+                });
             }
         }
     }
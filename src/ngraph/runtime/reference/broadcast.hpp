@@ -18,8 +18,8 @@
 
 #include <cmath>
 
-#include "ngraph/coordinate_transform.hpp"
 #include "ngraph/shape_util.hpp"
+#include "ngraph/strided_walk.hpp"
 
 namespace ngraph
 {
@@ -34,16 +34,12 @@ namespace ngraph
                            const Shape& out_shape,
                            const AxisSet& broadcast_axes)
             {
-                CoordinateTransform input_transform(in_shape);
-                CoordinateTransform output_transform(out_shape);
-
-                for (const Coordinate& output_coord : output_transform)
-                {
-                    Coordinate input_coord = reduce(output_coord, broadcast_axes);
-
-                    out[output_transform.index(output_coord)] =
-                        arg[input_transform.index(input_coord)];
-                }
+                StridedWalk<2> walk(out_shape,
+                                    {{projected_strides(out_shape, broadcast_axes),
+                                      row_major_strides(out_shape)}});
+                walk([&](const std::array<size_t, 2>& offsets) {
+                    out[offsets[1]] = arg[offsets[0]];
+                });
             }
         }
     }
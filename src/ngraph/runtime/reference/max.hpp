@@ -16,11 +16,12 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 
-#include "ngraph/coordinate_transform.hpp"
 #include "ngraph/shape_util.hpp"
+#include "ngraph/strided_walk.hpp"
 
 namespace ngraph
 {
@@ -39,26 +40,18 @@ namespace ngraph
                                ? -std::numeric_limits<T>::infinity()
                                : std::numeric_limits<T>::min();
 
-                CoordinateTransform output_transform(out_shape);
+                std::fill(out, out + shape_size(out_shape), minval);
 
-                for (const Coordinate& output_coord : output_transform)
-                {
-                    out[output_transform.index(output_coord)] = minval;
-                }
-
-                CoordinateTransform input_transform(in_shape);
-
-                for (const Coordinate& input_coord : input_transform)
-                {
-                    Coordinate output_coord = reduce(input_coord, reduction_axes);
-
-                    T x = arg[input_transform.index(input_coord)];
-                    T max = out[output_transform.index(output_coord)];
-                    if (x > max)
+                StridedWalk<2> walk(in_shape,
+                                    {{row_major_strides(in_shape),
+                                      projected_strides(in_shape, reduction_axes)}});
+                walk([&](const std::array<size_t, 2>& offsets) {
+                    T x = arg[offsets[0]];
+                    if (x > out[offsets[1]])
                     {
-                        out[output_transform.index(output_coord)] = x;
+                        out[offsets[1]] = x;
                     }
-                }
+                });
             }
         }
     }
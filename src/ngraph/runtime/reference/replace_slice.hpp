@@ -16,10 +16,12 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 
 #include "ngraph/assertion.hpp"
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/coordinate.hpp"
+#include "ngraph/strided_walk.hpp"
 
 namespace ngraph
 {
@@ -38,32 +40,27 @@ namespace ngraph
                                const Shape& out_shape)
             {
                 // Step 1: Copy the entire replacement context to the output.
-                CoordinateTransform copy_transform(out_shape);
-
-                for (Coordinate copy_coord : copy_transform)
-                {
-                    out[copy_transform.index(copy_coord)] = arg0[copy_transform.index(copy_coord)];
-                }
+                std::copy(arg0, arg0 + shape_size(out_shape), out);
 
                 // Step 2: Overwrite the slice for replacement.
-                CoordinateTransform input_transform(arg1_shape);
-                CoordinateTransform output_transform(
-                    out_shape, lower_bounds, upper_bounds, strides);
-
-                NGRAPH_ASSERT(shape_size(input_transform.get_target_shape()) ==
-                              shape_size(output_transform.get_target_shape()));
-
-                CoordinateTransform::Iterator output_it = output_transform.begin();
-
-                for (const Coordinate& input_coord : input_transform)
+                Shape slice_shape(out_shape.size());
+                Strides slice_strides(out_shape.size());
+                Strides row_major = row_major_strides(out_shape);
+                size_t slice_start = 0;
+                for (size_t i = 0; i < out_shape.size(); i++)
                 {
-                    const Coordinate& output_coord = *output_it;
+                    slice_shape[i] =
+                        (upper_bounds[i] - lower_bounds[i] + strides[i] - 1) / strides[i];
+                    slice_strides[i] = row_major[i] * strides[i];
+                    slice_start += row_major[i] * lower_bounds[i];
+                }
 
-                    out[output_transform.index(output_coord)] =
-                        arg1[input_transform.index(input_coord)];
+                NGRAPH_ASSERT(shape_size(slice_shape) == shape_size(arg1_shape));
 
-                    ++output_it;
-                }
+                StridedWalk<2> walk(slice_shape, {{slice_strides, row_major_strides(slice_shape)}});
+                walk.walk({{slice_start, 0}}, [&](const std::array<size_t, 2>& offsets) {
+                    out[offsets[0]] = arg1[offsets[1]];
+                });
             }
         }
     }
@@ -20,7 +20,7 @@
 
 #include "ngraph/assertion.hpp"
 #include "ngraph/axis_vector.hpp"
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/strided_walk.hpp"
 
 namespace ngraph
 {
@@ -35,29 +35,21 @@ namespace ngraph
                          const AxisVector& in_axis_order,
                          const Shape& out_shape)
             {
-                // Unfortunately we don't yet have a constructor for CoordinateTransform that lets us pass only source_space_shape
-                // and source_axis_order so we have to construct the defaults here.
-                Shape in_start_corner(in_shape.size(), 0); // (0,...0)
-                Strides in_strides(in_shape.size(), 1);    // (1,...,1)
-
-                CoordinateTransform input_transform(
-                    in_shape, in_start_corner, in_shape, in_strides, in_axis_order);
-                CoordinateTransform output_transform(out_shape);
-
-                NGRAPH_ASSERT(shape_size(input_transform.get_target_shape()) ==
-                              shape_size(output_transform.get_target_shape()));
-
-                CoordinateTransform::Iterator output_it = output_transform.begin();
-
-                for (const Coordinate& input_coord : input_transform)
+                // Walk the input with its axes in output order
+                Shape transposed_shape(in_shape.size());
+                for (size_t i = 0; i < in_shape.size(); i++)
                 {
-                    const Coordinate& output_coord = *output_it;
+                    transposed_shape[i] = in_shape.at(in_axis_order[i]);
+                }
 
-                    out[output_transform.index(output_coord)] =
-                        arg[input_transform.index(input_coord)];
+                NGRAPH_ASSERT(shape_size(transposed_shape) == shape_size(out_shape));
 
-                    ++output_it;
-                }
+                StridedWalk<2> walk(transposed_shape,
+                                    {{permuted_strides(in_shape, in_axis_order),
+                                      row_major_strides(transposed_shape)}});
+                walk([&](const std::array<size_t, 2>& offsets) {
+                    out[offsets[1]] = arg[offsets[0]];
+                });
             }
         }
     }
@@ -19,7 +19,8 @@
 #include <cmath>
 
 #include "ngraph/assertion.hpp"
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/coordinate.hpp"
+#include "ngraph/strided_walk.hpp"
 
 namespace ngraph
 {
@@ -36,22 +37,24 @@ namespace ngraph
                        const Strides& strides,
                        const Shape& out_shape)
             {
-                CoordinateTransform input_transform(arg_shape, lower_bounds, upper_bounds, strides);
-                CoordinateTransform output_transform(out_shape);
-
-                CoordinateTransform::Iterator output_it = output_transform.begin();
-
-                NGRAPH_ASSERT(shape_size(input_transform.get_target_shape()) ==
-                              shape_size(output_transform.get_target_shape()));
-
-                for (const Coordinate& in_coord : input_transform)
+                Shape slice_shape(arg_shape.size());
+                Strides slice_strides(arg_shape.size());
+                Strides row_major = row_major_strides(arg_shape);
+                size_t slice_start = 0;
+                for (size_t i = 0; i < arg_shape.size(); i++)
                 {
-                    const Coordinate& out_coord = *output_it;
+                    slice_shape[i] =
+                        (upper_bounds[i] - lower_bounds[i] + strides[i] - 1) / strides[i];
+                    slice_strides[i] = row_major[i] * strides[i];
+                    slice_start += row_major[i] * lower_bounds[i];
+                }
 
-                    out[output_transform.index(out_coord)] = arg[input_transform.index(in_coord)];
+                NGRAPH_ASSERT(shape_size(slice_shape) == shape_size(out_shape));
 
-                    ++output_it;
-                }
+                StridedWalk<2> walk(slice_shape, {{slice_strides, row_major_strides(slice_shape)}});
+                walk.walk({{slice_start, 0}}, [&](const std::array<size_t, 2>& offsets) {
+                    out[offsets[1]] = arg[offsets[0]];
+                });
             }
         }
     }
@@ -17,10 +17,10 @@
 #pragma once
 
 #include <cmath>
-#include "ngraph/coordinate_transform.hpp"
 #include "ngraph/runtime/reference/max.hpp"
 #include "ngraph/runtime/reference/sum.hpp"
 #include "ngraph/shape_util.hpp"
+#include "ngraph/strided_walk.hpp"
 
 namespace ngraph
 {
@@ -37,22 +37,17 @@ namespace ngraph
 
                 max(arg, temp_ptr, shape, temp_shape, axes);
 
-                CoordinateTransform transform(shape);
-                CoordinateTransform temp_transform(temp_shape);
-                for (const Coordinate& coord : transform)
-                {
-                    Coordinate temp_coord = reduce(coord, axes);
-                    out[transform.index(coord)] = std::exp(
-                        arg[transform.index(coord)] - temp_ptr[temp_transform.index(temp_coord)]);
-                }
+                StridedWalk<2> walk(shape,
+                                    {{row_major_strides(shape), projected_strides(shape, axes)}});
+                walk([&](const std::array<size_t, 2>& offsets) {
+                    out[offsets[0]] = std::exp(arg[offsets[0]] - temp_ptr[offsets[1]]);
+                });
 
                 sum(out, temp_ptr, shape, temp_shape, axes);
 
-                for (const Coordinate& coord : transform)
-                {
-                    Coordinate temp_coord = reduce(coord, axes);
-                    out[transform.index(coord)] /= temp_ptr[temp_transform.index(temp_coord)];
-                }
+                walk([&](const std::array<size_t, 2>& offsets) {
+                    out[offsets[0]] /= temp_ptr[offsets[1]];
+                });
 
                 delete[] temp_ptr;
             }
@@ -16,10 +16,11 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 
-#include "ngraph/coordinate_transform.hpp"
 #include "ngraph/shape_util.hpp"
+#include "ngraph/strided_walk.hpp"
 
 namespace ngraph
 {
@@ -34,27 +35,18 @@ namespace ngraph
                      const Shape& out_shape,
                      const AxisSet& reduction_axes)
             {
-                CoordinateTransform output_transform(out_shape);
-                std::vector<T> c(shape_size(out_shape));
+                std::fill(out, out + shape_size(out_shape), T(0));
+                std::vector<T> c(shape_size(out_shape), 0);
 
-                for (const Coordinate& output_coord : output_transform)
-                {
-                    out[output_transform.index(output_coord)] = 0;
-                    c[output_transform.index(output_coord)] = 0;
-                }
-
-                CoordinateTransform input_transform(in_shape);
-
-                for (const Coordinate& input_coord : input_transform)
-                {
-                    Coordinate output_coord = reduce(input_coord, reduction_axes);
-                    T y = arg[input_transform.index(input_coord)] -
-                          c[output_transform.index(output_coord)];
-                    T t = out[output_transform.index(output_coord)] + y;
-                    c[output_transform.index(output_coord)] =
-                        (t - out[output_transform.index(output_coord)]) - y;
-                    out[output_transform.index(output_coord)] = t;
-                }
+                StridedWalk<2> walk(in_shape,
+                                    {{row_major_strides(in_shape),
+                                      projected_strides(in_shape, reduction_axes)}});
+                walk([&](const std::array<size_t, 2>& offsets) {
+                    T y = arg[offsets[0]] - c[offsets[1]];
+                    T t = out[offsets[1]] + y;
+                    c[offsets[1]] = (t - out[offsets[1]]) - y;
+                    out[offsets[1]] = t;
+                });
             }
         }
     }
@@ -0,0 +1,216 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include "ngraph/assertion.hpp"
+#include "ngraph/axis_set.hpp"
+#include "ngraph/axis_vector.hpp"
+#include "ngraph/shape.hpp"
+#include "ngraph/strides.hpp"
+
+namespace ngraph
+{
+    /// \brief Walks every coordinate of a shape in row-major order, keeping the element offset
+    ///        of the coordinate in N buffers with arbitrary strides.
+    ///
+    /// Unlike CoordinateTransform, the walk does not materialize coordinates: offsets are
+    /// advanced incrementally and nothing is allocated per element. Axes of extent 1 are
+    /// dropped and neighbouring axes that every buffer traverses contiguously are merged, so a
+    /// walk over dense row-major buffers is a single flat loop.
+    template <size_t N>
+    class StridedWalk
+    {
+    public:
+        using Offsets = std::array<size_t, N>;
+
+        /// \param shape Shape to walk.
+        /// \param strides For each buffer, its element stride along every axis of `shape`. A
+        ///        stride of 0 revisits the same element along that axis.
+        StridedWalk(const Shape& shape, const std::array<Strides, N>& strides)
+        {
+            for (size_t k = 0; k < N; k++)
+            {
+                NGRAPH_ASSERT(strides[k].size() == shape.size())
+                    << "Strides " << strides[k] << " do not match the rank of shape " << shape;
+            }
+
+            for (size_t axis = 0; axis < shape.size(); axis++)
+            {
+                if (shape[axis] == 0)
+                {
+                    m_empty = true;
+                }
+                if (shape[axis] <= 1)
+                {
+                    continue;
+                }
+
+                bool merge = !m_shape.empty();
+                for (size_t k = 0; k < N && merge; k++)
+                {
+                    merge = m_strides[k].back() == strides[k][axis] * shape[axis];
+                }
+                if (merge)
+                {
+                    m_shape.back() *= shape[axis];
+                }
+                else
+                {
+                    m_shape.push_back(shape[axis]);
+                }
+                for (size_t k = 0; k < N; k++)
+                {
+                    if (merge)
+                    {
+                        m_strides[k].back() = strides[k][axis];
+                    }
+                    else
+                    {
+                        m_strides[k].push_back(strides[k][axis]);
+                    }
+                }
+            }
+
+            // Scalars and shapes of ones still visit one element
+            if (m_shape.empty())
+            {
+                m_shape.push_back(1);
+                for (size_t k = 0; k < N; k++)
+                {
+                    m_strides[k].push_back(0);
+                }
+            }
+        }
+
+        /// \brief Rank left after dropping and merging axes, 1 for a flat loop.
+        size_t get_collapsed_rank() const { return m_shape.size(); }
+        /// \brief Calls `f(offsets)` for every coordinate, offsets starting at 0.
+        template <typename F>
+        void operator()(F&& f) const
+        {
+            walk(Offsets(), f);
+        }
+
+        /// \brief Calls `f(offsets)` for every coordinate, offsets starting at `start`.
+        template <typename F>
+        void walk(const Offsets& start, F&& f) const
+        {
+            if (m_empty)
+            {
+                return;
+            }
+
+            size_t inner_axis = m_shape.size() - 1;
+            size_t inner_extent = m_shape[inner_axis];
+            Offsets inner_strides;
+            for (size_t k = 0; k < N; k++)
+            {
+                inner_strides[k] = m_strides[k][inner_axis];
+            }
+            auto walk_row = [&](const Offsets& row_start) {
+                Offsets offsets = row_start;
+                for (size_t i = 0; i < inner_extent; i++)
+                {
+                    f(static_cast<const Offsets&>(offsets));
+                    for (size_t k = 0; k < N; k++)
+                    {
+                        offsets[k] += inner_strides[k];
+                    }
+                }
+            };
+
+            if (inner_axis == 0)
+            {
+                walk_row(start);
+                return;
+            }
+
+            // Odometer over the outer axes
+            std::vector<size_t> counters(inner_axis, 0);
+            Offsets row_start = start;
+            while (true)
+            {
+                walk_row(row_start);
+
+                size_t axis = inner_axis;
+                while (true)
+                {
+                    if (axis == 0)
+                    {
+                        return;
+                    }
+                    axis--;
+                    for (size_t k = 0; k < N; k++)
+                    {
+                        row_start[k] += m_strides[k][axis];
+                    }
+                    if (++counters[axis] < m_shape[axis])
+                    {
+                        break;
+                    }
+                    for (size_t k = 0; k < N; k++)
+                    {
+                        row_start[k] -= m_strides[k][axis] * m_shape[axis];
+                    }
+                    counters[axis] = 0;
+                }
+            }
+        }
+
+    private:
+        Shape m_shape;
+        std::array<Strides, N> m_strides;
+        bool m_empty = false;
+    };
+
+    /// \brief Strides of the row-major buffer of `reduce(shape, axes)` along the axes of
+    ///        `shape`, 0 along the removed axes.
+    ///
+    /// Walking `shape` with these strides maps every coordinate to its reduced coordinate, as
+    /// needed by reductions and broadcasts.
+    inline Strides projected_strides(const Shape& shape, const AxisSet& axes)
+    {
+        Strides strides(shape.size(), 0);
+        size_t stride = 1;
+        for (size_t axis = shape.size(); axis-- > 0;)
+        {
+            if (axes.count(axis) == 0)
+            {
+                strides[axis] = stride;
+                stride *= shape[axis];
+            }
+        }
+        return strides;
+    }
+
+    /// \brief Row-major strides of `shape` listed in `axis_order`, to walk a buffer of `shape`
+    ///        with its axes transposed.
+    inline Strides permuted_strides(const Shape& shape, const AxisVector& axis_order)
+    {
+        Strides row_major = row_major_strides(shape);
+        Strides strides(axis_order.size());
+        for (size_t i = 0; i < axis_order.size(); i++)
+        {
+            strides[i] = row_major.at(axis_order[i]);
+        }
+        return strides;
+    }
+}
@@ -32,6 +32,7 @@
 //==============================================================================
 
 #include <cmath>
+#include <cstring>
 #include <iostream>
 
 #include "ngraph/type/bfloat16.hpp"
@@ -55,7 +56,8 @@ std::vector<float> bfloat16::to_float_vector(const std::vector<bfloat16>& v_bf16
 
 std::vector<bfloat16> bfloat16::from_float_vector(const std::vector<float>& v_f32)
 {
-    std::vector<bfloat16> v_bf16(v_f32.size());
+    std::vector<bfloat16> v_bf16;
+    v_bf16.reserve(v_f32.size());
     for (float a : v_f32)
     {
         v_bf16.push_back(static_cast<bfloat16>(a));
@@ -72,17 +74,17 @@ bfloat16::bfloat16(float value, bool rounding)
     else if (!rounding)
     {
         // Truncate off 16 LSB, no rounding
-        // Treat system as little endian (Intel x86 family)
-        uint16_t* u16_ptr = reinterpret_cast<uint16_t*>(&value);
-        m_value = u16_ptr[1];
+        uint32_t u32_value;
+        std::memcpy(&u32_value, &value, sizeof(u32_value));
+        m_value = static_cast<uint16_t>(u32_value >> 16);
     }
     else
     {
         // Rounding with round-nearest-to-even to create bfloat16
         // from float. Refer to TF implementation explanation:
         // https://github.com/tensorflow/tensorflow/blob/d354efc/tensorflow/core/lib/bfloat16/bfloat16.h#L199
-        uint32_t* u32_ptr = reinterpret_cast<uint32_t*>(&value);
-        uint32_t u32_value = *u32_ptr;
+        uint32_t u32_value;
+        std::memcpy(&u32_value, &value, sizeof(u32_value));
         uint32_t lsb = (u32_value >> 16) & 1;
         uint32_t rounding_bias = 0x7fff + lsb;
         u32_value += rounding_bias;
@@ -90,6 +92,13 @@ bfloat16::bfloat16(float value, bool rounding)
     }
 }
 
+bfloat16 bfloat16::from_bits(uint16_t bits)
+{
+    bfloat16 result;
+    result.m_value = bits;
+    return result;
+}
+
 std::string bfloat16::to_string() const
 {
     return std::to_string(static_cast<float>(*this));
@@ -130,17 +139,16 @@ bool bfloat16::operator>=(const bfloat16& other) const
 
 bfloat16::operator float() const
 {
-    // float result = 0;
-    // uint16_t* u16_ptr = reinterpret_cast<uint16_t*>(&result);
-
-    // // Treat the system as little endian (Intel x86 family)
-    // u16_ptr[1] = m_value;
-    return static_cast<float>(static_cast<uint32_t>(m_value) << 16);
+    // The bfloat16 bits are the upper half of the float bits
+    uint32_t u32_value = static_cast<uint32_t>(m_value) << 16;
+    float result;
+    std::memcpy(&result, &u32_value, sizeof(result));
+    return result;
 }
 
 bfloat16::operator double() const
 {
-    return static_cast<float>(m_value);
+    return static_cast<float>(*this);
 }
 
 std::ostream& operator<<(std::ostream& out, const bfloat16& obj)
@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <iostream>
 #include <memory>
 #include <string>
@@ -34,7 +35,6 @@ namespace ngraph
         bfloat16(float value, bool rounding = false);
         bfloat16(const bfloat16&) = default;
         bfloat16& operator=(const bfloat16&) = default;
-        virtual ~bfloat16() {}
         std::string to_string() const;
         size_t size() const;
         bool operator==(const bfloat16& other) const;
@@ -49,6 +49,10 @@ namespace ngraph
         static std::vector<float> to_float_vector(const std::vector<bfloat16>&);
         static std::vector<bfloat16> from_float_vector(const std::vector<float>&);
 
+        /// \brief The bfloat16 whose bit pattern is `bits`
+        static bfloat16 from_bits(uint16_t bits);
+        uint16_t to_bits() const { return m_value; }
+
         friend std::ostream& operator<<(std::ostream&, const bfloat16&);
 
     private:
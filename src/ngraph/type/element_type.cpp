@@ -27,6 +27,7 @@ using namespace std;
 NGRAPH_API const element::Type element::dynamic(element::Type_t::dynamic);
 NGRAPH_API const element::Type element::boolean(element::Type_t::boolean);
 NGRAPH_API const element::Type element::bf16(element::Type_t::bf16);
+NGRAPH_API const element::Type element::f16(element::Type_t::f16);
 NGRAPH_API const element::Type element::f32(element::Type_t::f32);
 NGRAPH_API const element::Type element::f64(element::Type_t::f64);
 NGRAPH_API const element::Type element::i8(element::Type_t::i8);
@@ -65,6 +66,7 @@ static const map<element::Type_t, const TypeInfo>& get_type_info_map()
         {element::Type_t::dynamic, TypeInfo(0, false, false, false, "dynamic")},
         {element::Type_t::boolean, TypeInfo(8, false, true, false, "char")},
         {element::Type_t::bf16, TypeInfo(16, true, true, false, "bfloat16")},
+        {element::Type_t::f16, TypeInfo(16, true, true, false, "float16")},
         {element::Type_t::f32, TypeInfo(32, true, true, false, "float")},
         {element::Type_t::f64, TypeInfo(64, true, true, false, "double")},
         {element::Type_t::i8, TypeInfo(8, false, true, true, "int8_t")},
@@ -84,6 +86,7 @@ std::vector<const element::Type*> element::Type::get_known_types()
     std::vector<const element::Type*> rc = {&element::dynamic,
                                             &element::boolean,
                                             &element::bf16,
+                                            &element::f16,
                                             &element::f32,
                                             &element::f64,
                                             &element::i8,
@@ -100,14 +103,25 @@ std::vector<const element::Type*> element::Type::get_known_types()
 element::Type::Type(
     size_t bitwidth, bool is_real, bool is_signed, bool is_quantized, const std::string& cname)
 {
+    // bf16 and f16 only differ by name, so a matching name wins over the first type with
+    // matching properties
+    bool found = false;
     for (const pair<element::Type_t, TypeInfo>& t : get_type_info_map())
     {
         const TypeInfo& info = t.second;
         if (bitwidth == info.m_bitwidth && is_real == info.m_is_real &&
             is_signed == info.m_is_signed && is_quantized == info.m_is_quantized)
         {
-            m_type = t.first;
-            return;
+            if (cname == info.m_cname)
+            {
+                m_type = t.first;
+                return;
+            }
+            if (!found)
+            {
+                m_type = t.first;
+                found = true;
+            }
         }
     }
 }
@@ -206,6 +220,11 @@ namespace ngraph
         {
             return bf16;
         }
+        template <>
+        const Type& from<ngraph::float16>()
+        {
+            return f16;
+        }
     }
 }
 
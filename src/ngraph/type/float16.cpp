@@ -0,0 +1,156 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstring>
+
+#include "ngraph/type/float16.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+std::vector<float> float16::to_float_vector(const std::vector<float16>& v_f16)
+{
+    std::vector<float> v_f32(v_f16.begin(), v_f16.end());
+    return v_f32;
+}
+
+std::vector<float16> float16::from_float_vector(const std::vector<float>& v_f32)
+{
+    std::vector<float16> v_f16;
+    v_f16.reserve(v_f32.size());
+    for (float a : v_f32)
+    {
+        v_f16.push_back(static_cast<float16>(a));
+    }
+    return v_f16;
+}
+
+float16::float16(float value)
+{
+    uint32_t u32_value;
+    std::memcpy(&u32_value, &value, sizeof(u32_value));
+    uint32_t sign = (u32_value >> 16) & 0x8000;
+    uint32_t abs_value = u32_value & 0x7fffffff;
+
+    if (abs_value > 0x7f800000)
+    {
+        // NaN, kept quiet
+        m_value = static_cast<uint16_t>(sign | 0x7e00 | ((abs_value >> 13) & 0x3ff));
+    }
+    else if (abs_value >= 0x477ff000)
+    {
+        // At least 65520, which rounds past the largest float16
+        m_value = static_cast<uint16_t>(sign | 0x7c00);
+    }
+    else if (abs_value < 0x38800000)
+    {
+        // Below the smallest normal float16. Adding 0.5 lines the float16 subnormal mantissa
+        // up with the low bits of the float mantissa, and the float addition rounds it.
+        float abs_float;
+        std::memcpy(&abs_float, &abs_value, sizeof(abs_float));
+        abs_float += 0.5f;
+        uint32_t u32_sum;
+        std::memcpy(&u32_sum, &abs_float, sizeof(u32_sum));
+        m_value = static_cast<uint16_t>(sign | (u32_sum - 0x3f000000));
+    }
+    else
+    {
+        // Rebias the exponent and round the 13 dropped mantissa bits to nearest even
+        uint32_t mantissa_odd = (abs_value >> 13) & 1;
+        abs_value += (static_cast<uint32_t>(15 - 127) << 23) + 0xfff + mantissa_odd;
+        m_value = static_cast<uint16_t>(sign | (abs_value >> 13));
+    }
+}
+
+float16 float16::from_bits(uint16_t bits)
+{
+    float16 result;
+    result.m_value = bits;
+    return result;
+}
+
+std::string float16::to_string() const
+{
+    return std::to_string(static_cast<float>(*this));
+}
+
+size_t float16::size() const
+{
+    return sizeof(m_value);
+}
+
+bool float16::operator==(const float16& other) const
+{
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wfloat-equal"
+    return (static_cast<float>(*this) == static_cast<float>(other));
+#pragma clang diagnostic pop
+}
+
+bool float16::operator<(const float16& other) const
+{
+    return (static_cast<float>(*this) < static_cast<float>(other));
+}
+
+bool float16::operator<=(const float16& other) const
+{
+    return (static_cast<float>(*this) <= static_cast<float>(other));
+}
+
+bool float16::operator>(const float16& other) const
+{
+    return (static_cast<float>(*this) > static_cast<float>(other));
+}
+
+bool float16::operator>=(const float16& other) const
+{
+    return (static_cast<float>(*this) >= static_cast<float>(other));
+}
+
+float16::operator float() const
+{
+    uint32_t sign = static_cast<uint32_t>(m_value & 0x8000) << 16;
+    uint32_t exponent = (m_value >> 10) & 0x1f;
+    uint32_t mantissa = m_value & 0x3ff;
+    uint32_t u32_value;
+    if (exponent == 0x1f)
+    {
+        // Inf and NaN
+        u32_value = sign | 0x7f800000 | (mantissa << 13);
+    }
+    else if (exponent == 0)
+    {
+        // Zero and subnormals, mantissa * 2^-24 is exact in float
+        float abs_float = static_cast<float>(mantissa) * 5.9604644775390625e-8f;
+        std::memcpy(&u32_value, &abs_float, sizeof(u32_value));
+        u32_value |= sign;
+    }
+    else
+    {
+        u32_value = sign | ((exponent + 127 - 15) << 23) | (mantissa << 13);
+    }
+    float result;
+    std::memcpy(&result, &u32_value, sizeof(result));
+    return result;
+}
+
+namespace ngraph
+{
+    std::ostream& operator<<(std::ostream& out, const float16& obj)
+    {
+        return (out << static_cast<float>(obj));
+    }
+}
@@ -0,0 +1,62 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+//================================================================================================
+// IEEE 754 half precision type
+//================================================================================================
+
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace ngraph
+{
+    /// \brief IEEE 754 binary16: 1 sign bit, 5 exponent bits and 10 mantissa bits. Only a
+    ///        storage type, values are converted to float to compute with them.
+    class float16
+    {
+    public:
+        float16() {}
+        /// \brief Rounds `value` to the nearest float16, ties to even
+        float16(float value);
+        float16(const float16&) = default;
+        float16& operator=(const float16&) = default;
+        std::string to_string() const;
+        size_t size() const;
+        bool operator==(const float16& other) const;
+        bool operator!=(const float16& other) const { return !(*this == other); }
+        bool operator<(const float16& other) const;
+        bool operator<=(const float16& other) const;
+        bool operator>(const float16& other) const;
+        bool operator>=(const float16& other) const;
+        operator float() const;
+
+        static std::vector<float> to_float_vector(const std::vector<float16>&);
+        static std::vector<float16> from_float_vector(const std::vector<float>&);
+
+        /// \brief The float16 whose bit pattern is `bits`
+        static float16 from_bits(uint16_t bits);
+        uint16_t to_bits() const { return m_value; }
+
+        friend std::ostream& operator<<(std::ostream&, const float16&);
+
+    private:
+        uint16_t m_value{0};
+    };
+}
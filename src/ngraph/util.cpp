@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstring>
 #include <deque>
 #include <forward_list>
 #include <iomanip>
@@ -160,6 +161,49 @@ size_t ngraph::hash_combine(const std::vector<size_t>& list)
     return seed;
 }
 
+uint64_t ngraph::hash_bytes(const void* data, size_t size)
+{
+    // Four independent multiply-rotate lanes over 32-byte blocks, so the multiplies overlap,
+    // finished with the MurmurHash3 64-bit finalizer
+    const uint64_t k0 = 0x9ddfea08eb382d69ULL;
+    const uint64_t k1 = 0x87c37b91114253d5ULL;
+    auto rotl = [](uint64_t x, int r) { return (x << r) | (x >> (64 - r)); };
+    auto mix = [&](uint64_t h, uint64_t w) { return rotl(h ^ (w * k0), 31) * k1; };
+
+    const char* p = static_cast<const char*>(data);
+    uint64_t lanes[4] = {size, size ^ k0, size ^ k1, size ^ (k0 + k1)};
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32)
+    {
+        uint64_t w[4];
+        memcpy(w, p + i, sizeof(w));
+        lanes[0] = mix(lanes[0], w[0]);
+        lanes[1] = mix(lanes[1], w[1]);
+        lanes[2] = mix(lanes[2], w[2]);
+        lanes[3] = mix(lanes[3], w[3]);
+    }
+    uint64_t h = lanes[0] ^ rotl(lanes[1], 17) ^ rotl(lanes[2], 29) ^ rotl(lanes[3], 47);
+    for (; i + 8 <= size; i += 8)
+    {
+        uint64_t w;
+        memcpy(&w, p + i, sizeof(w));
+        h = mix(h, w);
+    }
+    if (i < size)
+    {
+        uint64_t tail = 0;
+        memcpy(&tail, p + i, size - i);
+        h = mix(h, tail);
+    }
+
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb3fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
 void* ngraph::aligned_alloc(size_t alignment, size_t size)
 {
 #ifdef __APPLE__
@@ -18,6 +18,7 @@
 
 #include <chrono>
 #include <cmath>
+#include <cstdint>
 #include <cstdlib> // llvm 8.1 gets confused about `malloc` otherwise
 #include <functional>
 #include <iostream>
@@ -71,6 +72,8 @@ namespace ngraph
     }
 
     size_t hash_combine(const std::vector<size_t>& list);
+    /// \brief Fast, non-cryptographic 64-bit digest of `size` bytes at `data`.
+    uint64_t hash_bytes(const void* data, size_t size);
     void dump(std::ostream& out, const void*, size_t);
 
     std::string to_lower(const std::string& s);
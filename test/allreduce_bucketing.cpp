@@ -0,0 +1,74 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <memory>
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/pass/allreduce_bucketing.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "util/test_tools.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+TEST(allreduce_bucketing, fuse_small_tensors)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{4});
+    auto C = make_shared<op::Parameter>(element::f32, Shape{});
+    auto D = make_shared<op::Parameter>(element::f32, Shape{64});
+    auto f = make_shared<Function>(NodeVector{make_shared<op::AllReduce>(A),
+                                              make_shared<op::AllReduce>(B),
+                                              make_shared<op::AllReduce>(C),
+                                              make_shared<op::AllReduce>(D)},
+                                   ParameterVector{A, B, C, D});
+
+    // The three small tensors take 44 bytes, the last one does not fit in 64
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::AllReduceBucketing>(64);
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::AllReduce>(f), 2);
+    for (size_t i = 0; i < 3; i++)
+    {
+        auto reshape = f->get_results().at(i)->get_argument(0);
+        ASSERT_TRUE(dynamic_pointer_cast<op::Reshape>(reshape));
+        auto slice = dynamic_pointer_cast<op::Slice>(reshape->get_argument(0));
+        ASSERT_TRUE(slice);
+        EXPECT_TRUE(dynamic_pointer_cast<op::AllReduce>(slice->get_argument(0)));
+    }
+    EXPECT_EQ(f->get_output_shape(0), (Shape{2, 3}));
+    EXPECT_EQ(f->get_output_shape(2), (Shape{}));
+    EXPECT_TRUE(dynamic_pointer_cast<op::AllReduce>(f->get_results().at(3)->get_argument(0)));
+}
+
+TEST(allreduce_bucketing, dependent_allreduces)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{4});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{4});
+    auto reduced = make_shared<op::AllReduce>(A);
+    auto f = make_shared<Function>(
+        NodeVector{make_shared<op::AllReduce>(reduced + B), make_shared<op::AllReduce>(B)},
+        ParameterVector{A, B});
+
+    // The AllReduce of the sum depends on the first one and goes to a bucket of its own
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::AllReduceBucketing>();
+    pass_manager.run_passes(f);
+
+    EXPECT_EQ(count_ops_of_type<op::AllReduce>(f), 2);
+}
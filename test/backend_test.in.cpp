@@ -1455,6 +1455,51 @@ NGRAPH_TEST(${BACKEND_NAME}, convert_float32_bool)
     EXPECT_EQ((vector<char>{1, 2, 3, 4}), read_vector<char>(result));
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, convert_float16)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(
+        make_shared<op::Convert>(make_shared<op::Convert>(A, element::f16), element::i32),
+        ParameterVector{A});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    // Create some tensors for input/output
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1.5f, -2.0f, 2049.0f, 65504.0f});
+    auto result = backend->create_tensor(element::i32, shape);
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a});
+    // 2049 rounds to 2048 in float16
+    EXPECT_EQ((vector<int32_t>{1, -2, 2048, 65504}), read_vector<int32_t>(result));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, dot_float16)
+{
+    Shape shape_a{2, 3};
+    Shape shape_b{3, 2};
+    auto A = make_shared<op::Parameter>(element::f16, shape_a);
+    auto B = make_shared<op::Parameter>(element::f16, shape_b);
+    auto C = op::Constant::create(element::f16, Shape{2, 2}, {0.5f, 0.5f, 0.5f, 0.5f});
+    auto f = make_shared<Function>(make_shared<op::Dot>(A, B) + C, ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    // Create some tensors for input/output
+    auto a = backend->create_tensor(element::f16, shape_a);
+    copy_data(a, float16::from_float_vector({1, 2, 3, 4, 5, 6}));
+    auto b = backend->create_tensor(element::f16, shape_b);
+    copy_data(b, float16::from_float_vector({0.5f, -1, 0.25f, 2, 1, 0.125f}));
+    auto result = backend->create_tensor(element::f16, Shape{2, 2});
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a, b});
+    EXPECT_EQ((vector<float>{4.5f, 3.875f, 9.75f, 7.25f}),
+              float16::to_float_vector(read_vector<float16>(result)));
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, slice_scalar)
 {
     Shape shape_a{};
@@ -5871,6 +5916,149 @@ NGRAPH_TEST(${BACKEND_NAME}, dequantize_axes)
               read_vector<output_c_type>(y));
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, quantize_inner_axis)
+{
+    Shape input_shape{2, 3, 2};
+    Shape scale_offset_shape{3};
+    AxisSet quantization_axes{1};
+
+    auto input_type = element::f32;
+    auto output_type = element::u8;
+
+    typedef float input_c_type;
+    typedef uint8_t output_c_type;
+
+    op::Quantize::RoundMode round_mode = op::Quantize::RoundMode::ROUND_NEAREST_TOWARD_EVEN;
+
+    auto X = make_shared<op::Parameter>(input_type, input_shape);
+    auto scale = op::Constant::create(input_type, scale_offset_shape, {2, 3, 4});
+    auto offset = op::Constant::create(output_type, scale_offset_shape, {10, 20, 30});
+    auto quantize =
+        make_shared<op::Quantize>(X, scale, offset, output_type, quantization_axes, round_mode);
+    auto f = make_shared<Function>(quantize, ParameterVector{X});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto x = backend->create_tensor(input_type, input_shape);
+    auto y = backend->create_tensor(output_type, input_shape);
+
+    copy_data(x, vector<input_c_type>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11});
+    // divided by scale               2  2  3  3  4  4  2  2  3  3   4   4
+    // equals (rounded)               0  0  1  1  1  1  3  4  3  3   2   3
+    // plus offset                   10 10 20 20 30 30 10 10 20 20  30  30
+    // equals                        10 10 21 21 31 31 13 14 23 23  32  33
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({y}, {x});
+    EXPECT_EQ((vector<output_c_type>{10, 10, 21, 21, 31, 31, 13, 14, 23, 23, 32, 33}),
+              read_vector<output_c_type>(y));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, quantize_non_contiguous_axes)
+{
+    Shape input_shape{2, 3, 2};
+    Shape scale_offset_shape{2, 2};
+    AxisSet quantization_axes{0, 2};
+
+    auto input_type = element::f32;
+    auto output_type = element::u8;
+
+    typedef float input_c_type;
+    typedef uint8_t output_c_type;
+
+    op::Quantize::RoundMode round_mode = op::Quantize::RoundMode::ROUND_NEAREST_TOWARD_EVEN;
+
+    auto X = make_shared<op::Parameter>(input_type, input_shape);
+    auto scale = op::Constant::create(input_type, scale_offset_shape, {1, 2, 3, 4});
+    auto offset = op::Constant::create(output_type, scale_offset_shape, {1, 2, 3, 4});
+    auto quantize =
+        make_shared<op::Quantize>(X, scale, offset, output_type, quantization_axes, round_mode);
+    auto f = make_shared<Function>(quantize, ParameterVector{X});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto x = backend->create_tensor(input_type, input_shape);
+    auto y = backend->create_tensor(output_type, input_shape);
+
+    copy_data(x, vector<input_c_type>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11});
+    // divided by scale               1  2  1  2  1  2  3  4  3  4   3   4
+    // equals (rounded)               0  0  2  2  4  2  2  2  3  2   3   3
+    // plus offset                    1  2  1  2  1  2  3  4  3  4   3   4
+    // equals                         1  2  3  4  5  4  5  6  6  6   6   7
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({y}, {x});
+    EXPECT_EQ((vector<output_c_type>{1, 2, 3, 4, 5, 4, 5, 6, 6, 6, 6, 7}),
+              read_vector<output_c_type>(y));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, dequantize_inner_axis)
+{
+    Shape input_shape{2, 3, 2};
+    Shape scale_offset_shape{3};
+    AxisSet quantization_axes{1};
+
+    auto input_type = element::i8;
+    auto output_type = element::f32;
+
+    typedef int8_t input_c_type;
+    typedef float output_c_type;
+
+    auto X = make_shared<op::Parameter>(input_type, input_shape);
+    auto scale = op::Constant::create(output_type, scale_offset_shape, {2, 3, 4});
+    auto offset = op::Constant::create(input_type, scale_offset_shape, {1, -1, 0});
+    auto dequantize = make_shared<op::Dequantize>(X, scale, offset, output_type, quantization_axes);
+    auto f = make_shared<Function>(dequantize, ParameterVector{X});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto x = backend->create_tensor(input_type, input_shape);
+    auto y = backend->create_tensor(output_type, input_shape);
+
+    copy_data(x, vector<input_c_type>{1, 2, -1, 0, -2, 3, 4, -3, 5, 1, 0, -1});
+    // minus offset                   1  1  -1 -1 0  0  1  1  -1 -1  0   0
+    // equals                         0  1   0  1 -2 3  3 -4   6  2  0  -1
+    // multiplied by scale            2  2   3  3  4 4  2  2   3  3  4   4
+    // equals                         0  2   0  3 -8 12 6 -8  18  6  0  -4
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({y}, {x});
+    EXPECT_EQ((vector<output_c_type>{0, 2, 0, 3, -8, 12, 6, -8, 18, 6, 0, -4}),
+              read_vector<output_c_type>(y));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, quantize_round_ties)
+{
+    Shape input_shape{8};
+    Shape scale_offset_shape;
+    AxisSet quantization_axes;
+
+    auto input_type = element::f32;
+    auto output_type = element::i8;
+
+    typedef float input_c_type;
+    typedef int8_t output_c_type;
+
+    op::Quantize::RoundMode round_mode = op::Quantize::RoundMode::ROUND_NEAREST_UPWARD;
+
+    auto X = make_shared<op::Parameter>(input_type, input_shape);
+    auto scale = op::Constant::create(input_type, scale_offset_shape, {1});
+    auto offset = op::Constant::create(output_type, scale_offset_shape, {0});
+    auto quantize =
+        make_shared<op::Quantize>(X, scale, offset, output_type, quantization_axes, round_mode);
+    auto f = make_shared<Function>(quantize, ParameterVector{X});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto x = backend->create_tensor(input_type, input_shape);
+    auto y = backend->create_tensor(output_type, input_shape);
+
+    // 0.49999997 is the float just below 0.5, which adding 0.5 in float would round up to 1.
+    // Like the reference, the rounding is done in double.
+    copy_data(x, vector<input_c_type>{0.49999997f, 0.5f, 1.5f, 2.5f, -0.5f, -1.5f, -2.5f, -0.25f});
+    // equals (rounded)               0            1     2     3     0      -1     -2     0
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({y}, {x});
+    EXPECT_EQ((vector<output_c_type>{0, 1, 2, 3, 0, -1, -2, 0}), read_vector<output_c_type>(y));
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, quantize_int8)
 {
     Shape input_shape{4, 3};
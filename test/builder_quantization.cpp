@@ -24,8 +24,11 @@
 #include "ngraph/builder/quantization.hpp"
 #include "ngraph/ngraph.hpp"
 #include "ngraph/op/constant.hpp"
+#include "ngraph/op/experimental/quantized_conv.hpp"
 #include "ngraph/pass/constant_folding.hpp"
+#include "ngraph/pass/calibrated_quantization.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "ngraph/runtime/calibrator.hpp"
 #include "util/all_close.hpp"
 #include "util/all_close_f.hpp"
 #include "util/ndarray.hpp"
@@ -1133,3 +1136,75 @@ TEST(builder, scaled_quantize_concat_signed)
     EXPECT_EQ((vector<int8_t>{-2, 4, 8, 16, -2, 2, 4, 8, 16, 15, -2, 3, 5, 7, 11, 16}),
               read_vector<int8_t>(result));
 }
+
+TEST(builder, calibrated_quantization_conv)
+{
+    Shape shape_a{1, 1, 3, 4};
+    Shape shape_b{1, 1, 2, 2};
+    Shape shape_r{1, 1, 2, 3};
+    auto A = make_shared<op::Parameter>(element::f32, shape_a);
+    auto B = op::Constant::create(element::f32, shape_b, {1.0f, -0.5f, 0.25f, 0.5f});
+    auto conv = make_shared<op::Convolution>(make_shared<op::Relu>(A), B);
+    auto f = make_shared<Function>(NodeVector{conv}, ParameterVector{A});
+    shared_ptr<runtime::Backend> backend = runtime::Backend::create("CPU");
+
+    vector<float> a_data{1, 2, 3, 4, 0, 1, 2, 3, 4, 3, 2, 1};
+    auto a = backend->create_tensor(element::f32, shape_a);
+    copy_data(a, a_data);
+    auto expected = backend->create_tensor(element::f32, shape_r);
+    backend->compile(f)->call_with_validate({expected}, {a});
+
+    runtime::Calibrator calibrator(backend);
+    auto table = calibrator.calibrate(f, {{a}});
+    ASSERT_EQ(table.size(), 2);
+    EXPECT_EQ(table[conv->get_argument(0)->get_name()].min, 0.0f);
+    EXPECT_EQ(table[conv->get_argument(0)->get_name()].max, 4.0f);
+
+    pass::CalibratedQuantization(table).run_on_function(f);
+    auto ops = f->get_ordered_ops();
+    EXPECT_EQ(count_if(ops.begin(),
+                       ops.end(),
+                       [](const shared_ptr<Node>& n) { return n->description() == "Convolution"; }),
+              0);
+
+    auto result = backend->create_tensor(element::f32, shape_r);
+    backend->compile(f)->call_with_validate({result}, {a});
+    EXPECT_TRUE(
+        test::all_close(read_vector<float>(expected), read_vector<float>(result), 0.05f, 0.05f));
+}
+
+TEST(builder, calibrated_quantization_folds_scales)
+{
+    Shape shape_a{1, 1, 3, 4};
+    Shape shape_b{1, 1, 2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape_a);
+    auto B = op::Constant::create(element::f32, shape_b, {1.0f, -0.5f, 0.25f, 0.5f});
+    auto conv = make_shared<op::Convolution>(make_shared<op::Relu>(A), B);
+    auto f = make_shared<Function>(NodeVector{conv}, ParameterVector{A});
+
+    runtime::CalibrationTable table;
+    table[conv->get_argument(0)->get_name()] = runtime::CalibrationRange{0.0f, 4.0f};
+    table[conv->get_name()] = runtime::CalibrationRange{-2.0f, 6.0f};
+    pass::CalibratedQuantization(table).run_on_function(f);
+
+    // The filters are quantized at compile time
+    auto ops = f->get_ordered_ops();
+    auto qconv = find_if(ops.begin(), ops.end(), [](const shared_ptr<Node>& n) {
+        return dynamic_pointer_cast<op::QuantizedConvolution>(n) != nullptr;
+    });
+    ASSERT_NE(qconv, ops.end());
+    auto filters = dynamic_pointer_cast<op::Constant>((*qconv)->get_argument(1));
+    ASSERT_NE(filters, nullptr);
+    EXPECT_EQ(filters->get_element_type(), element::i8);
+
+    // and so are the scales: only the quantized kernels are left to run
+    for (auto& node : ops)
+    {
+        EXPECT_TRUE(node->is_parameter() || node->is_constant() || node->is_output() ||
+                    dynamic_pointer_cast<op::Relu>(node) ||
+                    dynamic_pointer_cast<op::Quantize>(node) ||
+                    dynamic_pointer_cast<op::QuantizedConvolution>(node) ||
+                    dynamic_pointer_cast<op::Dequantize>(node))
+            << "unexpected " << node->get_name() << " after quantization";
+    }
+}
@@ -20,6 +20,7 @@
 #include "gtest/gtest.h"
 
 #include "ngraph/ngraph.hpp"
+#include "ngraph/strided_walk.hpp"
 #include "util/ndarray.hpp"
 #include "util/test_tools.hpp"
 
@@ -335,3 +336,53 @@ TEST(benchmark, coordinate)
     timer.stop();
     cout << "time: " << timer.get_milliseconds() << endl;
 }
+
+TEST(coordinate, strided_walk_collapses_dense_axes)
+{
+    Shape shape{2, 1, 3, 4};
+    StridedWalk<2> walk(shape, {{row_major_strides(shape), row_major_strides(shape)}});
+    EXPECT_EQ(walk.get_collapsed_rank(), 1);
+
+    vector<size_t> offsets;
+    walk([&](const array<size_t, 2>& o) {
+        EXPECT_EQ(o[0], o[1]);
+        offsets.push_back(o[0]);
+    });
+    vector<size_t> expected(shape_size(shape));
+    iota(expected.begin(), expected.end(), 0);
+    EXPECT_EQ(offsets, expected);
+}
+
+TEST(coordinate, strided_walk_matches_coordinate_transform)
+{
+    // Reduce axis 1 of a {2, 3, 4} tensor, starting from the second row
+    Shape shape{2, 3, 4};
+    AxisSet axes{1};
+    StridedWalk<2> walk(shape, {{row_major_strides(shape), projected_strides(shape, axes)}});
+    EXPECT_EQ(walk.get_collapsed_rank(), 3);
+
+    CoordinateTransform input_transform(shape);
+    CoordinateTransform output_transform(reduce(shape, axes));
+    auto it = input_transform.begin();
+    walk.walk({{4, 100}}, [&](const array<size_t, 2>& o) {
+        EXPECT_EQ(o[0], input_transform.index(*it) + 4);
+        EXPECT_EQ(o[1], output_transform.index(reduce(*it, axes)) + 100);
+        ++it;
+    });
+    EXPECT_FALSE(it != input_transform.end());
+}
+
+TEST(coordinate, strided_walk_empty_and_scalar)
+{
+    size_t count = 0;
+    StridedWalk<1> empty(Shape{2, 0, 3}, {{Strides{0, 3, 1}}});
+    empty([&](const array<size_t, 1>&) { count++; });
+    EXPECT_EQ(count, 0);
+
+    StridedWalk<1> scalar(Shape{}, {{Strides{}}});
+    scalar([&](const array<size_t, 1>& o) {
+        EXPECT_EQ(o[0], 0);
+        count++;
+    });
+    EXPECT_EQ(count, 1);
+}
@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include "gtest/gtest.h"
+#include "ngraph/codegen/code_cache.hpp"
 #include "ngraph/ngraph.hpp"
 #include "util/all_close.hpp"
 #include "util/ndarray.hpp"
@@ -56,3 +57,47 @@ TEST(cpu_codegen, abc)
     EXPECT_EQ(read_vector<float>(result),
               (test::NDArray<float, 2>({{50, 72}, {98, 128}})).get_vector());
 }
+
+TEST(cpu_codegen, op_function_units)
+{
+    // Ops on tensors of decreasing size have distinct code, enough to spread the op functions
+    // over several units
+    const size_t size = 24;
+    auto make_function = [&]() {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{size});
+        auto B = make_shared<op::Parameter>(element::f32, Shape{size});
+        shared_ptr<Node> x = A;
+        for (size_t n = size; n > 0; n--)
+        {
+            auto x_slice = make_shared<op::Slice>(x, Coordinate{0}, Coordinate{n});
+            auto b_slice = make_shared<op::Slice>(B, Coordinate{0}, Coordinate{n});
+            x = n % 2 == 0 ? x_slice + b_slice : x_slice * b_slice;
+        }
+        return make_shared<Function>(x, ParameterVector{A, B});
+    };
+
+    auto backend = runtime::Backend::create("CPU");
+    shared_ptr<runtime::Tensor> a = backend->create_tensor(element::f32, Shape{size});
+    shared_ptr<runtime::Tensor> b = backend->create_tensor(element::f32, Shape{size});
+    shared_ptr<runtime::Tensor> result = backend->create_tensor(element::f32, Shape{1});
+    copy_data(a, vector<float>(size, 1));
+    copy_data(b, vector<float>(size, 2));
+    float expected = 1;
+    for (size_t n = size; n > 0; n--)
+    {
+        expected = n % 2 == 0 ? expected + 2 : expected * 2;
+    }
+
+    // The op functions of an identical graph are named alike, so its op function units all
+    // come from the code cache when it is compiled again
+    ngraph::pass::PassConfig pass_config{ngraph::pass::CompilationMode::CODEGEN};
+    auto handle = backend->compile(make_function(), pass_config);
+    handle->call_with_validate({result}, {a, b});
+    EXPECT_EQ(read_vector<float>(result), (vector<float>{expected}));
+
+    size_t hits = codegen::CodeCache::get().get_module_hit_count();
+    handle = backend->compile(make_function(), pass_config);
+    handle->call_with_validate({result}, {a, b});
+    EXPECT_EQ(read_vector<float>(result), (vector<float>{expected}));
+    EXPECT_GE(codegen::CodeCache::get().get_module_hit_count() - hits, 2);
+}
@@ -67,6 +67,7 @@
 #include "ngraph/runtime/cpu/op/loop_kernel.hpp"
 #include "ngraph/runtime/cpu/op/lstm.hpp"
 #include "ngraph/runtime/cpu/op/matmul_bias.hpp"
+#include "ngraph/runtime/cpu/op/optimizer_update.hpp"
 #include "ngraph/runtime/cpu/op/rnn.hpp"
 #include "ngraph/runtime/cpu/op/rnn_utils.hpp"
 #include "ngraph/runtime/cpu/op/sigmoid_mul.hpp"
@@ -2248,6 +2249,254 @@ TEST(cpu_fusion, rnn_fprop_1_lstm_cell)
     EXPECT_TRUE(test::all_close(expected_ct, read_vector<float>(result_ct)));
 }
 
+TEST(cpu_fusion, rnn_fprop_variable_length)
+{
+    // Every sample of a ragged batch gets the result of an rnn over just its valid timesteps
+    const size_t max_steps = 4;
+    const size_t batch = 3;
+    const size_t feature_size = 8;
+    const size_t gates = 4;
+    const size_t states = 2;
+    vector<int32_t> lengths{4, 1, 3};
+    auto rnn_type = ngraph::runtime::cpu::rnn_utils::rnntype::vanilla_lstm;
+
+    auto run_rnn = [&](size_t steps, size_t n, const vector<vector<float>>& inputs) {
+        auto src_layer = make_shared<op::Parameter>(element::f32, Shape{steps * n, feature_size});
+        auto src_iter = make_shared<op::Parameter>(element::f32, Shape{states * n, feature_size});
+        auto weights_layer =
+            make_shared<op::Parameter>(element::f32, Shape{feature_size, gates * feature_size});
+        auto weights_iter =
+            make_shared<op::Parameter>(element::f32, Shape{feature_size, gates * feature_size});
+        auto bias = make_shared<op::Parameter>(element::f32, Shape{gates * feature_size});
+        ParameterVector params{src_layer, src_iter, weights_layer, weights_iter, bias};
+        shared_ptr<op::Rnn> rnn;
+        if (n == batch)
+        {
+            auto sequence_lengths = op::Constant::create(element::i32, Shape{batch}, lengths);
+            rnn = make_shared<op::Rnn>(src_layer,
+                                       src_iter,
+                                       weights_layer,
+                                       weights_iter,
+                                       bias,
+                                       sequence_lengths,
+                                       steps,
+                                       gates,
+                                       steps,
+                                       states,
+                                       1,
+                                       1,
+                                       rnn_type);
+        }
+        else
+        {
+            rnn = make_shared<op::Rnn>(src_layer,
+                                       src_iter,
+                                       weights_layer,
+                                       weights_iter,
+                                       bias,
+                                       steps,
+                                       gates,
+                                       steps,
+                                       states,
+                                       1,
+                                       1,
+                                       rnn_type);
+        }
+        auto f = make_shared<Function>(NodeVector{make_shared<op::GetOutputElement>(rnn, 0),
+                                                  make_shared<op::GetOutputElement>(rnn, 1)},
+                                       params);
+        return execute(f, inputs, "CPU");
+    };
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<float> src_layer(max_steps * batch * feature_size);
+    vector<float> src_iter(states * batch * feature_size);
+    vector<float> weights_layer(feature_size * gates * feature_size);
+    vector<float> weights_iter(feature_size * gates * feature_size);
+    vector<float> bias(gates * feature_size);
+    for (auto data : {&src_layer, &src_iter, &weights_layer, &weights_iter, &bias})
+    {
+        rng.initialize(*data);
+    }
+    auto results =
+        run_rnn(max_steps, batch, {src_layer, src_iter, weights_layer, weights_iter, bias});
+
+    auto row = [&](const vector<float>& data, size_t index) {
+        return vector<float>(data.begin() + index * feature_size,
+                             data.begin() + (index + 1) * feature_size);
+    };
+    for (size_t n = 0; n < batch; n++)
+    {
+        size_t length = lengths[n];
+        vector<float> sample_layer;
+        for (size_t t = 0; t < length; t++)
+        {
+            auto x = row(src_layer, t * batch + n);
+            sample_layer.insert(sample_layer.end(), x.begin(), x.end());
+        }
+        vector<float> sample_iter;
+        for (size_t s = 0; s < states; s++)
+        {
+            auto h = row(src_iter, s * batch + n);
+            sample_iter.insert(sample_iter.end(), h.begin(), h.end());
+        }
+        auto expected =
+            run_rnn(length, 1, {sample_layer, sample_iter, weights_layer, weights_iter, bias});
+        for (size_t t = 0; t < max_steps; t++)
+        {
+            auto ht = row(results.at(0), t * batch + n);
+            if (t < length)
+            {
+                EXPECT_TRUE(test::all_close(row(expected.at(0), t), ht, 1.0e-4f, 1.0e-4f));
+            }
+            else
+            {
+                EXPECT_EQ(ht, vector<float>(feature_size, 0));
+            }
+        }
+        for (size_t s = 0; s < states; s++)
+        {
+            EXPECT_TRUE(test::all_close(
+                row(expected.at(1), s), row(results.at(1), s * batch + n), 1.0e-4f, 1.0e-4f));
+        }
+    }
+}
+
+TEST(cpu_fusion, rnn_fprop_variable_length_bidirectional)
+{
+    // The right to left direction of each sample starts at its last valid timestep
+    const size_t max_steps = 4;
+    const size_t batch = 3;
+    const size_t feature_size = 8;
+    const size_t gates = 4;
+    const size_t states = 2;
+    const size_t directions = 2;
+    vector<int32_t> lengths{2, 4, 3};
+    auto rnn_type = ngraph::runtime::cpu::rnn_utils::rnntype::vanilla_lstm;
+
+    auto src_layer =
+        make_shared<op::Parameter>(element::f32, Shape{max_steps * batch, feature_size});
+    auto src_iter =
+        make_shared<op::Parameter>(element::f32, Shape{directions * states * batch, feature_size});
+    auto weights_layer = make_shared<op::Parameter>(
+        element::f32, Shape{directions * feature_size, gates * feature_size});
+    auto weights_iter = make_shared<op::Parameter>(
+        element::f32, Shape{directions * feature_size, gates * feature_size});
+    auto bias = make_shared<op::Parameter>(element::f32, Shape{directions * gates * feature_size});
+    auto sequence_lengths = op::Constant::create(element::i32, Shape{batch}, lengths);
+    auto rnn = make_shared<op::Rnn>(src_layer,
+                                    src_iter,
+                                    weights_layer,
+                                    weights_iter,
+                                    bias,
+                                    sequence_lengths,
+                                    max_steps,
+                                    gates,
+                                    max_steps,
+                                    states,
+                                    directions,
+                                    1,
+                                    rnn_type);
+    auto f = make_shared<Function>(
+        NodeVector{make_shared<op::GetOutputElement>(rnn, 0),
+                   make_shared<op::GetOutputElement>(rnn, 1)},
+        ParameterVector{src_layer, src_iter, weights_layer, weights_iter, bias});
+
+    // A single sample and direction through the fixed length, left to right rnn
+    auto run_reference = [&](size_t steps, const vector<vector<float>>& inputs) {
+        auto ref_src_layer = make_shared<op::Parameter>(element::f32, Shape{steps, feature_size});
+        auto ref_src_iter = make_shared<op::Parameter>(element::f32, Shape{states, feature_size});
+        auto ref_weights_layer =
+            make_shared<op::Parameter>(element::f32, Shape{feature_size, gates * feature_size});
+        auto ref_weights_iter =
+            make_shared<op::Parameter>(element::f32, Shape{feature_size, gates * feature_size});
+        auto ref_bias = make_shared<op::Parameter>(element::f32, Shape{gates * feature_size});
+        auto ref_rnn = make_shared<op::Rnn>(ref_src_layer,
+                                            ref_src_iter,
+                                            ref_weights_layer,
+                                            ref_weights_iter,
+                                            ref_bias,
+                                            steps,
+                                            gates,
+                                            steps,
+                                            states,
+                                            1,
+                                            1,
+                                            rnn_type);
+        auto ref_f = make_shared<Function>(
+            NodeVector{make_shared<op::GetOutputElement>(ref_rnn, 0),
+                       make_shared<op::GetOutputElement>(ref_rnn, 1)},
+            ParameterVector{
+                ref_src_layer, ref_src_iter, ref_weights_layer, ref_weights_iter, ref_bias});
+        return execute(ref_f, inputs, "CPU");
+    };
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (auto& param : f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto results = execute(f, args, "CPU");
+
+    auto rows = [&](const vector<float>& data, size_t index, size_t count) {
+        return vector<float>(data.begin() + index * feature_size,
+                             data.begin() + (index + count) * feature_size);
+    };
+    for (size_t d = 0; d < directions; d++)
+    {
+        auto direction_weights_layer = rows(args[2], d * feature_size, feature_size);
+        auto direction_weights_iter = rows(args[3], d * feature_size, feature_size);
+        vector<float> direction_bias(args[4].begin() + d * gates * feature_size,
+                                     args[4].begin() + (d + 1) * gates * feature_size);
+        for (size_t n = 0; n < batch; n++)
+        {
+            size_t length = lengths[n];
+            auto time_step = [&](size_t t) { return d == 0 ? t : length - 1 - t; };
+            vector<float> sample_layer;
+            for (size_t t = 0; t < length; t++)
+            {
+                auto x = rows(args[0], time_step(t) * batch + n, 1);
+                sample_layer.insert(sample_layer.end(), x.begin(), x.end());
+            }
+            vector<float> sample_iter;
+            for (size_t s = 0; s < states; s++)
+            {
+                auto h = rows(args[1], (d * states + s) * batch + n, 1);
+                sample_iter.insert(sample_iter.end(), h.begin(), h.end());
+            }
+            auto expected = run_reference(length,
+                                          {sample_layer,
+                                           sample_iter,
+                                           direction_weights_layer,
+                                           direction_weights_iter,
+                                           direction_bias});
+            for (size_t t = 0; t < max_steps; t++)
+            {
+                auto ht = rows(results.at(0), (t * batch + n) * directions + d, 1);
+                if (t < length)
+                {
+                    EXPECT_TRUE(test::all_close(
+                        rows(expected.at(0), time_step(t), 1), ht, 1.0e-4f, 1.0e-4f));
+                }
+                else
+                {
+                    EXPECT_EQ(ht, vector<float>(feature_size, 0));
+                }
+            }
+            for (size_t s = 0; s < states; s++)
+            {
+                EXPECT_TRUE(test::all_close(rows(expected.at(1), s, 1),
+                                            rows(results.at(1), (d * states + s) * batch + n, 1),
+                                            1.0e-4f,
+                                            1.0e-4f));
+            }
+        }
+    }
+}
+
 TEST(cpu_fusion, fuse_lstm_cells)
 {
     pass::Manager pass_manager;
@@ -3305,6 +3554,148 @@ TEST(cpu_fusion, fuse_update_slice_strided)
     }
 }
 
+TEST(cpu_fusion, fuse_sgd_momentum_update)
+{
+    auto make_function = [](float momentum_value) {
+        Shape shape{4, 37};
+        auto weights = std::make_shared<op::Parameter>(element::f32, shape);
+        auto velocity = std::make_shared<op::Parameter>(element::f32, shape);
+        auto gradient = std::make_shared<op::Parameter>(element::f32, shape);
+        auto learning_rate = std::make_shared<op::Parameter>(element::f32, Shape{});
+        auto momentum = std::make_shared<op::Broadcast>(
+            op::Constant::create(element::f32, Shape{}, {momentum_value}), shape, AxisSet{0, 1});
+        auto velocity_update = std::make_shared<op::Add>(
+            std::make_shared<op::Multiply>(momentum, velocity), gradient);
+        auto weights_update = std::make_shared<op::Subtract>(
+            weights,
+            std::make_shared<op::Multiply>(
+                std::make_shared<op::Broadcast>(learning_rate, shape, AxisSet{0, 1}),
+                velocity_update));
+        return make_shared<Function>(NodeVector{weights_update, velocity_update},
+                                     ParameterVector{weights, velocity, gradient, learning_rate});
+    };
+
+    auto int_f = make_function(0.9f);
+    auto cpu_f = make_function(0.9f);
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : int_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "CPU");
+    EXPECT_EQ(1, count_ops_of_type<op::SGDMomentumUpdate>(cpu_f));
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i)));
+    }
+}
+
+TEST(cpu_fusion, fuse_adam_update)
+{
+    auto make_function = [](float beta1_value, float beta1_complement_value) {
+        Shape shape{4, 37};
+        auto weights = std::make_shared<op::Parameter>(element::f32, shape);
+        auto m = std::make_shared<op::Parameter>(element::f32, shape);
+        auto v = std::make_shared<op::Parameter>(element::f32, shape);
+        auto gradient = std::make_shared<op::Parameter>(element::f32, shape);
+        auto learning_rate = std::make_shared<op::Parameter>(element::f32, Shape{});
+        auto scalar = [&](float value) {
+            return std::make_shared<op::Broadcast>(
+                op::Constant::create(element::f32, Shape{}, {value}), shape, AxisSet{0, 1});
+        };
+        auto m_update = std::make_shared<op::Add>(
+            std::make_shared<op::Multiply>(scalar(beta1_value), m),
+            std::make_shared<op::Multiply>(scalar(beta1_complement_value), gradient));
+        auto v_update = std::make_shared<op::Add>(
+            std::make_shared<op::Multiply>(scalar(0.999f), v),
+            std::make_shared<op::Multiply>(scalar(0.001f),
+                                           std::make_shared<op::Multiply>(gradient, gradient)));
+        auto step = std::make_shared<op::Divide>(
+            std::make_shared<op::Multiply>(
+                std::make_shared<op::Broadcast>(learning_rate, shape, AxisSet{0, 1}), m_update),
+            std::make_shared<op::Add>(std::make_shared<op::Sqrt>(v_update), scalar(1e-8f)));
+        auto weights_update = std::make_shared<op::Subtract>(weights, step);
+        return make_shared<Function>(NodeVector{weights_update, m_update, v_update},
+                                     ParameterVector{weights, m, v, gradient, learning_rate});
+    };
+
+    // The gradient scale must be the complement of beta1
+    auto no_fuse = make_function(0.9f, 0.2f);
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUFusion>();
+    pass_manager.run_passes(no_fuse);
+    EXPECT_EQ(0, count_ops_of_type<op::AdamUpdate>(no_fuse));
+
+    auto int_f = make_function(0.9f, 0.1f);
+    auto cpu_f = make_function(0.9f, 0.1f);
+
+    test::Uniform<float> rng(0.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : int_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "CPU");
+    EXPECT_EQ(1, count_ops_of_type<op::AdamUpdate>(cpu_f));
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1.0e-4f, 1.0e-5f));
+    }
+}
+
+TEST(cpu_fusion, sgd_momentum_update_inplace)
+{
+    Shape shape{3, 1000};
+    auto weights = std::make_shared<op::Parameter>(element::f32, shape);
+    auto velocity = std::make_shared<op::Parameter>(element::f32, shape);
+    auto gradient = std::make_shared<op::Parameter>(element::f32, shape);
+    auto learning_rate = std::make_shared<op::Parameter>(element::f32, Shape{});
+    auto update =
+        std::make_shared<op::SGDMomentumUpdate>(weights, velocity, gradient, learning_rate, 0.5f);
+    auto f = make_shared<Function>(NodeVector{std::make_shared<op::GetOutputElement>(update, 0),
+                                              std::make_shared<op::GetOutputElement>(update, 1)},
+                                   ParameterVector{weights, velocity, gradient, learning_rate});
+
+    auto backend = runtime::Backend::create("CPU");
+    size_t count = shape_size(shape);
+    vector<float> w(count), v(count), g(count);
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    rng.initialize(w);
+    rng.initialize(v);
+    rng.initialize(g);
+    auto w_tensor = backend->create_tensor(element::f32, shape);
+    auto v_tensor = backend->create_tensor(element::f32, shape);
+    auto g_tensor = backend->create_tensor(element::f32, shape);
+    auto lr_tensor = backend->create_tensor(element::f32, Shape{});
+    copy_data(w_tensor, w);
+    copy_data(v_tensor, v);
+    copy_data(g_tensor, g);
+    copy_data(lr_tensor, vector<float>{0.1f});
+
+    // The weights and velocity are updated in the tensors they are read from
+    auto handle = backend->compile(f);
+    for (size_t step = 0; step < 2; step++)
+    {
+        handle->call_with_validate({w_tensor, v_tensor},
+                                   {w_tensor, v_tensor, g_tensor, lr_tensor});
+        for (size_t i = 0; i < count; i++)
+        {
+            v[i] = 0.5f * v[i] + g[i];
+            w[i] = w[i] - 0.1f * v[i];
+        }
+    }
+    EXPECT_TRUE(test::all_close(read_vector<float>(w_tensor), w));
+    EXPECT_TRUE(test::all_close(read_vector<float>(v_tensor), v));
+}
+
 TEST(cpu_fusion, fuse_update_slice_strided_inplace)
 {
     auto make_function = [](bool fuse = true) {
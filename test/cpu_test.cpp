@@ -15,10 +15,14 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cstdio>
+#include <fstream>
 #include <iostream>
 #include <list>
 #include <memory>
+#include <thread>
 
 #include "gtest/gtest.h"
 #include "misc.hpp"
@@ -33,7 +37,15 @@
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
 #include "ngraph/runtime/cpu/cpu_backend.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/cpu/cpu_kernel_tuner.hpp"
+#include "ngraph/runtime/cpu/cpu_topology.hpp"
+#include "ngraph/runtime/cpu/mkldnn_primitive_cache.hpp"
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
+#include "ngraph/runtime/cpu/op/dot_f16_weights.hpp"
+#include "ngraph/runtime/cpu/op/grouped_matmul.hpp"
+#include "ngraph/runtime/cpu/op/matmul_bias.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_matmul_horizontal_fusion.hpp"
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
 #include "nlohmann/json.hpp"
@@ -647,6 +659,140 @@ TEST(cpu_test, mkldnn_layouts_eltwise)
     compare_backends(int_f, cpu_f, "INTERPRETER", "CPU");
 }
 
+TEST(cpu_test, mkldnn_layouts_eltwise_cost)
+{
+    // The multiply takes the blocked layout of its second argument, which the following
+    // convolution consumes as is, instead of the native layout of its first one
+    auto make_function = []() -> std::shared_ptr<Function> {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{1, 16, 8, 8});
+        auto B = make_shared<op::Parameter>(element::f32, Shape{1, 16, 8, 8});
+        auto W1 = make_shared<op::Parameter>(element::f32, Shape{16, 16, 3, 3});
+        auto W2 = make_shared<op::Parameter>(element::f32, Shape{16, 16, 3, 3});
+        auto conv1 = make_shared<op::Convolution>(A,
+                                                  W1,
+                                                  Strides{1, 1},
+                                                  Strides{1, 1},
+                                                  CoordinateDiff{1, 1},
+                                                  CoordinateDiff{1, 1},
+                                                  Strides{1, 1});
+        auto multiply = make_shared<op::Multiply>(B, conv1);
+        auto conv2 = make_shared<op::Convolution>(multiply,
+                                                  W2,
+                                                  Strides{1, 1},
+                                                  Strides{1, 1},
+                                                  CoordinateDiff{1, 1},
+                                                  CoordinateDiff{1, 1},
+                                                  Strides{1, 1});
+        return make_shared<Function>(NodeVector{conv2}, ParameterVector{A, B, W1, W2});
+    };
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : make_function()->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+
+    auto int_f = make_function();
+    auto int_results = execute(int_f, args, "INTERPRETER");
+
+    auto cpu_f = make_function();
+    auto cpu_results = execute(cpu_f, args, "CPU");
+    EXPECT_TRUE(test::all_close(cpu_results.at(0), int_results.at(0), 1.0e-4f, 1.0e-4f));
+
+    // Always take the layout of the first argument, as the pass used to
+    set_environment("NGRAPH_PASS_CPU_LAYOUT_ELTWISE", "0", 1);
+    auto first_arg_f = make_function();
+    auto first_arg_results = execute(first_arg_f, args, "CPU");
+    unset_environment("NGRAPH_PASS_CPU_LAYOUT_ELTWISE");
+    EXPECT_TRUE(test::all_close(first_arg_results.at(0), int_results.at(0), 1.0e-4f, 1.0e-4f));
+
+    // Reordering B alone, instead of the result of conv1 and then the input of conv2
+    EXPECT_LT(count_ops_of_type<runtime::cpu::op::ConvertLayout>(cpu_f),
+              count_ops_of_type<runtime::cpu::op::ConvertLayout>(first_arg_f));
+}
+
+TEST(cpu_test, mkldnn_layouts_shared_across_executables)
+{
+    Shape data_shape{1, 16, 8, 8};
+    Shape filter_shape{16, 16, 3, 3};
+    auto make_conv = [](const shared_ptr<Node>& data, const shared_ptr<Node>& filters) {
+        return make_shared<op::Convolution>(data,
+                                            filters,
+                                            Strides{1, 1},
+                                            Strides{1, 1},
+                                            CoordinateDiff{1, 1},
+                                            CoordinateDiff{1, 1},
+                                            Strides{1, 1});
+    };
+
+    auto A = make_shared<op::Parameter>(element::f32, data_shape);
+    auto W1 = make_shared<op::Parameter>(element::f32, filter_shape);
+    auto encoder = make_shared<Function>(make_conv(A, W1), ParameterVector{A, W1});
+
+    auto make_decoder = [&]() {
+        auto H = make_shared<op::Parameter>(element::f32, data_shape);
+        auto W2 = make_shared<op::Parameter>(element::f32, filter_shape);
+        return make_shared<Function>(make_conv(H, W2), ParameterVector{H, W2});
+    };
+    auto decoder = make_decoder();
+    auto native_decoder = make_decoder();
+
+    auto backend = runtime::Backend::create("CPU");
+    auto encoder_exec = backend->compile(encoder);
+    static_pointer_cast<runtime::cpu::CPU_Executable>(encoder_exec)
+        ->share_result_layout(0, decoder->get_parameters().at(0));
+    auto decoder_exec = backend->compile(decoder);
+    backend->compile(native_decoder);
+
+    // The decoder consumes the blocked encoder output without converting it first
+    EXPECT_LT(count_ops_of_type<runtime::cpu::op::ConvertLayout>(decoder),
+              count_ops_of_type<runtime::cpu::op::ConvertLayout>(native_decoder));
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<float> a_data(shape_size(data_shape));
+    vector<float> w1_data(shape_size(filter_shape));
+    vector<float> w2_data(shape_size(filter_shape));
+    rng.initialize(a_data);
+    rng.initialize(w1_data);
+    rng.initialize(w2_data);
+
+    auto ref_A = make_shared<op::Parameter>(element::f32, data_shape);
+    auto ref_W1 = make_shared<op::Parameter>(element::f32, filter_shape);
+    auto ref_W2 = make_shared<op::Parameter>(element::f32, filter_shape);
+    auto ref_f = make_shared<Function>(make_conv(make_conv(ref_A, ref_W1), ref_W2),
+                                       ParameterVector{ref_A, ref_W1, ref_W2});
+    vector<vector<float>> args{a_data, w1_data, w2_data};
+    auto ref_results = execute(ref_f, args, "INTERPRETER");
+
+    auto a = backend->create_tensor(element::f32, data_shape);
+    auto w1 = backend->create_tensor(element::f32, filter_shape);
+    auto w2 = backend->create_tensor(element::f32, filter_shape);
+    auto h = backend->create_tensor(element::f32, data_shape);
+    auto result = backend->create_tensor(element::f32, data_shape);
+    copy_data(a, a_data);
+    copy_data(w1, w1_data);
+    copy_data(w2, w2_data);
+
+    encoder_exec->call_with_validate({h}, {a, w1});
+    decoder_exec->call_with_validate({result}, {h, w2});
+    EXPECT_TRUE(test::all_close(read_vector<float>(result), ref_results.at(0), 1.0e-4f, 1.0e-4f));
+
+    // Row-major data written from the host is reordered to the shared layout on the way in
+    copy_data(h, read_vector<float>(h));
+    decoder_exec->call_with_validate({result}, {h, w2});
+    EXPECT_TRUE(test::all_close(read_vector<float>(result), ref_results.at(0), 1.0e-4f, 1.0e-4f));
+
+    // A partial write over a blocked output keeps the elements it does not cover
+    encoder_exec->call_with_validate({h}, {a, w1});
+    auto h_data = read_vector<float>(h);
+    h_data[1] = 2.0f;
+    h->write(&h_data[1], sizeof(float), sizeof(float));
+    EXPECT_EQ(read_vector<float>(h), h_data);
+}
+
 TEST(cpu_test, convolution_large_padding)
 {
     Shape input_shape{1, 1, 100, 100};
@@ -670,6 +816,154 @@ TEST(cpu_test, convolution_large_padding)
     compare_backends(int_f, cpu_f, "INTERPRETER", "CPU", 1e-4, 1e-4);
 }
 
+TEST(cpu_test, mkldnn_primitive_cache)
+{
+    auto& cache = runtime::cpu::MKLDNNPrimitiveCache::get();
+    mkldnn::memory::desc md({2, 3}, mkldnn::memory::data_type::f32, mkldnn::memory::format::nc);
+    auto input = new mkldnn::memory({md, runtime::cpu::executor::global_cpu_engine}, nullptr);
+    auto result = new mkldnn::memory({md, runtime::cpu::executor::global_cpu_engine}, nullptr);
+    auto reorder = new mkldnn::reorder(*input, *result);
+
+    string key = "cpu_test";
+    runtime::cpu::MKLDNNPrimitiveCache::append_key(key, md.data);
+    auto entry = cache.insert(key, reorder, {input, result});
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(cache.find(key), entry);
+    EXPECT_EQ(entry->primitive, reorder);
+    EXPECT_EQ(entry->memory, (vector<mkldnn::primitive*>{input, result}));
+    entry.reset();
+    EXPECT_EQ(cache.find(key), nullptr);
+
+    // Executables with identical convolutions share them and still see their own tensors
+    Shape input_shape{2, 3, 8, 8};
+    Shape filter_shape{4, 3, 3, 3};
+    auto make_function = [&]() {
+        auto input = make_shared<op::Parameter>(element::f32, input_shape);
+        auto filter = make_shared<op::Parameter>(element::f32, filter_shape);
+        auto conv = make_shared<op::Convolution>(input, filter);
+        return make_shared<Function>(NodeVector{conv}, ParameterVector{input, filter});
+    };
+
+    auto backend = runtime::Backend::create("CPU");
+    auto f = make_function();
+    auto a = backend->create_tensor(element::f32, input_shape);
+    auto b = backend->create_tensor(element::f32, filter_shape);
+    auto conv_result = backend->create_tensor(element::f32, f->get_output_shape(0));
+    vector<float> a_data(shape_size(input_shape));
+    vector<float> b_data(shape_size(filter_shape));
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    rng.initialize(a_data);
+    rng.initialize(b_data);
+    copy_data(a, a_data);
+    copy_data(b, b_data);
+    auto handle = backend->compile(f);
+    handle->call_with_validate({conv_result}, {a, b});
+    auto expected = read_vector<float>(conv_result);
+
+    // The second executable binds the convolution the first one built
+    size_t hits = cache.get_hit_count();
+    auto int_f = make_function();
+    auto cpu_f = make_function();
+    compare_backends(int_f, cpu_f, "INTERPRETER", "CPU", 1e-4, 1e-4);
+    EXPECT_GT(cache.get_hit_count(), hits);
+
+    handle->call_with_validate({conv_result}, {a, b});
+    EXPECT_EQ(read_vector<float>(conv_result), expected);
+}
+
+TEST(cpu_test, warmup)
+{
+    Shape shape_a{2, 16, 8, 8};
+    Shape shape_b{16, 16, 3, 3};
+    auto make_function = [&]() {
+        auto A = make_shared<op::Parameter>(element::f32, shape_a);
+        auto B = make_shared<op::Parameter>(element::f32, shape_b);
+        auto conv = make_shared<op::Convolution>(A, B);
+        return make_shared<Function>(make_shared<op::Relu>(conv), ParameterVector{A, B});
+    };
+
+    auto backend = runtime::Backend::create("CPU");
+    auto int_f = make_function();
+    auto cpu_f = make_function();
+    auto handle = backend->compile(cpu_f);
+    handle->warmup(true);
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    vector<shared_ptr<runtime::Tensor>> inputs;
+    for (auto& param : cpu_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+        auto tensor = backend->create_tensor(element::f32, param->get_shape());
+        copy_data(tensor, tensor_val);
+        // Inputs of the first call are fresh even when the caller says otherwise
+        tensor->set_stale(false);
+        inputs.push_back(tensor);
+    }
+    auto result = backend->create_tensor(element::f32, cpu_f->get_output_shape(0));
+    handle->call_with_validate({result}, inputs);
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    EXPECT_TRUE(test::all_close(read_vector<float>(result), int_results.at(0), 1e-4f, 1e-4f));
+}
+
+TEST(cpu_test, warmup_integer_divide)
+{
+    // Synthetic inputs must not make integer divisions trap
+    Shape shape{4};
+    auto A = make_shared<op::Parameter>(element::i32, shape);
+    auto B = make_shared<op::Parameter>(element::i32, shape);
+    auto f = make_shared<Function>(make_shared<op::Divide>(A, B), ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("CPU");
+    auto handle = backend->compile(f);
+    handle->warmup();
+
+    auto a = backend->create_tensor(element::i32, shape);
+    auto b = backend->create_tensor(element::i32, shape);
+    auto result = backend->create_tensor(element::i32, shape);
+    copy_data(a, vector<int32_t>{8, 9, -12, 7});
+    copy_data(b, vector<int32_t>{2, 3, 4, -7});
+    handle->call_with_validate({result}, {a, b});
+    EXPECT_EQ(read_vector<int32_t>(result), (vector<int32_t>{4, 3, -3, -1}));
+}
+
+TEST(cpu_test, weight_sharing)
+{
+    // Executables compiled from copies of a model share the converted weights
+    Shape filter_shape{16, 16, 3, 3};
+    vector<float> weights(shape_size(filter_shape));
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    rng.initialize(weights);
+    auto make_function = [&]() {
+        auto input = make_shared<op::Parameter>(element::f32, Shape{2, 16, 8, 8});
+        auto filter = op::Constant::create(element::f32, filter_shape, weights);
+        auto conv = make_shared<op::Convolution>(input, filter);
+        return make_shared<Function>(NodeVector{conv}, ParameterVector{input});
+    };
+
+    auto backend = runtime::Backend::create("CPU");
+    vector<shared_ptr<Function>> functions{make_function(), make_function()};
+    vector<const void*> filter_data;
+    for (auto& f : functions)
+    {
+        auto int_f = make_function();
+        compare_backends(int_f, f, "INTERPRETER", "CPU", 1e-4, 1e-4);
+        for (auto& node : f->get_ordered_ops())
+        {
+            if (dynamic_pointer_cast<op::Convolution>(node))
+            {
+                auto filter = dynamic_pointer_cast<op::Constant>(node->get_argument(1));
+                ASSERT_NE(filter, nullptr);
+                filter_data.push_back(filter->get_data_ptr());
+            }
+        }
+    }
+    ASSERT_EQ(filter_data.size(), 2);
+    EXPECT_EQ(filter_data[0], filter_data[1]);
+}
+
 #if 0
 static std::shared_ptr<Function> make_function(const std::string& file_name)
 {
@@ -919,3 +1213,379 @@ TEST(cpu_test, rotated_pooling)
     compare_backends(
         make_f(false, false), make_f(false, false), "INTERPRETER", "CPU"); // 5D MaxPool
 }
+
+TEST(cpu_test, numa_topology)
+{
+    EXPECT_EQ(runtime::cpu::parse_cpu_list("0-2,5,7-8\n"), (vector<int>{0, 1, 2, 5, 7, 8}));
+    EXPECT_EQ(runtime::cpu::parse_cpu_list(""), vector<int>{});
+
+    // Two nodes of two cores with two hyperthreads each, CPU 7 offline
+    string root = file_util::path_join(file_util::get_temp_directory_path(), "numa_topology");
+    file_util::remove_directory(root);
+    auto write = [&](const string& path, const string& contents) {
+        string directory = root;
+        file_util::make_directory(directory);
+        for (const string& name : split(file_util::get_directory(path), '/'))
+        {
+            directory = file_util::path_join(directory, name);
+            file_util::make_directory(directory);
+        }
+        ofstream(file_util::path_join(root, path)) << contents;
+    };
+    write("cpu/online", "0-6\n");
+    for (int cpu = 0; cpu < 8; cpu++)
+    {
+        string topology = "cpu/cpu" + to_string(cpu) + "/topology/";
+        write(topology + "physical_package_id", to_string(cpu % 4 < 2 ? 0 : 1));
+        write(topology + "core_id", to_string(cpu % 2));
+    }
+
+    // Without NUMA nodes the sockets are used
+    auto sockets = runtime::cpu::get_numa_topology(root);
+    ASSERT_EQ(sockets.size(), 2);
+    EXPECT_EQ(sockets[0].id, 0);
+    EXPECT_EQ(sockets[0].cpus, (vector<int>{0, 1}));
+    EXPECT_EQ(sockets[1].id, 1);
+    EXPECT_EQ(sockets[1].cpus, (vector<int>{2, 3}));
+
+    write("node/node0/cpulist", "0-1,4-5\n");
+    write("node/node1/cpulist", "2-3,6-7\n");
+    auto nodes = runtime::cpu::get_numa_topology(root);
+    ASSERT_EQ(nodes.size(), 2);
+    EXPECT_EQ(nodes[0].cpus, (vector<int>{0, 1}));
+    EXPECT_EQ(nodes[1].cpus, (vector<int>{2, 3}));
+
+    file_util::remove_directory(root);
+    EXPECT_TRUE(runtime::cpu::get_numa_topology(root).empty());
+}
+
+TEST(cpu_test, priority_scheduling)
+{
+    using runtime::cpu::ExecutionPriority;
+    using ScheduledCall = runtime::cpu::executor::CPUExecutor::ScheduledCall;
+    auto& cpu_executor = runtime::cpu::executor::GetCPUExecutor();
+
+    EXPECT_EQ(cpu_executor.get_device_index(0, 0), 0);
+    EXPECT_EQ(cpu_executor.get_device(cpu_executor.get_device_index(0, 1)).numThreads(), 1);
+
+    // Low-priority ops wait while a high-priority call holds the cores
+    atomic<bool> low_priority_ran{false};
+    thread low_priority;
+    {
+        ScheduledCall high_priority_call(cpu_executor, ExecutionPriority::HIGH, 0);
+        low_priority = thread([&]() {
+            cpu_executor.wait_for_turn(ExecutionPriority::LOW, 0);
+            low_priority_ran = true;
+        });
+        this_thread::sleep_for(chrono::milliseconds(50));
+        EXPECT_FALSE(low_priority_ran);
+
+        // Calls made from within a call run on its behalf
+        ScheduledCall nested_call(cpu_executor, ExecutionPriority::LOW, 0);
+        EXPECT_EQ(nested_call.get_priority(), ExecutionPriority::HIGH);
+    }
+    low_priority.join();
+    EXPECT_TRUE(low_priority_ran);
+
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>((A + B) * B, ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("CPU");
+    shared_ptr<runtime::Tensor> a = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::Tensor> b = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::Tensor> result = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    copy_data(b, vector<float>{5, 6, 7, 8});
+
+    auto handle = backend->compile(f);
+    dynamic_pointer_cast<runtime::cpu::CPU_Executable>(handle)->set_scheduling(
+        ExecutionPriority::LOW, 1);
+    handle->call_with_validate({result}, {a, b});
+    EXPECT_EQ(read_vector<float>(result), (vector<float>{30, 48, 70, 96}));
+}
+
+TEST(cpu_test, bf16_kernels)
+{
+    auto make_function = [](bool bf16) {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{4, 8});
+        auto B = make_shared<op::Parameter>(element::f32, Shape{8, 3});
+        auto C = make_shared<op::Parameter>(element::f32, Shape{4, 3});
+        auto to_compute_type = [bf16](const shared_ptr<Node>& node) -> shared_ptr<Node> {
+            return bf16 ? make_shared<op::Convert>(node, element::bf16) : node;
+        };
+        auto dot = make_shared<op::Dot>(to_compute_type(A), to_compute_type(B));
+        auto relu = make_shared<op::Relu>(dot - to_compute_type(C));
+        auto sum = make_shared<op::Sum>(relu * relu, AxisSet{1});
+        auto result = make_shared<op::Maximum>(sum, -sum);
+        return make_shared<Function>(
+            bf16 ? make_shared<op::Convert>(result, element::f32) : shared_ptr<Node>(result),
+            ParameterVector{A, B, C});
+    };
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (auto& param : make_function(false)->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+
+    auto f32_results = execute(make_function(false), args, "CPU");
+    auto bf16_results = execute(make_function(true), args, "CPU");
+    EXPECT_TRUE(test::all_close(f32_results.at(0), bf16_results.at(0), 5e-2f, 5e-2f));
+}
+
+TEST(cpu_test, mixed_precision)
+{
+    auto make_function = []() {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{4, 8});
+        auto W = op::Constant::create(element::f32, Shape{8, 3}, vector<float>(24, 0.25f));
+        auto B = make_shared<op::Parameter>(element::f32, Shape{4, 3});
+        auto relu1 = make_shared<op::Relu>(make_shared<op::Dot>(A, W) + B);
+        // X is already available in bfloat16
+        auto X = make_shared<op::Parameter>(element::f32, Shape{4, 8});
+        auto X_f32 =
+            make_shared<op::Convert>(make_shared<op::Convert>(X, element::bf16), element::f32);
+        auto C = op::Constant::create(element::f32, Shape{4, 3}, vector<float>(12, -0.5f));
+        auto relu2 = make_shared<op::Relu>(make_shared<op::Dot>(X_f32, W) + C);
+        auto exp = make_shared<op::Exp>(relu1 + relu2);
+        return make_shared<Function>(exp, ParameterVector{A, B, X});
+    };
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    auto f32_f = make_function();
+    for (auto& param : f32_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+
+    auto f32_results = execute(f32_f, args, "CPU");
+    auto bf16_f = make_function();
+    set_environment("NGRAPH_PASS_ENABLES", "CPUMixedPrecision:1", 1);
+    auto bf16_results = execute(bf16_f, args, "CPU");
+    unset_environment("NGRAPH_PASS_ENABLES");
+
+    // A and B are not converted: the first Dot reads its weights in bfloat16 and the ops after
+    // it stay in f32. The second Dot, its Add and Relu run in bfloat16, converted back for Add.
+    size_t bf16_ops = 0;
+    for (auto& node : bf16_f->get_ordered_ops())
+    {
+        if (!node->is_parameter() && !node->is_constant() &&
+            node->get_element_type() == element::bf16)
+        {
+            bf16_ops++;
+        }
+    }
+    EXPECT_EQ(bf16_ops, 4); // Convert of X, Dot, Add, Relu
+    EXPECT_EQ(count_ops_of_type<op::Convert>(bf16_f), 2);
+    EXPECT_EQ(count_ops_of_type<op::DotF16Weights>(bf16_f), 1);
+    EXPECT_TRUE(test::all_close(f32_results.at(0), bf16_results.at(0), 5e-2f, 5e-2f));
+}
+
+TEST(cpu_test, dot_f16_weights)
+{
+    auto make_function = []() {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{3, 100});
+        test::Uniform<float> rng(-1.0f, 1.0f);
+        vector<float> w1(100 * 70), w2(40 * 70);
+        rng.initialize(w1);
+        rng.initialize(w2);
+        auto W1 = op::Constant::create(element::f16, Shape{100, 70}, w1);
+        // Used transposed, as ONNX Gemm does with transB
+        auto W2 = make_shared<op::Parameter>(element::f16, Shape{40, 70});
+        auto dot1 = make_shared<op::Dot>(A, make_shared<op::Convert>(W1, element::f32));
+        auto W2_t = make_shared<op::Reshape>(
+            make_shared<op::Convert>(W2, element::f32), AxisVector{1, 0}, Shape{70, 40});
+        auto dot2 = make_shared<op::Dot>(make_shared<op::Relu>(dot1), W2_t);
+        return make_shared<Function>(dot2, ParameterVector{A, W2});
+    };
+
+    auto backend = runtime::Backend::create("CPU");
+    auto int_backend = runtime::Backend::create("INTERPRETER");
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<float> a(3 * 100), w2(40 * 70);
+    rng.initialize(a);
+    rng.initialize(w2);
+
+    vector<vector<float>> results;
+    for (auto b : {backend.get(), int_backend.get()})
+    {
+        auto f = make_function();
+        auto a_tensor = b->create_tensor(element::f32, Shape{3, 100});
+        copy_data(a_tensor, a);
+        auto w2_tensor = b->create_tensor(element::f16, Shape{40, 70});
+        copy_data(w2_tensor, float16::from_float_vector(w2));
+        auto result = b->create_tensor(element::f32, Shape{3, 40});
+        auto handle = b->compile(f);
+        handle->call_with_validate({result}, {a_tensor, w2_tensor});
+        results.push_back(read_vector<float>(result));
+        if (b == backend.get())
+        {
+            EXPECT_EQ(count_ops_of_type<op::DotF16Weights>(f), 2);
+            EXPECT_EQ(count_ops_of_type<op::Convert>(f), 0);
+        }
+    }
+    EXPECT_TRUE(test::all_close(results.at(0), results.at(1), 1e-4f, 1e-5f));
+}
+
+TEST(cpu_test, kernel_autotuning)
+{
+    auto make_function = []() {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{2, 16, 32});
+        auto B = make_shared<op::Parameter>(element::f32, Shape{32, 8});
+        auto dot = make_shared<op::Dot>(A, B);
+        auto softmax = make_shared<op::Softmax>(dot, AxisSet{0, 1, 2});
+        auto sum = make_shared<op::Sum>(dot, AxisSet{0});
+        return make_shared<Function>(NodeVector{softmax, sum}, ParameterVector{A, B});
+    };
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : make_function()->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(make_function(), args, "INTERPRETER");
+
+    string database = file_util::path_join(file_util::get_temp_directory_path(), "cpu_tuning_db");
+    file_util::remove_file(database);
+    auto read_database = [&database]() {
+        vector<string> lines;
+        ifstream file(database);
+        string line;
+        while (getline(file, line))
+        {
+            lines.push_back(line);
+        }
+        return lines;
+    };
+
+    // Dot, Softmax and Sum are timed and their decisions stored
+    set_environment("NGRAPH_CPU_TUNING_DB", database.c_str(), 1);
+    set_environment("NGRAPH_CPU_AUTOTUNE", "1", 1);
+    auto tuned_results = execute(make_function(), args, "CPU");
+    auto decisions = read_database();
+    EXPECT_EQ(decisions.size(), 3);
+
+    // Decisions are reused rather than timed again
+    tuned_results = execute(make_function(), args, "CPU");
+    EXPECT_EQ(read_database().size(), 3);
+    unset_environment("NGRAPH_CPU_AUTOTUNE");
+
+    // Later compiles follow the database they are given
+    string tuned_database = database;
+    database += ".reference";
+    {
+        ofstream file(database);
+        for (auto& decision : decisions)
+        {
+            file << decision.substr(0, decision.rfind('\t')) << "\treference\n";
+        }
+    }
+    auto& tuner = runtime::cpu::CPUKernelTuner::get();
+    size_t reference_selections = tuner.get_selection_count("reference");
+    set_environment("NGRAPH_CPU_TUNING_DB", database.c_str(), 1);
+    auto reference_results = execute(make_function(), args, "CPU");
+    unset_environment("NGRAPH_CPU_TUNING_DB");
+    EXPECT_EQ(read_database().size(), 3);
+    EXPECT_EQ(tuner.get_selection_count("reference") - reference_selections, 3);
+    file_util::remove_file(tuned_database);
+    file_util::remove_file(database);
+
+    for (size_t i = 0; i < int_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(tuned_results.at(i), int_results.at(i), 1.0e-4f, 1.0e-4f));
+        EXPECT_TRUE(
+            test::all_close(reference_results.at(i), int_results.at(i), 1.0e-4f, 1.0e-4f));
+    }
+}
+
+TEST(cpu_test, matmul_horizontal_fusion)
+{
+    auto make_function = []() {
+        // Three heads reading the same input, a transposed product and an independent tower
+        auto X = make_shared<op::Parameter>(element::f32, Shape{8, 16});
+        auto Wq = make_shared<op::Parameter>(element::f32, Shape{16, 12});
+        auto Wk = make_shared<op::Parameter>(element::f32, Shape{16, 12});
+        auto Wv = make_shared<op::Parameter>(element::f32, Shape{16, 12});
+        auto Y = make_shared<op::Parameter>(element::f32, Shape{4, 32});
+        auto Wy = make_shared<op::Parameter>(element::f32, Shape{6, 32});
+        auto q = make_shared<op::Dot>(X, Wq);
+        auto k = make_shared<op::Dot>(X, Wk);
+        auto v = make_shared<op::Dot>(X, Wv);
+        auto y =
+            make_shared<op::Dot>(Y, make_shared<op::Reshape>(Wy, AxisVector{1, 0}, Shape{32, 6}));
+        // Depends on q and k, so it is not fused with them
+        auto scores =
+            make_shared<op::Dot>(q, make_shared<op::Reshape>(k, AxisVector{1, 0}, Shape{12, 8}));
+        return make_shared<Function>(NodeVector{scores, v, y},
+                                     ParameterVector{X, Wq, Wk, Wv, Y, Wy});
+    };
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : make_function()->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+
+    auto int_f = make_function();
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_f = make_function();
+    auto cpu_results = execute(cpu_f, args, "CPU");
+    for (size_t i = 0; i < int_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1.0e-4f, 1.0e-4f));
+    }
+
+    ASSERT_EQ(count_ops_of_type<op::GroupedMatmul>(cpu_f), 1);
+    EXPECT_EQ(count_ops_of_type<op::Dot>(cpu_f) + count_ops_of_type<op::MatmulBias>(cpu_f), 1);
+    for (auto& node : cpu_f->get_ordered_ops())
+    {
+        if (auto grouped_matmul = dynamic_pointer_cast<op::GroupedMatmul>(node))
+        {
+            EXPECT_EQ(grouped_matmul->get_matmul_count(), 4);
+        }
+    }
+}
+
+TEST(cpu_test, matmul_horizontal_fusion_skips_large_products)
+{
+    // Two small products and two above the default m * n * k limit
+    auto A = make_shared<op::Parameter>(element::f32, Shape{8, 16});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{16, 12});
+    auto C = make_shared<op::Parameter>(element::f32, Shape{8, 16});
+    auto D = make_shared<op::Parameter>(element::f32, Shape{16, 12});
+    auto E = make_shared<op::Parameter>(element::f32, Shape{128, 128});
+    auto F = make_shared<op::Parameter>(element::f32, Shape{128, 128});
+    auto small_1 = make_shared<op::Dot>(A, B);
+    auto small_2 = make_shared<op::Dot>(C, D);
+    auto large_1 = make_shared<op::Dot>(E, F);
+    auto large_2 = make_shared<op::Dot>(F, E);
+    auto f = make_shared<Function>(NodeVector{small_1, small_2, large_1, large_2},
+                                   ParameterVector{A, B, C, D, E, F});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUMatmulHorizontalFusion>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::GroupedMatmul>(f), 1);
+    EXPECT_EQ(count_ops_of_type<op::Dot>(f), 2);
+    for (auto& node : f->get_ordered_ops())
+    {
+        if (auto grouped_matmul = dynamic_pointer_cast<op::GroupedMatmul>(node))
+        {
+            EXPECT_EQ(grouped_matmul->get_matmul_count(), 2);
+        }
+    }
+}
@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include <memory>
+#include <numeric>
 
 #include "gtest/gtest.h"
 #include "ngraph/file_util.hpp"
@@ -306,3 +307,44 @@ TEST(CSE, constant)
     ASSERT_NE(abs0->get_argument(0), absf->get_argument(0));
     ASSERT_NE(abs111->get_argument(0), abs112->get_argument(0));
 }
+
+TEST(CSE, constant_content_hash)
+{
+    auto a = op::Constant::create(element::f32, Shape{2, 3}, {1, 2, 3, 4, 5, 6});
+    auto b = op::Constant::create(element::f32, Shape{2, 3}, {1, 2, 3, 4, 5, 6});
+    auto c = op::Constant::create(element::f32, Shape{2, 3}, {1, 2, 3, 4, 5, 7});
+    auto d = op::Constant::create(element::f32, Shape{3, 2}, {1, 2, 3, 4, 5, 6});
+    auto e = op::Constant::create(element::i32, Shape{2, 3}, {1, 2, 3, 4, 5, 6});
+    EXPECT_EQ(a->get_content_hash(), b->get_content_hash());
+    EXPECT_NE(a->get_content_hash(), c->get_content_hash());
+    EXPECT_NE(a->get_content_hash(), d->get_content_hash());
+    EXPECT_NE(a->get_content_hash(), e->get_content_hash());
+}
+
+TEST(CSE, constant_shared_across_functions)
+{
+    vector<float> weights(1000);
+    iota(weights.begin(), weights.end(), 0.0f);
+    auto make_function = [&]() {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{1000});
+        auto W = op::Constant::create(element::f32, Shape{1000}, weights);
+        auto f = make_shared<Function>(make_shared<op::Multiply>(A, W), ParameterVector{A});
+        pass::Manager pass_manager;
+        pass_manager.register_pass<ngraph::pass::CommonSubexpressionElimination>();
+        pass_manager.run_passes(f);
+        return f;
+    };
+
+    auto f1 = make_function();
+    auto f2 = make_function();
+    auto get_weights = [](const shared_ptr<Function>& f) {
+        auto multiply = f->get_results().at(0)->get_argument(0);
+        return static_pointer_cast<op::Constant>(multiply->get_argument(1));
+    };
+    auto w2 = get_weights(f2);
+    EXPECT_EQ(get_weights(f1)->get_data_ptr(), w2->get_data_ptr());
+
+    // The shared data outlives the function it came from
+    f1.reset();
+    EXPECT_EQ(w2->get_vector<float>(), weights);
+}
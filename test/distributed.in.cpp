@@ -23,6 +23,8 @@
 #include "ngraph/distributed.hpp"
 #include "ngraph/file_util.hpp"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/pass/allreduce_bucketing.hpp"
+#include "ngraph/pass/manager.hpp"
 #include "ngraph/serializer.hpp"
 #include "util/random.hpp"
 
@@ -55,3 +57,58 @@ TEST(distributed_${BACKEND_NAME}, allreduce)
         EXPECT_EQ(v, read_vector<float>(result));
     }
 }
+
+TEST(distributed_${BACKEND_NAME}, allreduce_buckets)
+{
+    DistributedSetup distsetup;
+    auto comm_size = distsetup.get_comm_size();
+    if (comm_size > 1)
+    {
+        // Gradients of a few small layers, fused into two buckets and consumed separately
+        vector<Shape> shapes{Shape{2, 3}, Shape{4}, Shape{}, Shape{3, 1, 2}};
+        ParameterVector params;
+        NodeVector results;
+        for (auto& shape : shapes)
+        {
+            auto param = make_shared<op::Parameter>(element::f32, shape);
+            params.push_back(param);
+            results.push_back(make_shared<op::AllReduce>(param) * param);
+        }
+        auto f = make_shared<Function>(results, params);
+
+        pass::Manager pass_manager;
+        pass_manager.register_pass<pass::AllReduceBucketing>(48);
+        pass_manager.run_passes(f);
+        EXPECT_EQ(count_ops_of_type<op::AllReduce>(f), 2);
+
+        auto backend = runtime::Backend::create("${BACKEND_NAME}");
+        vector<shared_ptr<runtime::Tensor>> inputs;
+        vector<shared_ptr<runtime::Tensor>> outputs;
+        vector<vector<float>> expected;
+        float value = 1;
+        for (auto& shape : shapes)
+        {
+            vector<float> v(shape_size(shape));
+            vector<float> e(shape_size(shape));
+            for (size_t i = 0; i < v.size(); i++, value++)
+            {
+                v[i] = value;
+                e[i] = value * value * comm_size;
+            }
+            inputs.push_back(backend->create_tensor(element::f32, shape));
+            copy_data(inputs.back(), v);
+            outputs.push_back(backend->create_tensor(element::f32, shape));
+            expected.push_back(e);
+        }
+
+        auto handle = backend->compile(f);
+        for (int iteration = 0; iteration < 2; iteration++)
+        {
+            handle->call_with_validate(outputs, inputs);
+            for (size_t i = 0; i < shapes.size(); i++)
+            {
+                EXPECT_EQ(expected[i], read_vector<float>(outputs[i]));
+            }
+        }
+    }
+}
@@ -0,0 +1,155 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <memory>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/dynamic_executable.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// (A + B) * A over a batch of rows of 4
+static shared_ptr<Function> make_batched_function()
+{
+    PartialShape shape{Dimension::dynamic(), 4};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    return make_shared<Function>((A + B) * A, ParameterVector{A, B});
+}
+
+static void run_batch(runtime::DynamicExecutable& exec, runtime::Backend& backend, size_t batch)
+{
+    Shape shape{batch, 4};
+    vector<float> a_data(shape_size(shape));
+    vector<float> b_data(shape_size(shape));
+    vector<float> expected(shape_size(shape));
+    for (size_t i = 0; i < a_data.size(); i++)
+    {
+        a_data[i] = static_cast<float>(i);
+        b_data[i] = 1.0f;
+        expected[i] = (a_data[i] + b_data[i]) * a_data[i];
+    }
+
+    auto a = backend.create_tensor(element::f32, shape);
+    auto b = backend.create_tensor(element::f32, shape);
+    auto result = backend.create_tensor(element::f32, exec.get_output_shapes({shape, shape})[0]);
+    copy_data(a, a_data);
+    copy_data(b, b_data);
+    exec.call_with_validate({result}, {a, b});
+    EXPECT_EQ(read_vector<float>(result), expected);
+}
+
+TEST(dynamic_executable, specialize_per_shape)
+{
+    shared_ptr<runtime::Backend> backend = runtime::Backend::create("INTERPRETER");
+    runtime::DynamicExecutable exec(backend, make_batched_function(), 2);
+
+    run_batch(exec, *backend, 2);
+    run_batch(exec, *backend, 3);
+    run_batch(exec, *backend, 2);
+    EXPECT_EQ(exec.get_compile_count(), 2);
+
+    // Batch 3 is the least recently used and gets evicted
+    run_batch(exec, *backend, 5);
+    EXPECT_EQ(exec.get_cache_size(), 2);
+    run_batch(exec, *backend, 2);
+    EXPECT_EQ(exec.get_compile_count(), 3);
+    run_batch(exec, *backend, 3);
+    EXPECT_EQ(exec.get_compile_count(), 4);
+}
+
+TEST(dynamic_executable, bucketed_shapes)
+{
+    shared_ptr<runtime::Backend> backend = runtime::Backend::create("INTERPRETER");
+    runtime::DynamicExecutable exec(backend,
+                                    make_batched_function(),
+                                    16,
+                                    runtime::DynamicExecutable::round_up_to_power_of_two);
+
+    // Batches 3 and 4 share the padded batch 4 specialization
+    run_batch(exec, *backend, 3);
+    run_batch(exec, *backend, 4);
+    EXPECT_EQ(exec.get_compile_count(), 1);
+    run_batch(exec, *backend, 5);
+    run_batch(exec, *backend, 7);
+    EXPECT_EQ(exec.get_compile_count(), 2);
+}
+
+TEST(dynamic_executable, incompatible_shape)
+{
+    shared_ptr<runtime::Backend> backend = runtime::Backend::create("INTERPRETER");
+    runtime::DynamicExecutable exec(backend, make_batched_function());
+
+    Shape shape{2, 5};
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    EXPECT_ANY_THROW(exec.call_with_validate({result}, {a, b}));
+    EXPECT_EQ(exec.get_compile_count(), 0);
+}
+
+// Sums a batch of rows of 4 over `axis`
+static void run_sum(runtime::DynamicExecutable& exec,
+                    runtime::Backend& backend,
+                    size_t batch,
+                    size_t axis)
+{
+    Shape shape{batch, 4};
+    vector<float> a_data(shape_size(shape));
+    vector<float> expected(axis == 0 ? 4 : batch, 0.0f);
+    for (size_t i = 0; i < a_data.size(); i++)
+    {
+        a_data[i] = static_cast<float>(i + 1);
+        expected[axis == 0 ? i % 4 : i / 4] += a_data[i];
+    }
+
+    auto a = backend.create_tensor(element::f32, shape);
+    auto result = backend.create_tensor(element::f32, exec.get_output_shapes({shape})[0]);
+    copy_data(a, a_data);
+    exec.call_with_validate({result}, {a});
+    EXPECT_EQ(read_vector<float>(result), expected);
+}
+
+TEST(dynamic_executable, bucketed_reduction)
+{
+    shared_ptr<runtime::Backend> backend = runtime::Backend::create("INTERPRETER");
+    auto A = make_shared<op::Parameter>(element::f32, PartialShape{Dimension::dynamic(), 4});
+
+    // The batch axis is summed, so padding it would change the result and it is kept exact
+    runtime::DynamicExecutable batch_sum(
+        backend,
+        make_shared<Function>(make_shared<op::Sum>(A, AxisSet{0}), ParameterVector{A}),
+        16,
+        runtime::DynamicExecutable::round_up_to_power_of_two);
+    run_sum(batch_sum, *backend, 3, 0);
+    run_sum(batch_sum, *backend, 4, 0);
+    EXPECT_EQ(batch_sum.get_compile_count(), 2);
+
+    // Rows are summed independently, so batches still share a bucket. Batch 7 runs first so
+    // the staging tensor holds stale rows where batch 5 is padded.
+    runtime::DynamicExecutable row_sum(
+        backend,
+        make_shared<Function>(make_shared<op::Sum>(A, AxisSet{1}), ParameterVector{A}),
+        16,
+        runtime::DynamicExecutable::round_up_to_power_of_two);
+    run_sum(row_sum, *backend, 7, 1);
+    run_sum(row_sum, *backend, 5, 1);
+    EXPECT_EQ(row_sum.get_compile_count(), 1);
+}
@@ -14,6 +14,7 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <cmath>
 #include <map>
 
 #include "gtest/gtest.h"
@@ -36,6 +37,33 @@ TEST(element_type, from)
     EXPECT_EQ(element::from<uint16_t>(), element::u16);
     EXPECT_EQ(element::from<uint32_t>(), element::u32);
     EXPECT_EQ(element::from<uint64_t>(), element::u64);
+    EXPECT_EQ(element::from<bfloat16>(), element::bf16);
+    EXPECT_EQ(element::from<float16>(), element::f16);
+}
+
+TEST(element_type, f16)
+{
+    EXPECT_EQ(element::f16.size(), 2);
+    EXPECT_EQ(sizeof(float16), 2);
+    EXPECT_TRUE(element::f16.is_real());
+    EXPECT_NE(element::f16, element::bf16);
+    // bf16 has the same properties, the name tells them apart
+    EXPECT_EQ(element::Type(16, true, true, false, "float16"), element::f16);
+    EXPECT_EQ(element::Type(16, true, true, false, "bfloat16"), element::bf16);
+}
+
+TEST(element_type, float16_conversions)
+{
+    EXPECT_EQ(float16(1.0f).to_bits(), 0x3c00);
+    EXPECT_EQ(float16(-2.0f).to_bits(), 0xc000);
+    EXPECT_EQ(float16(65504.0f).to_bits(), 0x7bff);
+    EXPECT_EQ(float16(65520.0f).to_bits(), 0x7c00);
+    // Smallest subnormal, and a tie that rounds to even
+    EXPECT_EQ(float16(5.9604644775390625e-8f).to_bits(), 0x0001);
+    EXPECT_EQ(float16(1.0f + 1.0f / 2048).to_bits(), 0x3c00);
+    EXPECT_EQ(static_cast<float>(float16::from_bits(0x3555)), 0.333251953125f);
+    EXPECT_EQ(static_cast<float>(float16::from_bits(0x0001)), 5.9604644775390625e-8f);
+    EXPECT_TRUE(std::isnan(static_cast<float>(float16(NAN))));
 }
 
 TEST(element_type, mapable)
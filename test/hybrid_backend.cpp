@@ -14,10 +14,13 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <cstring>
+#include <fstream>
 #include <memory>
 
 #include "gtest/gtest.h"
 
+#include "ngraph/file_util.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/ngraph.hpp"
 #include "ngraph/op/get_output_element.hpp"
@@ -28,6 +31,7 @@
 #include "ngraph/runtime/hybrid/hybrid_backend.hpp"
 #include "ngraph/runtime/hybrid/hybrid_util.hpp"
 #include "ngraph/runtime/hybrid/op/function_call.hpp"
+#include "ngraph/runtime/hybrid/pass/cost_based_placement.hpp"
 #include "ngraph/runtime/interpreter/int_backend.hpp"
 #include "util/all_close.hpp"
 #include "util/all_close_f.hpp"
@@ -133,3 +137,233 @@ TEST(HYBRID, abc)
     handle->call_with_validate({result1, result2}, {a, b, c, d});
     EXPECT_EQ(read_vector<float>(result2), (vector<float>{150, 576, 1176, 1536}));
 }
+
+// Interpreter that cannot attach host memory and counts the tensors it allocates
+class StagingBackend : public runtime::interpreter::INTBackend
+{
+public:
+    StagingBackend(const vector<string>& unsupported_op_name_list)
+        : INTBackend(unsupported_op_name_list)
+    {
+    }
+
+    using INTBackend::create_tensor;
+    shared_ptr<runtime::Tensor> create_tensor(const element::Type& type,
+                                              const Shape& shape) override
+    {
+        m_tensor_count++;
+        return INTBackend::create_tensor(type, shape);
+    }
+
+    bool is_supported_property(const Property prop) const override { return false; }
+    size_t m_tensor_count = 0;
+};
+
+TEST(HYBRID, reused_transfers)
+{
+    auto staging_backend = make_shared<StagingBackend>(vector<string>{"Multiply"});
+    vector<shared_ptr<runtime::Backend>> backend_list = {
+        make_shared<runtime::interpreter::INTBackend>(vector<string>{"Add"}), staging_backend};
+    auto backend = make_shared<runtime::hybrid::HybridBackend>(backend_list);
+
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto C = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>((A + B) * C, ParameterVector{A, B, C});
+    auto handle = backend->compile(f);
+
+    // Host tensors from another backend are attached, not copied
+    auto host_backend = runtime::Backend::create("INTERPRETER");
+    shared_ptr<runtime::Tensor> a = host_backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::Tensor> b = host_backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::Tensor> c = host_backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::Tensor> result = host_backend->create_tensor(element::f32, shape);
+
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    copy_data(b, vector<float>{5, 6, 7, 8});
+    copy_data(c, vector<float>{9, 10, 11, 12});
+    handle->call_with_validate({result}, {a, b, c});
+    EXPECT_EQ(read_vector<float>(result), (vector<float>{54, 80, 110, 144}));
+    size_t staged_tensor_count = staging_backend->m_tensor_count;
+    EXPECT_GT(staged_tensor_count, 0);
+
+    // The multiply runs on a backend without memory_attach through staging tensors that
+    // are allocated once
+    copy_data(c, vector<float>{1, 1, 1, 1});
+    handle->call_with_validate({result}, {a, b, c});
+    EXPECT_EQ(read_vector<float>(result), (vector<float>{6, 8, 10, 12}));
+    EXPECT_EQ(staging_backend->m_tensor_count, staged_tensor_count);
+}
+
+// Tensor of no backend, which the hybrid backend can only copy from
+class ForeignTensor : public runtime::Tensor
+{
+public:
+    ForeignTensor(const element::Type& type, const Shape& shape)
+        : runtime::Tensor(make_shared<descriptor::Tensor>(type, shape, "foreign"), nullptr)
+        , m_data(shape_size(shape) * type.size())
+    {
+    }
+
+    void write(const void* p, size_t offset, size_t n) override
+    {
+        memcpy(m_data.data() + offset, p, n);
+    }
+    void read(void* p, size_t offset, size_t n) const override
+    {
+        memcpy(p, m_data.data() + offset, n);
+    }
+
+private:
+    vector<char> m_data;
+};
+
+// Interpreter that attaches host memory and counts the tensors it allocates itself
+class AttachingBackend : public runtime::interpreter::INTBackend
+{
+public:
+    using INTBackend::create_tensor;
+    shared_ptr<runtime::Tensor> create_tensor(const element::Type& type,
+                                              const Shape& shape) override
+    {
+        m_tensor_count++;
+        return INTBackend::create_tensor(type, shape);
+    }
+
+    size_t m_tensor_count = 0;
+};
+
+TEST(HYBRID, staging_after_attached_tensor_freed)
+{
+    auto attaching_backend = make_shared<AttachingBackend>();
+    vector<shared_ptr<runtime::Backend>> backend_list = {attaching_backend};
+    auto backend = make_shared<runtime::hybrid::HybridBackend>(backend_list);
+
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(A + B, ParameterVector{A, B});
+    auto handle = backend->compile(f);
+
+    auto host_backend = runtime::Backend::create("INTERPRETER");
+    shared_ptr<runtime::Tensor> a = host_backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::Tensor> b = host_backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::Tensor> result = host_backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    copy_data(b, vector<float>{5, 6, 7, 8});
+    handle->call_with_validate({result}, {a, b});
+    EXPECT_EQ(read_vector<float>(result), (vector<float>{6, 8, 10, 12}));
+
+    // A, attached to the memory of a, is staged once a is gone instead of writing to its
+    // freed memory
+    a.reset();
+    size_t tensor_count = attaching_backend->m_tensor_count;
+    auto foreign_a = make_shared<ForeignTensor>(element::f32, shape);
+    copy_data(foreign_a, vector<float>{10, 20, 30, 40});
+    handle->call_with_validate({result}, {foreign_a, b});
+    EXPECT_EQ(read_vector<float>(result), (vector<float>{15, 26, 37, 48}));
+    EXPECT_EQ(attaching_backend->m_tensor_count, tensor_count + 1);
+}
+
+// (A * B) * C + A
+static shared_ptr<Function> make_cost_function(NodeVector& ops)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto C = make_shared<op::Parameter>(element::f32, shape);
+    auto t1 = A * B;
+    auto t2 = t1 * C;
+    auto t3 = t2 + A;
+    ops = NodeVector{t1, t2, t3};
+    return make_shared<Function>(t3, ParameterVector{A, B, C});
+}
+
+static void run_cost_based_placement(const shared_ptr<Function>& f,
+                                     const shared_ptr<runtime::hybrid::CostModel>& cost_model)
+{
+    vector<shared_ptr<runtime::Backend>> backend_list = {
+        make_shared<runtime::interpreter::INTBackend>(),
+        make_shared<runtime::interpreter::INTBackend>()};
+    ngraph::pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::hybrid::pass::CostBasedPlacement>(backend_list,
+                                                                          cost_model);
+    pass_manager.run_passes(f);
+}
+
+TEST(HYBRID, cost_based_placement)
+{
+    auto cost_model = make_shared<runtime::hybrid::CostModel>();
+    cost_model->set_op_cost(1, "Multiply", 0.1);
+
+    // Free transfers: the multiplies go where they are cheaper
+    NodeVector ops;
+    auto f = make_cost_function(ops);
+    run_cost_based_placement(f, cost_model);
+    EXPECT_EQ(ops[0]->get_placement_index(), 1);
+    EXPECT_EQ(ops[1]->get_placement_index(), 1);
+    EXPECT_EQ(ops[2]->get_placement_index(), 0);
+    for (auto& node : f->get_parameters())
+    {
+        EXPECT_EQ(node->get_placement_index(), 0);
+    }
+    EXPECT_EQ(f->get_results().at(0)->get_placement_index(), 0);
+
+    // Transfers cost more than the multiplies save
+    cost_model->set_transfer_cost(1);
+    f = make_cost_function(ops);
+    run_cost_based_placement(f, cost_model);
+    for (auto& node : ops)
+    {
+        EXPECT_EQ(node->get_placement_index(), 0);
+    }
+
+    // So does the call of the subgraph
+    cost_model->set_transfer_cost(0);
+    cost_model->set_call_overhead(100);
+    f = make_cost_function(ops);
+    run_cost_based_placement(f, cost_model);
+    for (auto& node : ops)
+    {
+        EXPECT_EQ(node->get_placement_index(), 0);
+    }
+}
+
+TEST(HYBRID, cost_based_execution)
+{
+    const string profile_path = "hybrid_costs.txt";
+    {
+        ofstream profile(profile_path);
+        profile << "# backend op cost\n"
+                << "transfer 0.001\n"
+                << "overhead 1\n"
+                << "1 Multiply 0.1\n";
+    }
+    auto cost_model = make_shared<runtime::hybrid::CostModel>();
+    cost_model->load(profile_path);
+    file_util::remove_file(profile_path);
+    EXPECT_EQ(cost_model->get_call_overhead(), 1);
+    EXPECT_DOUBLE_EQ(cost_model->get_transfer_cost(1000), 1);
+
+    vector<shared_ptr<runtime::Backend>> backend_list = {
+        make_shared<runtime::interpreter::INTBackend>(),
+        make_shared<runtime::interpreter::INTBackend>()};
+    auto backend = make_shared<runtime::hybrid::HybridBackend>(backend_list);
+    backend->set_cost_model(cost_model);
+
+    NodeVector ops;
+    auto f = make_cost_function(ops);
+    Shape shape{2, 2};
+    shared_ptr<runtime::Tensor> a = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::Tensor> b = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::Tensor> c = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::Tensor> result = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    copy_data(b, vector<float>{5, 6, 7, 8});
+    copy_data(c, vector<float>{9, 10, 11, 12});
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a, b, c});
+    EXPECT_EQ(read_vector<float>(result), (vector<float>{46, 122, 234, 388}));
+}
@@ -88,6 +88,27 @@ TEST(onnx_${BACKEND_NAME}, model_add_abc_initializers)
     EXPECT_TRUE(test::all_close_f(expected_outputs.front(), outputs.front()));
 }
 
+TEST(onnx_${BACKEND_NAME}, model_add_abc_external_data)
+{
+    auto function = onnx_import::import_onnx_model(
+        file_util::path_join(SERIALIZED_ZOO, "onnx/external_data/add_abc_external_data.prototxt"));
+
+    Inputs inputs{{1, 2, 3, 4}};
+    Outputs expected_outputs{{3, 6, 9, 12}};
+
+    Outputs outputs{execute(function, inputs, "${BACKEND_NAME}")};
+    EXPECT_TRUE(test::all_close_f(expected_outputs.front(), outputs.front()));
+}
+
+TEST(onnx_${BACKEND_NAME}, model_external_data_missing_file)
+{
+    std::stringstream model;
+    model << file_util::read_file_to_string(file_util::path_join(
+        SERIALIZED_ZOO, "onnx/external_data/add_abc_external_data.prototxt"));
+    // Loaded from a stream the location is resolved against the working directory
+    EXPECT_THROW(onnx_import::import_onnx_model(model), ngraph_error);
+}
+
 TEST(onnx_${BACKEND_NAME}, model_addmul_abc)
 {
     auto function = onnx_import::import_onnx_model(
@@ -0,0 +1,156 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/autodiff/adjoints.hpp"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/pass/rematerialization.hpp"
+#include "util/all_close_f.hpp"
+#include "util/random.hpp"
+#include "util/test_tools.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+// exp(A) is consumed right away and again at the very end, so it is live across the peak
+// at t4 where t2 and t3 are live too
+static shared_ptr<Function> make_long_lived_activation()
+{
+    Shape shape{1024};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto t1 = make_shared<op::Exp>(A);
+    auto t2 = t1 * B;
+    auto t3 = t2 + B;
+    auto t4 = t3 * t2;
+    auto t5 = make_shared<op::Tanh>(t4);
+    auto out = t5 + t1;
+    return make_shared<Function>(NodeVector{out}, ParameterVector{A, B});
+}
+
+static size_t count_exp(const shared_ptr<Function>& f)
+{
+    auto ops = f->get_ordered_ops();
+    return count_if(ops.begin(), ops.end(), [](const shared_ptr<Node>& n) {
+        return dynamic_pointer_cast<op::Exp>(n) != nullptr;
+    });
+}
+
+TEST(rematerialization, recompute_under_budget)
+{
+    auto f = make_long_lived_activation();
+    auto original = clone_function(*f);
+    pass::Rematerialization remat(3 * 1024 * sizeof(float));
+    remat.run_on_function(f);
+
+    EXPECT_EQ(remat.get_recomputed_op_count(), 1);
+    EXPECT_EQ(count_exp(f), 2);
+    EXPECT_LT(remat.get_final_peak(), remat.get_initial_peak());
+    EXPECT_LE(remat.get_final_peak(), 3 * 1024 * sizeof(float));
+    EXPECT_EQ(remat.get_final_pool_size(), f->get_temporary_pool_size());
+
+    // The rewritten function computes what the original one does
+    vector<vector<float>> args;
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    for (auto& param : f->get_parameters())
+    {
+        vector<float> arg(shape_size(param->get_shape()));
+        rng.initialize(arg);
+        args.push_back(arg);
+    }
+    auto expected = execute(original, args, "INTERPRETER");
+    auto results = execute(f, args, "INTERPRETER");
+    EXPECT_TRUE(test::all_close_f(expected.at(0), results.at(0)));
+
+    // The recomputed exp is scheduled after the forward chain, right before its consumer
+    auto ops = f->get_ordered_ops();
+    auto last_exp = find_if(ops.rbegin(), ops.rend(), [](const shared_ptr<Node>& n) {
+        return dynamic_pointer_cast<op::Exp>(n) != nullptr;
+    });
+    ASSERT_NE(last_exp, ops.rend());
+    EXPECT_TRUE(dynamic_pointer_cast<op::Tanh>(*next(last_exp)) != nullptr);
+}
+
+TEST(rematerialization, within_budget)
+{
+    auto f = make_long_lived_activation();
+    pass::Rematerialization remat(1024 * 1024);
+    remat.run_on_function(f);
+
+    EXPECT_EQ(remat.get_recomputed_op_count(), 0);
+    EXPECT_EQ(count_exp(f), 1);
+    EXPECT_EQ(remat.get_final_peak(), remat.get_initial_peak());
+}
+
+// Three tanh(h * B) layers on top of exp(A), and their backprop. Every activation is consumed
+// again by its adjoint, so exp(A) stays alive through the whole backward pass.
+static shared_ptr<Function> make_training_function()
+{
+    Shape shape{1024};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    shared_ptr<Node> y = make_shared<op::Exp>(A);
+    for (size_t layer = 0; layer < 3; layer++)
+    {
+        y = make_shared<op::Tanh>(y * B);
+    }
+
+    auto C = make_shared<op::Parameter>(element::f32, shape);
+    autodiff::Adjoints adjoints(NodeVector{y}, NodeVector{C});
+    NodeVector outputs{y, adjoints.backprop_node(A), adjoints.backprop_node(B)};
+    return make_shared<Function>(outputs, ParameterVector{A, B, C});
+}
+
+TEST(rematerialization, autodiff)
+{
+    auto f = make_training_function();
+    auto original = clone_function(*f);
+    pass::Rematerialization measure(numeric_limits<size_t>::max());
+    measure.run_on_function(clone_function(*f));
+
+    pass::Rematerialization remat(measure.get_initial_peak() - 1);
+    remat.run_on_function(f);
+    EXPECT_EQ(remat.get_initial_peak(), measure.get_initial_peak());
+    EXPECT_GT(remat.get_recomputed_op_count(), 0);
+    EXPECT_GT(count_exp(f), count_exp(original));
+    EXPECT_LT(remat.get_final_peak(), remat.get_initial_peak());
+
+    // The pool is planned again for the rewritten graph
+    EXPECT_EQ(remat.get_initial_pool_size(), measure.get_initial_pool_size());
+    EXPECT_EQ(remat.get_final_pool_size(), f->get_temporary_pool_size());
+    EXPECT_LT(remat.get_final_pool_size(), remat.get_initial_pool_size());
+
+    vector<vector<float>> args;
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    for (auto& param : f->get_parameters())
+    {
+        vector<float> arg(shape_size(param->get_shape()));
+        rng.initialize(arg);
+        args.push_back(arg);
+    }
+    auto expected = execute(original, args, "INTERPRETER");
+    auto results = execute(f, args, "INTERPRETER");
+    ASSERT_EQ(results.size(), expected.size());
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close_f(expected.at(i), results.at(i)));
+    }
+}
@@ -14,6 +14,7 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <fstream>
 #include <sstream>
 #include <string>
@@ -394,6 +395,71 @@ TEST(graph_util, test_subgraph_topological_sort_control_dependencies)
     ASSERT_EQ(expected, sorted);
 }
 
+TEST(graph_util, cached_ordered_ops)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto add = A + B;
+    auto neg = make_shared<op::Negative>(add);
+    auto f = make_shared<Function>(NodeVector{neg}, ParameterVector{A, B});
+
+    auto sorted = f->get_ordered_ops();
+    EXPECT_EQ(sorted, topological_sort(f->get_ops(), true));
+    auto raw = f->get_ordered_ops_raw();
+    ASSERT_EQ(raw.size(), sorted.size());
+    EXPECT_TRUE(std::equal(raw.begin(),
+                           raw.end(),
+                           sorted.begin(),
+                           [](Node* a, const shared_ptr<Node>& b) { return a == b.get(); }));
+
+    // Callers share the cached list until the graph changes
+    auto shared = f->get_ordered_ops_shared();
+    EXPECT_EQ(*shared, sorted);
+    EXPECT_EQ(f->get_ordered_ops_shared(), shared);
+
+    // Rewiring the graph must invalidate the cached order
+    auto abs = make_shared<op::Abs>(add);
+    f->replace_node(neg, abs);
+    auto resorted = f->get_ordered_ops();
+    EXPECT_NE(f->get_ordered_ops_shared(), shared);
+    EXPECT_EQ(*shared, sorted);
+    EXPECT_EQ(resorted, topological_sort(f->get_ops(), true));
+    EXPECT_EQ(std::count(resorted.begin(), resorted.end(), neg), 0);
+    EXPECT_EQ(std::count(resorted.begin(), resorted.end(), abs), 1);
+
+    // So must adding a control dependency
+    auto C = make_shared<op::Abs>(A);
+    add->add_control_dependency(C);
+    EXPECT_EQ(f->get_ordered_ops_raw(false).size(), resorted.size());
+    EXPECT_EQ(f->get_ordered_ops_raw(true).size(), resorted.size() + 1);
+}
+
+TEST(graph_util, cached_ordered_ops_per_function)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto neg = make_shared<op::Negative>(A);
+    auto f = make_shared<Function>(NodeVector{neg}, ParameterVector{A});
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto abs = make_shared<op::Abs>(B);
+    auto g = make_shared<Function>(NodeVector{abs}, ParameterVector{B});
+
+    auto f_ops = f->get_ordered_ops_shared();
+    weak_ptr<const list<shared_ptr<Node>>> g_ops = g->get_ordered_ops_shared();
+    ASSERT_FALSE(g_ops.expired());
+
+    // Rewiring g leaves the order cached on f alone, and drops g's at once
+    g->replace_node(abs, make_shared<op::Sign>(B));
+    EXPECT_EQ(f->get_ordered_ops_shared(), f_ops);
+    EXPECT_TRUE(g_ops.expired());
+
+    // The replaced op is no longer kept alive by the cache
+    weak_ptr<Node> replaced = abs;
+    abs.reset();
+    EXPECT_TRUE(replaced.expired());
+}
+
 TEST(pass, visualize_tree)
 {
     Shape shape{2, 2};